@@ -46,9 +46,9 @@ int main(){
   simpleparser_init(&parser,
     false,
     buffer, sizeof(buffer),
-    [](uint8_t * data, uint16_t length, void * user_data){
-        printf("other message (%d): ", length);
-        for(int i = 0; i < length; i++){
+    [](uint8_t * data, size_t length, void * user_data){
+        printf("other message (%zu): ", length);
+        for(size_t i = 0; i < length; i++){
           printf("%02x", data[i]);
         }
         printf("\n");
@@ -0,0 +1,123 @@
+#include <midimessage/packers.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace MidiMessage;
+
+// measures pack()/unpack() dispatch on mixed traffic (channel voice, system common/real time and universal sysex)
+
+#define MESSAGES    100000
+#define ROUNDS      50
+
+struct Packed {
+  size_t Offset;
+  size_t Length;
+};
+
+static std::vector<uint8_t> stream;
+static std::vector<Packed> packed;
+
+static void add(uint8_t * bytes, size_t length){
+  Packed p = { stream.size(), length };
+  stream.insert(stream.end(), bytes, bytes + length);
+  packed.push_back(p);
+}
+
+static void generateMessages(){
+
+  uint8_t bytes[32];
+
+  srand(1);
+
+  for(int i = 0; i < MESSAGES; i++){
+
+    switch(rand() % 16){
+      case 0: case 1: case 2: case 3: case 4:
+        add(bytes, packNoteOn(bytes, rand() % 16, rand() & DataMask, rand() & DataMask));
+        break;
+
+      case 5: case 6: case 7:
+        add(bytes, packControlChange(bytes, rand() % 16, rand() & DataMask, rand() & DataMask));
+        break;
+
+      case 8:
+        add(bytes, packPitchBendChange(bytes, rand() % 16, rand() & MaxU14));
+        break;
+
+      case 9: case 10: case 11:
+        add(bytes, packSystemMessage(bytes, SystemMessageTimingClock));
+        break;
+
+      case 12:
+        add(bytes, packMtcQuarterFrame(bytes, rand() % 8, rand() & NibbleMask));
+        break;
+
+      case 13:
+        add(bytes, packSongPositionPointer(bytes, rand() & MaxU14));
+        break;
+
+      case 14:
+        add(bytes, packSysExRtMtcFullMessage(bytes, rand() & DataMask, MtcFrameRate25fps, rand() % 24, rand() % 60, rand() % 60, rand() % 25));
+        break;
+
+      case 15:
+        add(bytes, packSysExNonRtGeneralMidi(bytes, rand() & DataMask, SysExNonRtGmSystemOn1));
+        break;
+    }
+  }
+}
+
+static void report(const char * name, std::chrono::steady_clock::duration duration){
+  double seconds = std::chrono::duration<double>(duration).count();
+
+  printf("%-12s %8.3f s   %8.2f ns/message\n", name, seconds, seconds * 1e9 / ((double)MESSAGES * ROUNDS));
+}
+
+int main(){
+
+  generateMessages();
+
+  std::vector<Message_t> messages(packed.size());
+
+  uint8_t sysexBuffer[256];
+  uint8_t bytes[256];
+
+  for(size_t i = 0; i < messages.size(); i++){
+    messages[i].Data.SysEx.ByteData = sysexBuffer;
+  }
+
+  printf("%d messages (%lu bytes) x %d rounds\n", MESSAGES, (unsigned long)stream.size(), ROUNDS);
+
+  size_t failed = 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  for(int r = 0; r < ROUNDS; r++){
+    for(size_t i = 0; i < packed.size(); i++){
+      if ( ! unpack(&stream[packed[i].Offset], packed[i].Length, &messages[i]) ){
+        failed++;
+      }
+    }
+  }
+
+  report("unpack()", std::chrono::steady_clock::now() - start);
+
+  size_t total = 0;
+
+  start = std::chrono::steady_clock::now();
+
+  for(int r = 0; r < ROUNDS; r++){
+    for(size_t i = 0; i < messages.size(); i++){
+      total += pack(bytes, &messages[i]);
+    }
+  }
+
+  report("pack()", std::chrono::steady_clock::now() - start);
+
+  printf("(failed %lu, packed %lu bytes)\n", (unsigned long)failed, (unsigned long)total);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,104 @@
+#include <midimessage/parser.h>
+#include <midimessage/basicparser.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace MidiMessage;
+
+// compares messages/sec of Parser_t (function pointer handlers) and BasicParser (template handlers)
+
+#define STREAM_MESSAGES 1000000
+#define ROUNDS          10
+
+static volatile uint32_t checksum = 0;
+
+static void messageHandler(Message_t * msg, void *){
+  checksum += msg->StatusClass + msg->Data.Note.Key;
+}
+
+struct MessageHandler {
+  inline void operator()(Message_t * msg){
+    checksum += msg->StatusClass + msg->Data.Note.Key;
+  }
+};
+
+static std::vector<uint8_t> generateStream(){
+
+  std::vector<uint8_t> stream;
+
+  const uint8_t statusClasses[] = {
+    StatusClassNoteOff, StatusClassNoteOn, StatusClassNoteOn, StatusClassNoteOn,
+    StatusClassControlChange, StatusClassControlChange, StatusClassPitchBendChange, StatusClassChannelPressure
+  };
+
+  srand(1);
+
+  for(int i = 0; i < STREAM_MESSAGES; i++){
+
+    // some interleaved timing clocks
+    if (i % 24 == 0){
+      stream.push_back(SystemMessageTimingClock);
+      continue;
+    }
+
+    uint8_t status = statusClasses[rand() % sizeof(statusClasses)] | (rand() % 16);
+
+    stream.push_back(status);
+    stream.push_back(rand() & DataMask);
+    if (getMsgLen(status) == 3){
+      stream.push_back(rand() & DataMask);
+    }
+  }
+
+  return stream;
+}
+
+static void report(const char * name, std::chrono::steady_clock::duration duration){
+  double seconds = std::chrono::duration<double>(duration).count();
+
+  printf("%-32s %8.3f s   %8.2f M messages/sec\n", name, seconds, (double)STREAM_MESSAGES * ROUNDS / seconds / 1e6);
+}
+
+int main(){
+
+  std::vector<uint8_t> stream = generateStream();
+
+  uint8_t buffer[256];
+  uint8_t sysexBuffer[256];
+  Message_t msg = Message_t();
+  msg.Data.SysEx.ByteData = sysexBuffer;
+
+  printf("%d messages (%lu bytes) x %d rounds\n", STREAM_MESSAGES, (unsigned long)stream.size(), ROUNDS);
+
+  {
+    Parser_t parser;
+    parser_init(&parser, false, buffer, sizeof(buffer), &msg, messageHandler, NULL, NULL);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(int r = 0; r < ROUNDS; r++){
+      parser_receivedData(&parser, stream.data(), stream.size());
+    }
+
+    report("Parser_t (function pointer)", std::chrono::steady_clock::now() - start);
+  }
+
+  {
+    BasicParser<MessageHandler> parser(false, buffer, sizeof(buffer), &msg);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for(int r = 0; r < ROUNDS; r++){
+      parser.receivedData(stream.data(), stream.size());
+    }
+
+    report("BasicParser<> (template)", std::chrono::steady_clock::now() - start);
+  }
+
+  printf("(checksum %08x)\n", checksum);
+
+  return EXIT_SUCCESS;
+}
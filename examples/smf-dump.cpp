@@ -0,0 +1,75 @@
+#include <midimessage/smf.h>
+#include <midimessage/stringifier.h>
+
+#include <cstdio>
+
+using namespace MidiMessage;
+
+int main(int argc, char * argv[]){
+
+  if (argc < 2){
+    printf("Usage: %s <file.mid>\n", argv[0]);
+    return 1;
+  }
+
+  SmfFile_t file;
+
+  if ( ! smf_mapFile(argv[1], &file) ){
+    printf("Failed to map %s\n", argv[1]);
+    return 1;
+  }
+
+  SmfHeader_t header;
+
+  if ( ! smf_readHeader(file.Data, file.Length, &header) ){
+    printf("Not a standard midi file\n");
+    smf_unmapFile(&file);
+    return 1;
+  }
+
+  printf("format %d tracks %d division %d\n", header.Format, header.TrackCount, header.Division);
+
+  uint8_t sysexBuffer[256];
+  uint8_t byteData[256];
+  uint8_t str[256];
+
+  Message_t msg;
+  msg.Data.SysEx.ByteData = byteData;
+
+  SmfTrack_t track;
+  SmfEvent_t event;
+  size_t offset = 0;
+  int t = 0;
+  int result;
+  int len;
+
+  while( (result = smf_nextTrack(file.Data, file.Length, &offset, &track)) == SmfResultOk ){
+
+    printf("track %d\n", t++);
+
+    while( (result = smf_readEvent(&track, &event)) == SmfResultOk ){
+
+      if (event.Type == SmfEventTypeMeta){
+        printf("%llu meta %02x (%u bytes)\n", (unsigned long long)event.Time, event.MetaType, event.Length);
+      }
+      else if (smf_unpackEvent(&event, &msg, sysexBuffer, sizeof(sysexBuffer)) && (len = MessagetoStringBounded(str, sizeof(str), &msg)) > 0){
+        printf("%llu %.*s\n", (unsigned long long)event.Time, len, str);
+      }
+      else {
+        printf("%llu (%u bytes not unpacked)\n", (unsigned long long)event.Time, event.Length);
+      }
+    }
+
+    if (result == SmfResultError){
+      printf("invalid event\n");
+    }
+  }
+
+  if (result == SmfResultError){
+    printf("invalid chunk\n");
+  }
+
+  smf_unmapFile(&file);
+
+  return 0;
+}
@@ -0,0 +1,102 @@
+#include <midimessage/merge.h>
+
+#include <cstdio>
+#include <vector>
+
+using namespace MidiMessage;
+
+/**
+ * Flattens a (type 1) standard midi file into a single track (type 0) by a streaming merge of its tracks.
+ */
+
+int main(int argc, char * argv[]){
+
+  if (argc < 3){
+    printf("Usage: %s <in.mid> <out.mid>\n", argv[0]);
+    return 1;
+  }
+
+  SmfFile_t file;
+
+  if ( ! smf_mapFile(argv[1], &file) ){
+    printf("Failed to map %s\n", argv[1]);
+    return 1;
+  }
+
+  SmfHeader_t header;
+
+  if ( ! smf_readHeader(file.Data, file.Length, &header) || header.Format == SmfFormatMultiSequence ){
+    printf("Not a standard midi file (of format 0 or 1)\n");
+    smf_unmapFile(&file);
+    return 1;
+  }
+
+  std::vector<MergeSmfCursor_t> cursors(header.TrackCount);
+  size_t offset = 0;
+  size_t count = 0;
+
+  while( count < cursors.size() && mergesmf_init(&cursors[count], file.Data, file.Length, &offset, true) == SmfResultOk ){
+    count++;
+  }
+
+  std::vector<MergeSource_t> sources(count);
+  std::vector<size_t> heap(count);
+
+  for(size_t i = 0; i < count; i++){
+    sources[i].Next = mergesmf_next;
+    sources[i].Cursor = &cursors[i];
+  }
+
+  Merger_t merger;
+  merger_init(&merger, sources.data(), count, heap.data(), false);
+
+  // merged deltas are no longer than the original ones, at most a status byte is added per event (of >= 2 bytes)
+  std::vector<uint8_t> buffer(2 * file.Length + SmfHeaderChunkLength + SmfChunkHeaderLength + 4);
+
+  SmfWriter_t writer;
+  smfwriter_init(&writer, buffer.data(), buffer.size(), SmfFormatSingleTrack, 1, header.Division);
+  smfwriter_beginTrack(&writer);
+
+  MergeEvent_t event;
+  uint64_t time = 0;
+  size_t events = 0;
+  bool ok = true;
+
+  while( ok && merger_next(&merger, &event) ){
+
+    uint32_t delta = event.Time - time;
+    time = event.Time;
+
+    if (event.Status == MergeStatusMeta){
+      ok = smfwriter_writeMeta(&writer, delta, event.MetaType, event.Data, event.Length);
+    } else {
+      // continuation packets (and other escaped bytes) are written as escape events
+      uint8_t status = event.Status == 0 ? (uint8_t)SystemMessageEndOfExclusive : event.Status;
+      ok = smfwriter_writeEvent(&writer, delta, status, event.Data, event.Length);
+    }
+
+    events++;
+  }
+
+  ok = ok && smfwriter_endTrack(&writer, 0);
+
+  smf_unmapFile(&file);
+
+  if ( ! ok ){
+    printf("Failed to write track\n");
+    return 1;
+  }
+
+  FILE * out = fopen(argv[2], "wb");
+
+  if (out == NULL || fwrite(buffer.data(), 1, writer.Length, out) != writer.Length){
+    printf("Failed to write %s\n", argv[2]);
+    return 1;
+  }
+
+  fclose(out);
+
+  fprintf(stderr, "%zu tracks, %zu events, %zu bytes\n", count, events, writer.Length);
+
+  return 0;
+}
@@ -0,0 +1,288 @@
+#include <midimessage/smf.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <strings.h>
+#include <string>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include <dirent.h>
+#include <getopt.h>
+#include <sys/stat.h>
+
+using namespace MidiMessage;
+
+/**
+ * Scans directory trees of standard midi files in parallel and prints note, controller and sysex id statistics.
+ *
+ * Directories and files are tasks on a work-stealing pool: each worker takes tasks from the back of its own deque
+ * (pushing any entries of a directory it lists there) and steals from the front of the others' when it runs out.
+ * Idle workers block until further tasks are queued or all tasks are completed.
+ * Statistics are per worker and only merged at the end.
+ */
+
+typedef struct {
+  std::string path;
+  bool directory;
+} Task_t;
+
+typedef struct {
+  std::mutex mutex;
+  std::deque<Task_t> tasks;
+  SmfStatistics_t stats;
+} Worker_t;
+
+std::vector<std::unique_ptr<Worker_t>> workers;
+
+// tasks pushed but not yet completed
+std::atomic<size_t> pending(0);
+
+// tasks pushed but not yet taken, guarded by idleMutex (which is locked while holding the respective worker's mutex,
+// thus queued never lags behind the task queues)
+size_t queued = 0;
+std::mutex idleMutex;
+std::condition_variable idle;
+
+bool allFiles = false;
+
+bool isSmfPath( const char * path ){
+  const char * ext = strrchr(path, '.');
+
+  if (ext == NULL){
+    return false;
+  }
+
+  return strcasecmp(ext, ".mid") == 0 || strcasecmp(ext, ".midi") == 0 || strcasecmp(ext, ".smf") == 0 || strcasecmp(ext, ".kar") == 0;
+}
+
+void push( Worker_t * worker, std::string path, bool directory ){
+  pending++;
+
+  {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    worker->tasks.push_back({path, directory});
+
+    std::lock_guard<std::mutex> idleLock(idleMutex);
+    queued++;
+  }
+  idle.notify_one();
+}
+
+bool pop( Worker_t * worker, Task_t * task ){
+  std::lock_guard<std::mutex> lock(worker->mutex);
+
+  if (worker->tasks.empty()){
+    return false;
+  }
+
+  *task = std::move(worker->tasks.back());
+  worker->tasks.pop_back();
+
+  std::lock_guard<std::mutex> idleLock(idleMutex);
+  queued--;
+
+  return true;
+}
+
+bool steal( size_t self, Task_t * task ){
+  for(size_t i = 1; i < workers.size(); i++){
+    Worker_t * victim = workers[(self + i) % workers.size()].get();
+
+    std::lock_guard<std::mutex> lock(victim->mutex);
+
+    if ( ! victim->tasks.empty() ){
+      *task = std::move(victim->tasks.front());
+      victim->tasks.pop_front();
+
+      std::lock_guard<std::mutex> idleLock(idleMutex);
+      queued--;
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void scanFile( Worker_t * worker, const char * path ){
+  SmfFile_t file;
+
+  if ( ! smf_mapFile(path, &file) ){
+    worker->stats.Files++;
+    worker->stats.InvalidFiles++;
+    return;
+  }
+
+  smf_scan(file.Data, file.Length, &worker->stats);
+
+  smf_unmapFile(&file);
+}
+
+void scanDirectory( Worker_t * worker, const std::string & path ){
+  DIR * dir = opendir(path.c_str());
+
+  if (dir == NULL){
+    return;
+  }
+
+  struct dirent * entry;
+
+  while( (entry = readdir(dir)) != NULL ){
+
+    if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0){
+      continue;
+    }
+
+    std::string child = path + "/" + entry->d_name;
+
+    bool directory = entry->d_type == DT_DIR;
+    bool regular = entry->d_type == DT_REG;
+
+    // symbolic links are not followed
+    if (entry->d_type == DT_UNKNOWN){
+      struct stat st;
+      if (lstat(child.c_str(), &st) == 0){
+        directory = S_ISDIR(st.st_mode);
+        regular = S_ISREG(st.st_mode);
+      }
+    }
+
+    if (directory || (regular && (allFiles || isSmfPath(entry->d_name)))){
+      push(worker, child, directory);
+    }
+  }
+
+  closedir(dir);
+}
+
+void work( size_t self ){
+  Worker_t * worker = workers[self].get();
+  Task_t task;
+
+  while(true){
+
+    if (pop(worker, &task) || steal(self, &task)){
+
+      if (task.directory){
+        scanDirectory(worker, task.path);
+      } else {
+        scanFile(worker, task.path.c_str());
+      }
+
+      // wake all idle workers to terminate once the last task is completed
+      if (--pending == 0){
+        std::lock_guard<std::mutex> lock(idleMutex);
+        idle.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(idleMutex);
+    idle.wait(lock, []{ return queued > 0 || pending == 0; });
+
+    if (pending == 0){
+      return;
+    }
+  }
+}
+
+int main(int argc, char * argv[]){
+
+  size_t threads = std::thread::hardware_concurrency();
+  int c;
+
+  while( (c = getopt(argc, argv, "j:ah")) != -1 ){
+    switch(c){
+      case 'j':
+        threads = strtoul(optarg, NULL, 10);
+        break;
+      case 'a':
+        allFiles = true;
+        break;
+      default:
+        printf("Usage: %s [-j <threads>] [-a] <dir|file> ..\n", argv[0]);
+        printf("\t -j <threads> \t number of threads (default: number of cores)\n");
+        printf("\t -a \t\t scan all files (default: *.mid, *.midi, *.smf, *.kar only)\n");
+        return 1;
+    }
+  }
+
+  if (optind >= argc){
+    printf("Usage: %s [-j <threads>] [-a] <dir|file> ..\n", argv[0]);
+    return 1;
+  }
+
+  if (threads == 0){
+    threads = 1;
+  }
+
+  for(size_t i = 0; i < threads; i++){
+    workers.emplace_back(new Worker_t());
+    smfstatistics_reset(&workers[i]->stats);
+  }
+
+  // distribute the given paths, any further work is stolen
+  for(int i = optind; i < argc; i++){
+    struct stat st;
+    if (stat(argv[i], &st) == 0){
+      push(workers[(i - optind) % threads].get(), argv[i], S_ISDIR(st.st_mode));
+    }
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> pool;
+  for(size_t i = 0; i < threads; i++){
+    pool.emplace_back(work, i);
+  }
+  for(size_t i = 0; i < threads; i++){
+    pool[i].join();
+  }
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::unique_ptr<SmfStatistics_t> total(new SmfStatistics_t);
+  smfstatistics_reset(total.get());
+
+  for(size_t i = 0; i < threads; i++){
+    smfstatistics_merge(total.get(), &workers[i]->stats);
+  }
+
+  printf("files %llu invalid %llu tracks %llu events %llu meta %llu sysex %llu\n",
+         (unsigned long long)total->Files, (unsigned long long)total->InvalidFiles, (unsigned long long)total->Tracks,
+         (unsigned long long)total->Events, (unsigned long long)total->MetaEvents, (unsigned long long)total->SysExEvents);
+
+  for(int i = 0; i < 128; i++){
+    if (total->Notes[i] > 0){
+      printf("note %d %llu\n", i, (unsigned long long)total->Notes[i]);
+    }
+  }
+  for(int i = 0; i < 128; i++){
+    if (total->Controllers[i] > 0){
+      printf("cc %d %llu\n", i, (unsigned long long)total->Controllers[i]);
+    }
+  }
+  for(int i = 0; i < 128; i++){
+    if (total->SysExIds[i] > 0){
+      printf("sysex-id %02x %llu\n", i, (unsigned long long)total->SysExIds[i]);
+    }
+  }
+  for(int i = 0; i < (1 << 14); i++){
+    if (total->SysExExtendedIds[i] > 0){
+      printf("sysex-id 00%02x%02x %llu\n", i >> 7, i & 0x7F, (unsigned long long)total->SysExExtendedIds[i]);
+    }
+  }
+
+  fprintf(stderr, "%llu files in %.3f s (%.0f files/s, %zu threads)\n", (unsigned long long)total->Files, seconds,
+          seconds > 0 ? total->Files / seconds : 0, threads);
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_BASICPARSER_H
+#define MIDIMESSAGE_BASICPARSER_H
+
+#include "midimessage/parser.h"
+#include "midimessage/packers.h"
+
+#include <string.h>
+
+#ifdef __cplusplus
+namespace MidiMessage {
+
+    /**
+     * Default discarding data handler of BasicParser, ignores any discarded data.
+     */
+    struct BasicParserIgnoreDiscarded {
+        inline void operator()(uint8_t *, size_t){}
+    };
+
+    /**
+     * Header-only (C++) variant of Parser_t (see parser_receivedData()).
+     *
+     * Handlers are given as functors (template parameters) instead of function pointers such that the compiler can
+     * inline the per-message handling:
+     *
+     *  - Handler must provide `void operator()(Message_t * message)`
+     *  - DiscardingDataHandler must provide `void operator()(uint8_t * bytes, size_t length)`
+     *
+     * NOTE: this is a deliberately minimal fork of the state machine of parser_receivedData() (running status,
+     * interleaved real time messages, SysEx termination and bulk copying of SysEx data), without SysEx streaming,
+     * views, compact messages or batching. It must emit the same message and discard sequence, ie changes to the
+     * state machine of parser.cpp have to be applied here as well.
+     */
+    template<class Handler, class DiscardingDataHandler = BasicParserIgnoreDiscarded>
+    class BasicParser {
+
+    public:
+
+        bool RunningStatusEnabled;
+
+        uint8_t *Buffer;
+        size_t MaxLength;
+
+        Message_t *Message;
+
+        Handler MessageHandler;
+
+        DiscardingDataHandler DiscardHandler;
+
+        size_t Length;
+
+        BasicParser(bool runningStatusEnabled, uint8_t * buffer, size_t maxLength, Message_t * msg, Handler messageHandler = Handler(), DiscardingDataHandler discardingDataHandler = DiscardingDataHandler())
+            : RunningStatusEnabled(runningStatusEnabled), Buffer(buffer), MaxLength(maxLength), Message(msg), MessageHandler(messageHandler), DiscardHandler(discardingDataHandler), Length(0) {
+        }
+
+        inline void reset(){
+            Length = 0;
+            Buffer[0] = 0;
+        }
+
+        /**
+         * @param data      incoming data buffer
+         * @param len       length of incoming data
+         */
+        inline void receivedData(uint8_t * data, size_t len){
+
+            for (size_t i = 0; i < len; i++){
+
+                // consume real time messages straight away (may be interleaved in other messages)
+                if (isSystemRealTimeMessage(data[i])){
+                    if (unpackSystemMessageObj(&data[i], 1, Message)){
+                        MessageHandler( Message );
+                    }
+                    continue;
+                }
+
+                // data bytes can only complete universal sysexes of specific lengths, so bulk copy whole runs of data
+                // bytes (but never fill the buffer completely, overflows are handled below)
+                if (Length > 1 && Buffer[0] == SystemMessageSystemExclusive && isDataByte(data[i])){
+
+                    size_t run = findControlByte( &data[i], len - i );
+
+                    if (run > MaxLength - 1 - Length){
+                        run = MaxLength - 1 - Length;
+                    }
+
+                    size_t limit = parser_sysExDataRun( Buffer, Length );
+                    if (run > limit){
+                        run = limit;
+                    }
+
+                    if (run > 0){
+                        memcpy( &Buffer[Length], &data[i], run );
+                        Length += run;
+                        i += run - 1;
+                        continue;
+                    }
+                }
+
+                // discard any initial data bytes unless running status is enabled
+                if (Length == 0 && isDataByte(data[i])){
+
+                    if (RunningStatusEnabled && isRunningStatus(Buffer[0])){
+                        Length++;
+                    } else {
+                        DiscardHandler( &data[i], 1 );
+
+                        // wait for control byte
+                        continue;
+                    }
+                }
+
+                // if a control byte comes after the first byte, everything before must have been a command
+                if (Length > 1 && isControlByte(data[i]) ){
+
+                    // sysexes may end with status bytes other than EOX
+                    if (Buffer[0] == SystemMessageSystemExclusive){
+
+                        Buffer[ Length++ ] = SystemMessageEndOfExclusive;
+
+                        if (unpack(Buffer, Length, Message)){
+                            MessageHandler( Message );
+                        }
+
+                        // if was in fact an EOX, skip parser byte
+                        if (data[i] == SystemMessageEndOfExclusive){
+                            Length = 0;
+                            continue;
+                        }
+                    }
+
+                    DiscardHandler( Buffer, Length );
+
+                    // discard previous data
+                    Length = 0;
+                }
+
+                Buffer[ Length++ ] = data[i];
+
+                // try to parse data as soon as the message might be complete
+                if (parser_isCompletable(Buffer, Length, data[i]) && unpack(Buffer, Length, Message)){
+                    MessageHandler( Message );
+
+                    Length = 0;
+                }
+
+                // in case the buffer would overflow next time, discard current contents
+                if ( Length >= MaxLength ){
+
+                    DiscardHandler( Buffer, Length );
+
+                    Length = 0;
+                }
+            }
+        }
+    };
+
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_BASICPARSER_H
@@ -0,0 +1,179 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_BUILDERS_H
+#define MIDIMESSAGE_BUILDERS_H
+
+#include "midimessage/midimessage.h"
+
+#ifdef __cplusplus
+
+#include <array>
+
+namespace MidiMessage {
+
+    /**
+     * Compile-time (C++) counterparts of the packers: make<T>(..) returns the message as std::array of fixed size,
+     * thus constant messages can be built at compile time, eg
+     *
+     *      constexpr std::array<uint8_t,3> noteOn = make<NoteOn>(0, 60, 100);
+     *      constexpr std::array<uint8_t,6> gmOn = make<GeneralMidi>(SysExDeviceIdBroadcast, SysExNonRtGmSystemOn1);
+     *
+     * Invalid constant arguments fail compilation (instead of the packers' runtime ASSERTs), with non-constant
+     * arguments invalid values are ASSERTed at runtime.
+     */
+    namespace Builders {
+
+        // not constexpr, thus reaching it during constant evaluation is a compile error
+        inline void invalidArgument(){
+            ASSERT( false );
+        }
+
+        constexpr uint8_t check( bool valid, unsigned value ){
+            return valid ? (uint8_t)value : (invalidArgument(), (uint8_t)value);
+        }
+
+        constexpr uint8_t channel( unsigned value ){
+            return check( value <= ChannelMask, value );
+        }
+
+        constexpr uint8_t u7( unsigned value ){
+            return check( value <= MaxU7, value );
+        }
+
+        constexpr uint8_t u14Lsb( unsigned value ){
+            return check( value <= MaxU14, value & DataMask );
+        }
+
+        constexpr uint8_t u14Msb( unsigned value ){
+            return check( value <= MaxU14, (value >> 7) & DataMask );
+        }
+
+        template<uint8_t StatusClass>
+        struct ChannelMessage3 {
+            static constexpr std::array<uint8_t,3> build( unsigned channel, unsigned data1, unsigned data2 ){
+                return {{ (uint8_t)(StatusClass | Builders::channel(channel)), u7(data1), u7(data2) }};
+            }
+        };
+
+        template<uint8_t StatusClass>
+        struct ChannelMessage2 {
+            static constexpr std::array<uint8_t,2> build( unsigned channel, unsigned data1 ){
+                return {{ (uint8_t)(StatusClass | Builders::channel(channel)), u7(data1) }};
+            }
+        };
+    }
+
+    /**
+     * Builds message of type T with the arguments of the respective packer (without destination buffer).
+     */
+    template<class T, class... Args>
+    constexpr auto make( Args... args ) -> decltype(T::build(args...)) {
+        return T::build(args...);
+    }
+
+    // make<NoteOff>(channel, key, velocity)
+    struct NoteOff : Builders::ChannelMessage3<StatusClassNoteOff> {};
+
+    // make<NoteOn>(channel, key, velocity)
+    struct NoteOn : Builders::ChannelMessage3<StatusClassNoteOn> {};
+
+    // make<PolyphonicKeyPressure>(channel, key, pressure)
+    struct PolyphonicKeyPressure : Builders::ChannelMessage3<StatusClassPolyphonicKeyPressure> {};
+
+    // make<ControlChange>(channel, controller, value)
+    struct ControlChange : Builders::ChannelMessage3<StatusClassControlChange> {};
+
+    // make<ProgramChange>(channel, program)
+    struct ProgramChange : Builders::ChannelMessage2<StatusClassProgramChange> {};
+
+    // make<ChannelPressure>(channel, pressure)
+    struct ChannelPressure : Builders::ChannelMessage2<StatusClassChannelPressure> {};
+
+    // make<PitchBendChange>(channel, pitch)
+    struct PitchBendChange {
+        static constexpr std::array<uint8_t,MsgLenPitchBendChange> build( unsigned channel, unsigned pitch ){
+            return {{ (uint8_t)(StatusClassPitchBendChange | Builders::channel(channel)), Builders::u14Lsb(pitch), Builders::u14Msb(pitch) }};
+        }
+    };
+
+    // make<MtcQuarterFrame>(messageType, nibble)
+    struct MtcQuarterFrame {
+        static constexpr std::array<uint8_t,MsgLenMtcQuarterFrame> build( unsigned messageType, unsigned nibble ){
+            return {{ SystemMessageMtcQuarterFrame, (uint8_t)((Builders::check(messageType <= 0x07, messageType) << 4) | Builders::check(nibble <= NibbleMask, nibble)) }};
+        }
+    };
+
+    // make<SongPositionPointer>(position)
+    struct SongPositionPointer {
+        static constexpr std::array<uint8_t,MsgLenSongPositionPointer> build( unsigned position ){
+            return {{ SystemMessageSongPositionPointer, Builders::u14Lsb(position), Builders::u14Msb(position) }};
+        }
+    };
+
+    // make<SongSelect>(song)
+    struct SongSelect {
+        static constexpr std::array<uint8_t,MsgLenSongSelect> build( unsigned song ){
+            return {{ SystemMessageSongSelect, Builders::u7(song) }};
+        }
+    };
+
+    // make<SystemMessage>(systemMessage), ie tune request or any system real time message
+    struct SystemMessage {
+        static constexpr std::array<uint8_t,MsgLenSystemMessage> build( unsigned systemMessage ){
+            return {{ Builders::check(systemMessage == SystemMessageTuneRequest || (systemMessage >= SystemMessageTimingClock && systemMessage <= SystemMessageReset && systemMessage != 0xF9 && systemMessage != 0xFD), systemMessage) }};
+        }
+    };
+
+    // make<MtcFullMessage>(deviceId, fps, hour, minute, second, frame)
+    struct MtcFullMessage {
+        static constexpr std::array<uint8_t,MsgLenSysExRtMtcFullMessage> build( unsigned deviceId, unsigned fps, unsigned hour, unsigned minute, unsigned second, unsigned frame ){
+            return {{
+                SystemMessageSystemExclusive,
+                SysExIdRealTime_Byte,
+                Builders::u7(deviceId),
+                SysExRtMidiTimeCode,
+                SysExRtMtcFullMessage,
+                (uint8_t)((Builders::check(fps <= MtcFrameRate30fps, fps) << MtcFpsOffset) | Builders::check(hour <= MtcMaxHour, hour)),
+                Builders::check(minute <= MtcMaxMinute, minute),
+                Builders::check(second <= MtcMaxSecond, second),
+                Builders::check(fps <= MtcFrameRate30fps && frame <= MtcMaxFps[fps], frame),
+                SystemMessageEndOfExclusive
+            }};
+        }
+    };
+
+    // make<GeneralMidi>(deviceId, subId2), ie GM system on/off
+    struct GeneralMidi {
+        static constexpr std::array<uint8_t,MsgLenSysExNonRtGeneralMidi> build( unsigned deviceId, unsigned subId2 ){
+            return {{
+                SystemMessageSystemExclusive,
+                SysExIdNonRealTime_Byte,
+                Builders::u7(deviceId),
+                SysExNonRtGeneralMidi,
+                Builders::check(subId2 == SysExNonRtGmSystemOn1 || subId2 == SysExNonRtGmSystemOff || subId2 == SysExNonRtGmSystemOn2, subId2),
+                SystemMessageEndOfExclusive
+            }};
+        }
+    };
+
+    // make<MmcCommand>(deviceId, command) for (single) MMC commands without data, eg stop, play, pause etc
+    struct MmcCommand {
+        static constexpr std::array<uint8_t,6> build( unsigned deviceId, unsigned command ){
+            return {{
+                SystemMessageSystemExclusive,
+                SysExIdRealTime_Byte,
+                Builders::u7(deviceId),
+                SysExRtMidiMachineControlCommand,
+                Builders::check((command >= SysExRtMmcCommandStop && command <= SysExRtMmcCommandMmcReset) || command == SysExRtMmcCommandWait || command == SysExRtMmcCommandResume, command),
+                SystemMessageEndOfExclusive
+            }};
+        }
+    };
+
+} // namespace MidiMessage
+
+#endif // __cplusplus
+
+#endif //MIDIMESSAGE_BUILDERS_H
@@ -0,0 +1,302 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_CAPTURE_H
+#define MIDIMESSAGE_CAPTURE_H
+
+#include "midimessage/midimessage.h"
+#include "midimessage/eventlist.h"
+#include "midimessage/commonccs.h"
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    /**
+     * Compact binary capture format for (timed) recordings of MIDI streams.
+     *
+     * Format: CaptureHeader followed by records, each given as <delta time in ns (varint)> and
+     *
+     *  - a message: status byte (omitted if running status applies), data bytes as given by status, SysEx messages
+     *    as F0 <length of remaining bytes (varint)> <remaining bytes (including EOX)>
+     *  - a sync point: CaptureSyncMarker <absolute time in ns (varint)> <running status> <channel mask (varint)> and for
+     *    each channel in the mask its parameter state <type> <NRPN MSB> <NRPN LSB> <RPN MSB> <RPN LSB> (see
+     *    CaptureParameter_t), such that reading may start at any sync point
+     *  - the end of the records: CaptureEndMarker
+     *
+     * The end marker is followed by the index, ie an entry (absolute time and offset, 8 bytes each, little endian) per
+     * sync point, and the trailer: index offset (8 bytes, little endian) and CaptureTrailer.
+     *
+     * (The markers are undefined MIDI status bytes and can not occur within messages.)
+     */
+    const uint8_t CaptureHeader[] = {'M', 'M', 'C', 'P', 0x01};
+    const uint8_t CaptureHeaderLength = sizeof(CaptureHeader);
+
+    const uint8_t CaptureSyncMarker = 0xF5;
+    const uint8_t CaptureEndMarker = 0xF4;
+
+    const uint8_t CaptureTrailer[] = {'M', 'M', 'C', 'I'};
+    const uint8_t CaptureTrailerLength = 8 + sizeof(CaptureTrailer);
+
+    const uint8_t CaptureIndexEntryLength = 16;
+
+    const uint8_t CaptureParameterLength = 5;
+
+    // maximal length of a sync point record
+    const uint8_t CaptureSyncMaxLength = 2 * VarIntMaxLength + 2 + 3 + 16 * CaptureParameterLength;
+
+    typedef enum {
+        CaptureParameterTypeNone    = 0,
+        CaptureParameterTypeNrpn    = 1,
+        CaptureParameterTypeRpn     = 2
+    } CaptureParameterType_t;
+
+    // value of parameter numbers not (yet) selected, ie the RPN null function
+    const uint8_t CaptureParameterNull = 0x7F;
+
+    /**
+     * (N)RPN parameter selected on a channel, ie the state required to interpret any following data entry,
+     * increment or decrement controllers.
+     */
+    typedef struct {
+        uint8_t Type; // CaptureParameterType_t of the last selection
+        uint8_t Nrpn[2]; // MSB, LSB
+        uint8_t Rpn[2]; // MSB, LSB
+    } CaptureParameter_t;
+
+    typedef struct {
+        uint64_t Time;
+        uint64_t Offset;
+    } CaptureIndexEntry_t;
+
+    typedef struct {
+
+        // absolute time (ns) and offset of next record
+        uint64_t Time;
+        uint64_t Offset;
+
+        uint8_t RunningStatus;
+
+        CaptureParameter_t Parameters[16];
+
+        // a sync point is written before the next message if either interval is exceeded
+        uint64_t SyncIntervalNs;
+        uint32_t SyncIntervalEvents;
+
+        uint64_t LastSyncTime;
+        uint32_t EventsSinceSync;
+
+        // called for each written sync point (optional), eg to collect the index
+        void (*SyncHandler)(CaptureIndexEntry_t * entry, void * context);
+        void * Context;
+
+    } CaptureWriter_t;
+
+    typedef struct {
+
+        // absolute time (ns) of last record
+        uint64_t Time;
+
+        uint8_t RunningStatus;
+
+        CaptureParameter_t Parameters[16];
+
+        bool Ended;
+
+    } CaptureReader_t;
+
+    inline void capture_resetParameters( CaptureParameter_t * parameters ){
+        for(uint8_t i = 0; i < 16; i++){
+            parameters[i].Type = CaptureParameterTypeNone;
+            parameters[i].Nrpn[0] = CaptureParameterNull;
+            parameters[i].Nrpn[1] = CaptureParameterNull;
+            parameters[i].Rpn[0] = CaptureParameterNull;
+            parameters[i].Rpn[1] = CaptureParameterNull;
+        }
+    }
+
+    inline bool capture_isParameterSet( CaptureParameter_t * parameter ){
+        return parameter->Type != CaptureParameterTypeNone ||
+               parameter->Nrpn[0] != CaptureParameterNull || parameter->Nrpn[1] != CaptureParameterNull ||
+               parameter->Rpn[0] != CaptureParameterNull || parameter->Rpn[1] != CaptureParameterNull;
+    }
+
+    /**
+     * Updates the parameter state with a (non-SysEx) message.
+     */
+    inline void capture_updateParameters( CaptureParameter_t * parameters, uint8_t status, uint8_t * data ){
+        if ((status & StatusClassMask) != StatusClassControlChange){
+            return;
+        }
+
+        CaptureParameter_t * parameter = &parameters[status & ChannelMask];
+
+        switch(data[0]){
+            case CcNonRegisteredParameterMSB:
+                parameter->Type = CaptureParameterTypeNrpn;
+                parameter->Nrpn[0] = data[1];
+                break;
+            case CcNonRegisteredParameterLSB:
+                parameter->Type = CaptureParameterTypeNrpn;
+                parameter->Nrpn[1] = data[1];
+                break;
+            case CcRegisteredParameterMSB:
+                parameter->Type = CaptureParameterTypeRpn;
+                parameter->Rpn[0] = data[1];
+                break;
+            case CcRegisteredParameterLSB:
+                parameter->Type = CaptureParameterTypeRpn;
+                parameter->Rpn[1] = data[1];
+                break;
+        }
+    }
+
+    /**
+     * Packs the control changes selecting the current parameter of a channel (eg to restore the state of a receiver
+     * when starting playback at a sync point).
+     *
+     * @param   bytes   destination (two messages, ie 6 bytes)
+     * @return          number of bytes written, zero if no parameter is selected
+     */
+    inline uint8_t capture_packParameterSelection( uint8_t * bytes, CaptureParameter_t * parameter, uint8_t channel ){
+        ASSERT( bytes != NULL );
+        ASSERT( parameter != NULL );
+
+        if (parameter->Type == CaptureParameterTypeNone){
+            return 0;
+        }
+
+        bool nrpn = parameter->Type == CaptureParameterTypeNrpn;
+        uint8_t * values = nrpn ? parameter->Nrpn : parameter->Rpn;
+
+        bytes[0] = StatusClassControlChange | (channel & ChannelMask);
+        bytes[1] = nrpn ? CcNonRegisteredParameterMSB : CcRegisteredParameterMSB;
+        bytes[2] = values[0];
+        bytes[3] = bytes[0];
+        bytes[4] = nrpn ? CcNonRegisteredParameterLSB : CcRegisteredParameterLSB;
+        bytes[5] = values[1];
+
+        return 6;
+    }
+
+    /**
+     * Initializes writer with default sync intervals (1 second or 1024 messages).
+     *
+     * @param   dst     destination of the header (CaptureHeaderLength bytes)
+     * @return          number of bytes written
+     */
+    size_t capturewriter_init( CaptureWriter_t * writer, uint8_t * dst, void (*syncHandler)(CaptureIndexEntry_t * entry, void * context), void * context );
+
+    /**
+     * Writes a message (preceded by a sync point if due).
+     *
+     * @param   dst     destination (at least CaptureSyncMaxLength + VarIntMaxLength + 2 * length bytes)
+     * @param   time    absolute time (ns) of message, not before time of previous message
+     * @param   bytes   packed message
+     * @param   length  length of message
+     * @return          number of bytes written
+     */
+    size_t capturewriter_writeMessage( CaptureWriter_t * writer, uint8_t * dst, uint64_t time, uint8_t * bytes, size_t length );
+
+    /**
+     * Writes the end marker, the index and the trailer.
+     *
+     * @param   dst     destination (at least VarIntMaxLength + 1 + indexLength * CaptureIndexEntryLength + CaptureTrailerLength bytes)
+     * @param   index   index entries (as passed to the sync handler)
+     * @return          number of bytes written
+     */
+    size_t capturewriter_finish( CaptureWriter_t * writer, uint8_t * dst, CaptureIndexEntry_t * index, size_t indexLength );
+
+    inline void capturereader_init( CaptureReader_t * reader ){
+        reader->Time = 0;
+        reader->RunningStatus = MidiMessage_RunningStatusNotSet;
+        capture_resetParameters( reader->Parameters );
+        reader->Ended = false;
+    }
+
+    /**
+     * Reads the next record. Sync points (and the end marker) are consumed but yield no message (zero length).
+     *
+     * @param   src         source bytes (beginning of record)
+     * @param   len         available bytes
+     * @param   time        absolute time (ns) of message
+     * @param   bytes       destination of message (complete message, ie including any running status), NULL to skip
+     * @param   maxLength   size of destination (or maximal accepted message length)
+     * @param   length      length of message (zero for non-message records)
+     * @return              number of bytes consumed, zero if record is incomplete or invalid (see capturereader_isInvalid())
+     */
+    size_t capturereader_read( CaptureReader_t * reader, uint8_t * src, size_t len, uint64_t * time, uint8_t * bytes, size_t maxLength, size_t * length );
+
+    /**
+     * Tells wether the given (sufficient) bytes could not be read because they are invalid (as opposed to incomplete).
+     */
+    bool capturereader_isInvalid( CaptureReader_t * reader, uint8_t * src, size_t len, size_t maxLength );
+
+    inline void capture_packU64( uint8_t * bytes, uint64_t value ){
+        for(uint8_t i = 0; i < 8; i++){
+            bytes[i] = (value >> (8*i)) & 0xFF;
+        }
+    }
+
+    inline uint64_t capture_unpackU64( uint8_t * bytes ){
+        uint64_t value = 0;
+        for(uint8_t i = 0; i < 8; i++){
+            value |= ((uint64_t)bytes[i]) << (8*i);
+        }
+        return value;
+    }
+
+    /**
+     * @param   bytes       last CaptureTrailerLength bytes of capture
+     * @param   offset      offset of index
+     * @return              true iff trailer is valid
+     */
+    inline bool capture_unpackTrailer( uint8_t * bytes, uint64_t * offset ){
+        for(uint8_t i = 0; i < sizeof(CaptureTrailer); i++){
+            if (bytes[8 + i] != CaptureTrailer[i]){
+                return false;
+            }
+        }
+        *offset = capture_unpackU64( bytes );
+        return true;
+    }
+
+    inline void capture_unpackIndexEntry( uint8_t * bytes, CaptureIndexEntry_t * entry ){
+        entry->Time = capture_unpackU64( bytes );
+        entry->Offset = capture_unpackU64( &bytes[8] );
+    }
+
+    /**
+     * Binary search of the last index entry (ie sync point) at or before the given time.
+     *
+     * @param   index   index entries (packed)
+     * @param   count   number of entries
+     * @param   time    absolute time (ns)
+     * @param   entry   found entry
+     * @return          true iff an entry was found (otherwise time precedes the first sync point)
+     */
+    bool capture_findIndexEntry( uint8_t * index, size_t count, uint64_t time, CaptureIndexEntry_t * entry );
+
+    /**
+     * Seeks the first message at or after the given time in a complete capture (eg a memory mapped file), ie looks up
+     * the preceding sync point in the index and scans forward from there.
+     *
+     * The reader is set up to continue reading at the returned offset, in particular its running status and parameter
+     * state are as if the capture had been read from the beginning.
+     *
+     * @param   reader      reader to set up
+     * @param   capture     complete capture (including header, index and trailer)
+     * @param   length      length of capture
+     * @param   time        absolute time (ns)
+     * @return              offset of the found message (or of the end marker if there is none), zero if invalid
+     */
+    size_t capture_seek( CaptureReader_t * reader, uint8_t * capture, size_t length, uint64_t time );
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_CAPTURE_H
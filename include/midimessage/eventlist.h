@@ -0,0 +1,123 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_EVENTLIST_H
+#define MIDIMESSAGE_EVENTLIST_H
+
+#include "midimessage/midimessage.h"
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    /**
+     * Compact binary list of timed events, eg compiled from a (timed) generator script such that it can be played
+     * back repeatedly without any text parsing.
+     *
+     * Format: EventListHeader followed by any number of events, each given as
+     *
+     *      <delta time in ns (varint)> <length (varint)> <packed message bytes>
+     *
+     * where the delta time is relative to the previous event (or the start of playback).
+     */
+    const uint8_t EventListHeader[] = {'M', 'M', 'E', 'L', 0x01};
+    const uint8_t EventListHeaderLength = sizeof(EventListHeader);
+
+    // maximal length of an encoded varint (64 bit value)
+    const uint8_t VarIntMaxLength = 10;
+
+    /**
+     * Packs an unsigned integer as variable length integer (LEB128, ie 7 bits per byte, least significant group first,
+     * MSB set on all but the last byte).
+     *
+     * @param   bytes   destination (at least VarIntMaxLength bytes)
+     * @return          number of bytes written
+     */
+    inline uint8_t packVarInt( uint8_t * bytes, uint64_t value ){
+        ASSERT( bytes != NULL );
+
+        uint8_t len = 0;
+
+        while (value > MaxU7){
+            bytes[len++] = (value & DataMask) | 0x80;
+            value >>= 7;
+        }
+        bytes[len++] = value;
+
+        return len;
+    }
+
+    /**
+     * @param   bytes   source bytes
+     * @param   length  available bytes
+     * @param   value   decoded value
+     * @return          number of bytes consumed, zero if incomplete or invalid
+     */
+    inline uint8_t unpackVarInt( uint8_t * bytes, size_t length, uint64_t * value ){
+        ASSERT( bytes != NULL );
+        ASSERT( value != NULL );
+
+        uint64_t v = 0;
+
+        for(uint8_t i = 0; i < length && i < VarIntMaxLength; i++){
+            v |= ((uint64_t)(bytes[i] & DataMask)) << (7*i);
+
+            if ((bytes[i] & 0x80) == 0){
+                *value = v;
+                return i + 1;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * @param   dst     destination (at least 2 * VarIntMaxLength + length bytes)
+     * @param   delta   delta time in ns
+     * @param   bytes   packed message
+     * @param   length  length of message
+     * @return          number of bytes written
+     */
+    size_t eventlist_packEvent( uint8_t * dst, uint64_t delta, uint8_t * bytes, size_t length );
+
+    /**
+     * Zero-copy unpacking of the next event, ie bytes points into src.
+     *
+     * @param   src     source bytes
+     * @param   len     available bytes
+     * @param   delta   delta time in ns
+     * @param   bytes   packed message
+     * @param   length  length of message
+     * @return          number of bytes consumed, zero if event is incomplete
+     */
+    size_t eventlist_unpackEvent( uint8_t * src, size_t len, uint64_t * delta, uint8_t ** bytes, size_t * length );
+
+    /**
+     * Compiles a single script line "[<delay>] <cmd ..>" (as accepted by MessagefromString() or
+     * "[<delay>] nrpn <channel> <controller> (<value>|inc [<value>]|dec [<value>])") into event(s).
+     *
+     * The delay of a line is added to the pending delta which is consumed (ie reset to zero) by the first event
+     * written, such that the delay of lines that fail to compile or have no command is carried on to the next event.
+     * An nrpn line compiles into one event per control change (3 or 4), all but the first with a zero delta.
+     *
+     * !! WARNING the passed line buffer is modified by the function WARNING !!
+     *
+     * @param   dst         destination (at least 2 * VarIntMaxLength + maximal message length bytes)
+     * @param   dstLength   number of bytes written (zero for empty lines)
+     * @param   line        script line
+     * @param   lineLength  length of line
+     * @param   unitNs      unit of delay in ns (eg 1000 for microseconds), zero if line has no delay
+     * @param   delta       pending delta time in ns (initially zero)
+     * @param   msg         message to use (SysEx.ByteData must point to a sufficiently large buffer)
+     * @return              StringifierResult_t
+     */
+    int eventlist_compileLine( uint8_t * dst, size_t * dstLength, uint8_t * line, uint8_t lineLength, uint64_t unitNs, uint64_t * delta, Message_t * msg );
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_EVENTLIST_H
@@ -0,0 +1,171 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_MERGE_H
+#define MIDIMESSAGE_MERGE_H
+
+#include "midimessage/midimessage.h"
+#include "midimessage/smf.h"
+#include "midimessage/capture.h"
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    /**
+     * Streaming k-way merge of timed event sources (eg the tracks of a SMF or several captures) into one time-ordered
+     * stream, using a min-heap over the next event of each source (ie memory is O(sources), not O(events)).
+     *
+     * Events are zero-copy, ie a status byte and a pointer to the following (data) bytes within the source. Sources
+     * must share their time unit (eg ticks or ns).
+     */
+
+    const uint8_t MergeStatusMeta = 0xFF;
+
+    typedef struct {
+        uint64_t Time; // absolute time
+
+        // status byte, SystemMessageSystemExclusive for SysEx (packets), MergeStatusMeta for meta events (SMF only) or
+        // zero for SysEx continuation packets (and other escaped bytes)
+        uint8_t Status;
+        uint8_t MetaType; // meta events only
+
+        uint8_t * Data; // bytes following the status byte
+        size_t Length;
+
+        bool Continues; // SysEx continues with the next event of the same source
+
+        // set by the merger
+        bool OmitStatus; // status byte may be omitted (running status)
+        size_t Source; // index of source
+    } MergeEvent_t;
+
+    /**
+     * @param   cursor  source specific cursor
+     * @param   event   next event (Time, Status, MetaType, Data, Length and Continues)
+     * @return          false if there are no more events
+     */
+    typedef bool (*MergeNext_t)( void * cursor, MergeEvent_t * event );
+
+    typedef struct {
+        MergeNext_t Next;
+        void * Cursor;
+
+        MergeEvent_t Event; // next event (of source)
+    } MergeSource_t;
+
+    typedef struct {
+        MergeSource_t * Sources;
+        size_t Count;
+
+        size_t * Heap; // source indices ordered by time of next event (and index)
+        size_t HeapLength;
+
+        // the source on top of the heap has an incomplete SysEx (ie events of other sources are held back until it
+        // completes)
+        bool Locked;
+
+        // the source on top of the heap is yet to be advanced (past the last returned event)
+        bool Pending;
+
+        uint64_t Time;
+
+        bool RunningStatusEnabled;
+        uint8_t RunningStatus;
+    } Merger_t;
+
+    /**
+     * Lightweight cursor over the events of a SMF track.
+     */
+    typedef struct {
+        SmfTrack_t Track;
+        bool MetaEnabled; // pass on meta events
+        bool SysEx; // within a SysEx split into packets
+    } MergeSmfCursor_t;
+
+    /**
+     * Cursor over the records of a complete capture (eg a memory mapped file).
+     */
+    typedef struct {
+        CaptureReader_t Reader;
+        uint8_t * Data;
+        size_t Length;
+        size_t Position;
+    } MergeCaptureCursor_t;
+
+    /**
+     * Sets up the merger and reads the first event of each source.
+     *
+     * @param   sources     sources (with Next and Cursor set)
+     * @param   count       number of sources
+     * @param   heap        heap (count entries)
+     * @param   runningStatusEnabled    mark events whose status byte may be omitted
+     */
+    void merger_init( Merger_t * merger, MergeSource_t * sources, size_t count, size_t * heap, bool runningStatusEnabled );
+
+    /**
+     * Gets the next event of the merged stream (events of equal time are ordered by source index).
+     *
+     * SysEx packets of a source are kept together, any events of other sources due in the meantime follow after (with
+     * the time of the last packet, ie time never decreases).
+     *
+     * The event (data) is valid until the next call only.
+     *
+     * @return      false if there are no more events
+     */
+    bool merger_next( Merger_t * merger, MergeEvent_t * event );
+
+    /**
+     * Packs an event as (MIDI) bytes, ie status byte (unless omitted or a continuation) and data bytes.
+     *
+     * @param   bytes   destination (at least 1 + event->Length bytes)
+     * @return          number of bytes written (zero for meta events)
+     */
+    inline size_t merge_packEvent( uint8_t * bytes, MergeEvent_t * event ){
+        ASSERT( bytes != NULL );
+        ASSERT( event != NULL );
+
+        if (event->Status == MergeStatusMeta){
+            return 0;
+        }
+
+        size_t len = 0;
+
+        if (event->Status != 0 && ! event->OmitStatus){
+            bytes[len++] = event->Status;
+        }
+
+        for(size_t i = 0; i < event->Length; i++){
+            bytes[len++] = event->Data[i];
+        }
+
+        return len;
+    }
+
+    /**
+     * Sets up a cursor over the (next) track of a SMF.
+     *
+     * @param   metaEnabled     pass on meta events (except the end of track)
+     * @return                  SmfResult_t of smf_nextTrack()
+     */
+    int mergesmf_init( MergeSmfCursor_t * cursor, uint8_t * data, size_t length, size_t * offset, bool metaEnabled );
+
+    bool mergesmf_next( void * cursor, MergeEvent_t * event );
+
+    /**
+     * Sets up a cursor over a complete capture.
+     *
+     * @return      false iff data is not a capture
+     */
+    bool mergecapture_init( MergeCaptureCursor_t * cursor, uint8_t * data, size_t length );
+
+    bool mergecapture_next( void * cursor, MergeEvent_t * event );
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_MERGE_H
@@ -210,35 +210,33 @@ namespace MidiMessage {
 
 
     /**
-     * Yes, yes, these nibblizers and sevenbitizers are for small amounts of bytes only.
-     * By official specification messages should be at most 128 bytes long which is managable.
+     * Nibblizers and sevenbitizers as used by several SysEx messages (and the command line utility).
+     * Destination buffers must be large enough: 2 * length for nibblize(), length + (length + 6) / 7 for sevenbitize().
      */
 
-    inline uint8_t nibblize( uint8_t * dst, uint8_t * src, uint8_t length ){
-        ASSERT( (2 * length) > length ); // you are working with too long byte sequences (see note above)
-
-        for (uint8_t i = 0, j = 0; i < length; i++) {
+    inline size_t nibblize( uint8_t * dst, uint8_t * src, size_t length ){
+        for (size_t i = 0, j = 0; i < length; i++) {
             dst[j++] = getLsNibble( src[i] );
             dst[j++] = getMsNibble( src[i] );
         }
         return 2 * length;
     }
 
-    inline uint8_t denibblize( uint8_t * dst, uint8_t * src, uint8_t length ){
+    inline size_t denibblize( uint8_t * dst, uint8_t * src, size_t length ){
         ASSERT( length % 2 == 0 );
 
-        for (uint8_t i = 0, j = 0; i < length; j++){
+        for (size_t i = 0, j = 0; i < length; j++){
             dst[j] = src[i++] & NibbleMask;
             dst[j] |= (src[i++] & NibbleMask) << 4;
         }
         return length / 2;
     }
 
-    inline uint8_t sevenbitize( uint8_t * dst, uint8_t * src, uint8_t length ){
-        uint8_t len = 0;
+    inline size_t sevenbitize( uint8_t * dst, uint8_t * src, size_t length ){
+        size_t len = 0;
         uint8_t * msb = dst;
 
-        for(uint8_t i = 0; i < length; i += 7, msb = &msb[8]){
+        for(size_t i = 0; i < length; i += 7, msb = &msb[8]){
 
             uint8_t group = (length - i >= 7) ? 7 : length - i;
 
@@ -254,18 +252,18 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t desevenbitize( uint8_t * dst, uint8_t * src, uint8_t length ){
-        uint8_t len = 0;
+    inline size_t desevenbitize( uint8_t * dst, uint8_t * src, size_t length ){
+        size_t len = 0;
         uint8_t * msb = src;
 
-        for(uint8_t i = 0; i < length; i += 8, msb = &msb[8]){
+        for(size_t i = 0; i < length; i += 8, msb = &msb[8]){
 
             ASSERT( length - i >= 2 ); // sanity check
 
             uint8_t group = (length - i >= 8) ? 7 : (length - i - 1);
 
             for(uint8_t j = 0; j < group; j++){
-                dst[i+j] = ((src[0] << (j+1)) & 0b10000000) | src[j+1];
+                dst[len+j] = ((msb[0] << (j+1)) & 0b10000000) | msb[j+1];
             }
 
             len += group;
@@ -306,6 +304,18 @@ namespace MidiMessage {
     }
 
 
+    /**
+     * Tells wether the extensible value at <bytes> lies within the <len> available bytes.
+     */
+    inline bool isExtensibleValueWithin( uint8_t * bytes, size_t len ){
+        if (len < 1) return false;
+        if (bytes[0] != ExtensibleValueExtender) return true;
+        if (len < 2) return false;
+        if (bytes[1] != ExtensibleValueExtender) return true;
+        return len >= 3;
+    }
+
+
     inline uint8_t copyExtensibleValueBytes( uint8_t * dst, uint8_t * src, bool allowTwoByte ) {
         ASSERT(dst != NULL);
         ASSERT(src != NULL);
@@ -440,6 +450,53 @@ namespace MidiMessage {
 
     const uint8_t MsgLenSysExNonRtMtsBulkDumpRequest            = 7;
 
+    /**
+     * Message lengths of (non-SysEx) messages by status byte as indexed through getMsgLen()
+     * (zero for SysEx, EOX and undefined status bytes)
+     */
+    const uint8_t MsgLenLUT[] = {
+        3, // 0 8* note off
+        3, // 1 9* note on
+        3, // 2 A* poly key press
+        3, // 3 B* cc
+        2, // 4 C* pc
+        2, // 5 D* ch press
+        3, // 6 E* pitch bend
+        0, // 7 F0 (sysex handled separately, pretty offset :)
+
+        2, // 8 F1 Mtc qf
+        3, // 9 F2 song pos p
+        2, // 10 F3 song sel
+        0, // 11 F4 invalid
+        0, // 12 F5 invalid
+        1, // 13 F6 tune req
+        0, // 14 F7 invalid (EOX)
+        1, // 15 F8 timing clck
+        0, // 16 F9 invalid
+        1, // 17 FA start
+        1, // 18 FB continue
+        1, // 19 FC stop
+        0, // 20 FD invalid
+        1, // 21 FE active sensing
+        1, // 22 FF reset
+    };
+
+    /**
+     * Get expected message length for given status byte.
+     *
+     * @param   status  (valid) control byte
+     * @return          message length or zero if status byte is a SysEx, EOX or undefined
+     * @see MsgLenLUT
+     */
+    inline uint8_t getMsgLen( uint8_t status ){
+        if ((status & 0xF0) != 0xF0){
+            // if is not system message (0xF0)
+            return MsgLenLUT[ (status >> 4) & 0x07 ];
+        }
+        // if is system message
+        return MsgLenLUT[ (status & 0x0F) + 7 ];
+    }
+
     typedef enum {
         StatusClassNoteOff                  = 0x80,
         StatusClassNoteOn                   = 0x90,
@@ -1265,10 +1322,10 @@ namespace MidiMessage {
      */
     const uint8_t SysExNonRtSdsDataPacketComputeChecksum = 0xFF;
 
-    inline uint8_t xorChecksum( uint8_t * bytes, uint8_t length ){
+    inline uint8_t xorChecksum( uint8_t * bytes, size_t length ){
         uint8_t chk = bytes[0];
 
-        for( uint8_t i = 1; i < length; i++){
+        for( size_t i = 1; i < length; i++){
             chk ^= bytes[i];
         }
 
@@ -1980,13 +2037,13 @@ namespace MidiMessage {
         return true;
     }
 
-    inline uint8_t packMscCueNumber( uint8_t * bytes, uint8_t * number, uint8_t * list, uint8_t * path ){
+    inline size_t packMscCueNumber( uint8_t * bytes, uint8_t * number, uint8_t * list, uint8_t * path ){
         ASSERT( bytes != NULL );
         ASSERT( isValidMscCueNumberPart(number) && number != NULL && isMscCueNumberChar(number[0]) );
         ASSERT( isValidMscCueNumberPart(list) );
         ASSERT( isValidMscCueNumberPart(path) );
 
-        int len = 0;
+        size_t len = 0;
 
         for(uint8_t i = 0; number[i] != '\0'; i++){
             bytes[len++] = number[i];
@@ -2015,7 +2072,7 @@ namespace MidiMessage {
         return len;
     }
 
-    inline bool unpackMscCueNumber( uint8_t * bytes, uint8_t len, uint8_t ** number, uint8_t ** list, uint8_t ** path ){
+    inline bool unpackMscCueNumber( uint8_t * bytes, size_t len, uint8_t ** number, uint8_t ** list, uint8_t ** path ){
         ASSERT( bytes != NULL );
         ASSERT( number != NULL );
         ASSERT( list != NULL );
@@ -2025,7 +2082,7 @@ namespace MidiMessage {
             return false;
         }
 
-        uint8_t l = 0;
+        size_t l = 0;
 
         *number = bytes;
 
@@ -2356,7 +2413,7 @@ namespace MidiMessage {
         return 1;
     }
 
-    inline uint8_t * getSysExRtMmcCommandNext( uint8_t * current, uint8_t * length ){
+    inline uint8_t * getSysExRtMmcCommandNext( uint8_t * current, size_t * length ){
         ASSERT( current != NULL );
 
         uint8_t len = getSysExRtMmcCommandLength( current );
@@ -2394,7 +2451,7 @@ namespace MidiMessage {
         return 1;
     }
 
-    inline uint8_t * getSysExRtMmcResponseNext( uint8_t * current, uint8_t *length ){
+    inline uint8_t * getSysExRtMmcResponseNext( uint8_t * current, size_t *length ){
         ASSERT( current != NULL );
 
         uint8_t len = getSysExRtMmcResponseLength( current );
@@ -2733,7 +2790,7 @@ namespace MidiMessage {
             } SongSelect;
             struct {
                 uint32_t Id;
-                uint8_t Length;
+                size_t Length;
                 uint8_t SubId1;
                 uint8_t SubId2;
                 union {
@@ -2809,6 +2866,71 @@ namespace MidiMessage {
     } Message_t;
 
 
+    /**
+     * Compact (32 bit) representation of any non-SysEx message, ie channel voice, system common and real time messages.
+     *
+     * Status is the status byte (including channel), Data1 and Data2 the data bytes (zero if not used).
+     * Flags are not used by the library (always zero when unpacked), ie free for application use (port number etc).
+     */
+    typedef struct {
+        uint8_t Status;
+        uint8_t Data1;
+        uint8_t Data2;
+        uint8_t Flags;
+    } ShortMessage_t;
+
+    /**
+     * @param   bytes   destination byte array (at least 3 bytes)
+     * @param   msg     message to pack
+     * @return          number of bytes packed, zero if status is invalid
+     */
+    inline uint8_t packShortMessage( uint8_t * bytes, ShortMessage_t * msg ){
+        ASSERT( bytes != NULL );
+        ASSERT( msg != NULL );
+
+        uint8_t length = isControlByte(msg->Status) ? getMsgLen(msg->Status) : 0;
+
+        bytes[0] = msg->Status;
+
+        if (length > 1){
+            bytes[1] = msg->Data1 & DataMask;
+        }
+        if (length > 2){
+            bytes[2] = msg->Data2 & DataMask;
+        }
+
+        return length;
+    }
+
+    /**
+     * @param   bytes   source byte array
+     * @param   length  length of message
+     * @param   msg     destination message
+     * @return          true iff bytes is a valid (non-SysEx) message of exactly given length
+     */
+    inline bool unpackShortMessage( uint8_t * bytes, size_t length, ShortMessage_t * msg ){
+        ASSERT( bytes != NULL );
+        ASSERT( msg != NULL );
+
+        if (length == 0 || ! isControlByte(bytes[0]) || length != getMsgLen(bytes[0])){
+            return false;
+        }
+        if (length > 1 && ! isDataByte(bytes[1])){
+            return false;
+        }
+        if (length > 2 && ! isDataByte(bytes[2])){
+            return false;
+        }
+
+        msg->Status = bytes[0];
+        msg->Data1 = length > 1 ? bytes[1] : 0;
+        msg->Data2 = length > 2 ? bytes[2] : 0;
+        msg->Flags = 0;
+
+        return true;
+    }
+
+
 ///////////// MIDI Message Utilities                 ////////////
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
@@ -2867,6 +2989,61 @@ namespace MidiMessage {
 
     bool simpleValidate( uint8_t * bytes, size_t len );
 
+    /**
+     * Finds the first control byte (ie any byte >= 0x80) in the given bytes, thus any bytes before are data bytes.
+     *
+     * Uses SSE2/AVX2 instructions if enabled at compile time (scalar fallback otherwise).
+     *
+     * @param   bytes   bytes to scan
+     * @param   len     number of bytes
+     * @return          offset of first control byte, <len> if there is none
+     */
+    size_t findControlByte( uint8_t * bytes, size_t len );
+
+    /**
+     * Block variants of nibblize(), denibblize(), sevenbitize() and desevenbitize() for large buffers (same results and
+     * destination sizes).
+     *
+     * (De-)Nibblizing uses SSE2 instructions if enabled at compile time, (de-)sevenbitizing processes a whole 7 byte
+     * group per 64 bit word on little endian targets (scalar fallback otherwise).
+     */
+    size_t nibblizeBlock( uint8_t * dst, uint8_t * src, size_t length );
+    size_t denibblizeBlock( uint8_t * dst, uint8_t * src, size_t length );
+    size_t sevenbitizeBlock( uint8_t * dst, uint8_t * src, size_t length );
+    size_t desevenbitizeBlock( uint8_t * dst, uint8_t * src, size_t length );
+
+    /**
+     * State of a streaming converter, ie the partial group of a previous chunk.
+     */
+    typedef struct {
+        uint8_t Buffer[8];
+        uint8_t Length;
+    } ConverterState_t;
+
+    inline void converter_reset( ConverterState_t * state ){
+        state->Length = 0;
+    }
+
+    /**
+     * Streaming variants of the block converters: data may be passed in chunks of any size, only complete groups (7
+     * bytes for sevenbitizing, 8 bytes for desevenbitizing, 2 bytes for denibblizing) are converted, any remainder is
+     * kept in the state until the next call. Nibblizing needs no state, use nibblizeBlock() instead.
+     *
+     * The final partial group of (de-)sevenbitizing is converted by the respective flush function, whereas a remaining
+     * single nibble can not be denibblized (and is dropped by converter_reset()).
+     *
+     * @param   state   converter state (see converter_reset())
+     * @param   dst     destination, large enough for the complete groups of state + src
+     * @param   src     next chunk of source data
+     * @param   length  length of chunk
+     * @return          number of bytes written to dst
+     */
+    size_t sevenbitizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length );
+    size_t sevenbitizeFlush( ConverterState_t * state, uint8_t * dst );
+    size_t desevenbitizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length );
+    size_t desevenbitizeFlush( ConverterState_t * state, uint8_t * dst );
+    size_t denibblizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length );
+
     /**
      *  Tries to pack a given midi <msg> into the corresponding sequence of raw bytes.
      *
@@ -2874,7 +3051,7 @@ namespace MidiMessage {
      *  @param  msg     midi message to pack into array
      *  @return         number of relevant bytes, zero on invalid message
      */
-    uint8_t pack( uint8_t * bytes, Message_t * msg );
+    size_t pack( uint8_t * bytes, Message_t * msg );
 
     /**
      * Tries to parse/unpack a raw byte sequence assumed to be a midi message.
@@ -2888,7 +3065,57 @@ namespace MidiMessage {
      * @return          true iff valid midi message was read
      * @see freeMessage()
      */
-    bool unpack( uint8_t * bytes,uint8_t len, Message_t * msg );
+    bool unpack( uint8_t * bytes, size_t len, Message_t * msg );
+
+    /**
+     * Like unpack() but for experimental, manufacturer and sample dump data packet messages the payload is not copied,
+     * instead SysEx.ByteData is set to point into <bytes> (ie the message is only valid as long as <bytes> is).
+     *
+     * Such views can be passed to pack() like any other message.
+     *
+     * NOTE: other SysEx messages with data still require SysEx.ByteData to point to a buffer.
+     *
+     * @param   bytes   source byte array of midi message to parse
+     * @param   len     length of bytes to parse
+     * @param   msg     destination midi message struct
+     * @return          true iff valid midi message was read
+     * @see unpack()
+     */
+    bool unpackView( uint8_t * bytes, size_t len, Message_t * msg );
+
+    /**
+     * Converts a short message into a (full) message.
+     *
+     * @return          true iff short message is valid
+     */
+    bool ShortMessagetoMessage( ShortMessage_t * shortMsg, Message_t * msg );
+
+    /**
+     * Converts a (non-SysEx) message into its compact representation.
+     *
+     * @return          true iff message can be represented as short message
+     */
+    bool MessagetoShortMessage( Message_t * msg, ShortMessage_t * shortMsg );
+
+    typedef size_t (*MessagePacker_t)( uint8_t * bytes, Message_t * msg );
+    typedef bool (*MessageUnpacker_t)( uint8_t * bytes, size_t len, Message_t * msg );
+
+    /**
+     * pack() and unpack() dispatch Universal Real Time SysEx messages through a table indexed by SubId1, which allows
+     * to add (or replace) handlers for particular message types.
+     *
+     * NOTE: not thread-safe, ie should be done during initialization.
+     *
+     * @param   subId1      SubId1 of message type
+     * @param   packer      packer to use for message type (NULL if not supported)
+     * @param   unpacker    unpacker to use for message type (NULL if not supported)
+     */
+    void setSysExRtHandlers( uint8_t subId1, MessagePacker_t packer, MessageUnpacker_t unpacker );
+
+    /**
+     * Like setSysExRtHandlers() but for Universal Non-Real Time SysEx messages.
+     */
+    void setSysExNonRtHandlers( uint8_t subId1, MessagePacker_t packer, MessageUnpacker_t unpacker );
 
 #ifdef __cplusplus
     } // extern "C"
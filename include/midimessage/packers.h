@@ -38,7 +38,7 @@ namespace MidiMessage {
         return packNoteOff(bytes, msg->Channel, msg->Data.Note.Key, msg->Data.Note.Velocity);
     }
 
-    inline bool unpackNoteOff(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
+    inline bool unpackNoteOff(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
         ASSERT(key != NULL);
@@ -61,7 +61,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackNoteOffObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackNoteOffObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackNoteOff(bytes, len, &msg->Channel, &msg->Data.Note.Key, &msg->Data.Note.Velocity)) {
@@ -93,7 +93,7 @@ namespace MidiMessage {
         return packNoteOn(bytes, msg->Channel, msg->Data.Note.Key, msg->Data.Note.Velocity);
     }
 
-    inline bool unpackNoteOn(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
+    inline bool unpackNoteOn(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
         ASSERT(key != NULL);
@@ -116,7 +116,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackNoteOnObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackNoteOnObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackNoteOn(bytes, len, &msg->Channel, &msg->Data.Note.Key, &msg->Data.Note.Velocity)) {
@@ -152,7 +152,7 @@ namespace MidiMessage {
         return 0;
     }
 
-    inline bool unpackNote(uint8_t *bytes, uint8_t len, bool *on, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
+    inline bool unpackNote(uint8_t *bytes, size_t len, bool *on, uint8_t *channel, uint8_t *key, uint8_t *velocity) {
         if ((bytes[0] & StatusClassMask) == StatusClassNoteOn) {
             *on = true;
             return unpackNoteOn(bytes, len, channel, key, velocity);
@@ -164,7 +164,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline bool unpackNoteObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackNoteObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackNoteOffObj(bytes, len, msg)) {
@@ -199,7 +199,7 @@ namespace MidiMessage {
                                          msg->Data.PolyphonicKeyPressure.Pressure);
     }
 
-    inline bool unpackPolyphonicKeyPressure(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *key,
+    inline bool unpackPolyphonicKeyPressure(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *key,
                                             uint8_t *pressure) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
@@ -223,7 +223,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackPolyphonicKeyPressureObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackPolyphonicKeyPressureObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackPolyphonicKeyPressure(bytes, len, &msg->Channel, &msg->Data.PolyphonicKeyPressure.Key,
@@ -257,7 +257,7 @@ namespace MidiMessage {
                                  msg->Data.ControlChange.Value);
     }
 
-    inline bool unpackControlChange(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *controller,
+    inline bool unpackControlChange(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *controller,
                                     uint8_t *value) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
@@ -281,7 +281,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackControlChangeObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackControlChangeObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackControlChange(bytes, len, &msg->Channel, &msg->Data.ControlChange.Controller,
@@ -484,7 +484,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackProgramChange(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *program) {
+    inline bool unpackProgramChange(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *program) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
         ASSERT(program != NULL);
@@ -505,7 +505,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackProgramChangeObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackProgramChangeObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackProgramChange(bytes, len, &msg->Channel, &msg->Data.ProgramChange.Program)) {
@@ -534,7 +534,7 @@ namespace MidiMessage {
         return packChannelPressure(bytes, msg->Channel, msg->Data.ChannelPressure.Pressure);
     }
 
-    inline bool unpackChannelPressure(uint8_t *bytes, uint8_t len, uint8_t *channel, uint8_t *pressure) {
+    inline bool unpackChannelPressure(uint8_t *bytes, size_t len, uint8_t *channel, uint8_t *pressure) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
         ASSERT(pressure != NULL);
@@ -555,7 +555,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackChannelPressureObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackChannelPressureObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackChannelPressure(bytes, len, &msg->Channel, &msg->Data.ChannelPressure.Pressure)) {
@@ -585,7 +585,7 @@ namespace MidiMessage {
         return packPitchBendChange(bytes, msg->Channel, msg->Data.PitchBendChange.Pitch);
     }
 
-    inline bool unpackPitchBendChange(uint8_t *bytes, uint8_t len, uint8_t *channel, uint16_t *pitch) {
+    inline bool unpackPitchBendChange(uint8_t *bytes, size_t len, uint8_t *channel, uint16_t *pitch) {
         ASSERT(bytes != NULL);
         ASSERT(channel != NULL);
         ASSERT(pitch != NULL);
@@ -606,7 +606,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackPitchBendChangeObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackPitchBendChangeObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackPitchBendChange(bytes, len, &msg->Channel, &msg->Data.PitchBendChange.Pitch)) {
@@ -884,7 +884,7 @@ namespace MidiMessage {
         ASSERT(bytes != NULL);
 
         bytes[0] = SystemMessageMtcQuarterFrame;
-        bytes[1] = ((messageType & 0x05) << 4) | (nibble & 0x0f);
+        bytes[1] = ((messageType & 0x07) << 4) | (nibble & 0x0f);
 
         return MsgLenMtcQuarterFrame;
     }
@@ -895,7 +895,7 @@ namespace MidiMessage {
         return (packMtcQuarterFrame(bytes, msg->Data.MtcQuarterFrame.MessageType, msg->Data.MtcQuarterFrame.Nibble));
     }
 
-    inline bool unpackMtcQuarterFrame(uint8_t *bytes, uint8_t len, uint8_t *messageType, uint8_t *nibble) {
+    inline bool unpackMtcQuarterFrame(uint8_t *bytes, size_t len, uint8_t *messageType, uint8_t *nibble) {
         ASSERT(bytes != NULL);
         ASSERT(messageType != NULL);
         ASSERT(nibble != NULL);
@@ -910,13 +910,13 @@ namespace MidiMessage {
             return false;
         }
 
-        *messageType = (bytes[1] >> 4) & 0x05;
+        *messageType = (bytes[1] >> 4) & 0x07;
         *nibble = bytes[1] & NibbleMask;
 
         return true;
     }
 
-    inline bool unpackMtcQuarterFrameObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackMtcQuarterFrameObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackMtcQuarterFrame(bytes, len, &msg->Data.MtcQuarterFrame.MessageType,
@@ -946,7 +946,7 @@ namespace MidiMessage {
         return packSongPositionPointer(bytes, msg->Data.SongPositionPointer.Position);
     }
 
-    inline bool unpackSongPositionPointer(uint8_t *bytes, uint8_t len, uint16_t *position) {
+    inline bool unpackSongPositionPointer(uint8_t *bytes, size_t len, uint16_t *position) {
         ASSERT(bytes != NULL);
         ASSERT(position != NULL);
 
@@ -962,7 +962,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSongPositionPointerObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackSongPositionPointerObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackSongPositionPointer(bytes, len, &msg->Data.SongPositionPointer.Position)) {
@@ -990,7 +990,7 @@ namespace MidiMessage {
         return packSongSelect(bytes, msg->Data.SongSelect.Song);
     }
 
-    inline bool unpackSongSelect(uint8_t *bytes, uint8_t len, uint8_t *song) {
+    inline bool unpackSongSelect(uint8_t *bytes, size_t len, uint8_t *song) {
         ASSERT(bytes != NULL);
         ASSERT(song != NULL);
 
@@ -1006,7 +1006,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSongSelectObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackSongSelectObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackSongSelect(bytes, len, &msg->Data.SongSelect.Song)) {
@@ -1034,7 +1034,7 @@ namespace MidiMessage {
         return packSystemMessage(bytes, msg->SystemMessage);
     }
 
-    inline bool unpackSystemMessage( uint8_t *bytes, uint8_t length, uint8_t *systemMessage){
+    inline bool unpackSystemMessage( uint8_t *bytes, size_t length, uint8_t *systemMessage){
         ASSERT(bytes != NULL);
 
         if (length != MsgLenSystemMessage || bytes[0] == SystemMessageSystemExclusive || !isSystemMessage(bytes[0])){
@@ -1046,7 +1046,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSystemMessageObj( uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSystemMessageObj( uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL);
 
         if (unpackSystemMessage(bytes, length, &msg->SystemMessage)){
@@ -1088,7 +1088,7 @@ namespace MidiMessage {
         return packSysExNonRtHandshake(bytes, msg->Channel, msg->Data.SysEx.SubId1, msg->Data.SysEx.Data.PacketNumber );
     }
 
-    inline bool unpackSysExNonRtHandshake(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *subId1, uint8_t *packetNumber){
+    inline bool unpackSysExNonRtHandshake(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *subId1, uint8_t *packetNumber){
         ASSERT(bytes != NULL);
         ASSERT( deviceId != NULL);
         ASSERT( subId1 != NULL);
@@ -1108,7 +1108,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtHandshakeObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtHandshakeObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtHandshake(bytes, length, &msg->Channel, &msg->Data.SysEx.SubId1, &msg->Data.SysEx.Data.PacketNumber)){
@@ -1126,16 +1126,16 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExExperimentalMessage(uint8_t *bytes, uint8_t *data, uint8_t dataLength) {
+    inline size_t packSysExExperimentalMessage(uint8_t *bytes, uint8_t *data, size_t dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(dataLength == 0 || data != NULL);
 
-        uint8_t len = 2;
+        size_t len = 2;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdExperimental_Byte;
 
-        for (uint8_t i = 0; i < dataLength; i++) {
+        for (size_t i = 0; i < dataLength; i++) {
             bytes[len++] = data[i];
         }
 
@@ -1144,15 +1144,18 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExExperimentalMessageObj(uint8_t *bytes, Message_t *msg) {
+    inline size_t packSysExExperimentalMessageObj(uint8_t *bytes, Message_t *msg) {
         ASSERT(msg != NULL);
 
         return packSysExExperimentalMessage(bytes, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExExperimentalMessage(uint8_t *bytes, uint8_t len, uint8_t *data, uint8_t *dataLength) {
+    /**
+     * Like unpackSysExExperimentalMessage() but instead of copying the payload <data> is set to point into <bytes>.
+     */
+    inline bool unpackSysExExperimentalMessageView(uint8_t *bytes, size_t len, uint8_t **data, size_t *dataLength) {
         ASSERT(bytes != NULL);
-        ASSERT(len > 2 || data != NULL);
+        ASSERT(data != NULL);
         ASSERT(dataLength != NULL);
 
         if (len < 3 || !isControlByte(bytes[len-1]) ) {
@@ -1170,19 +1173,29 @@ namespace MidiMessage {
             len--;
 //        }
 
-        if (len <= 2) {
-            *dataLength = 0;
-        } else {
-            for (uint8_t i = 2, j = 0; i < len; i++, j++) {
-                data[j] = bytes[i];
-            }
-            *dataLength = len - 2;
+        *data = &bytes[2];
+        *dataLength = len - 2;
+
+        return true;
+    }
+
+    inline bool unpackSysExExperimentalMessage(uint8_t *bytes, size_t len, uint8_t *data, size_t *dataLength) {
+        ASSERT(len > 2 || data != NULL);
+
+        uint8_t * view;
+
+        if ( ! unpackSysExExperimentalMessageView(bytes, len, &view, dataLength) ){
+            return false;
+        }
+
+        for (size_t i = 0; i < *dataLength; i++) {
+            data[i] = view[i];
         }
 
         return true;
     }
 
-    inline bool unpackSysExExperimentalMessageObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackSysExExperimentalMessageObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackSysExExperimentalMessage(bytes, len, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)) {
@@ -1195,23 +1208,36 @@ namespace MidiMessage {
         return false;
     }
 
+    inline bool unpackSysExExperimentalMessageViewObj(uint8_t *bytes, size_t len, Message_t *msg) {
+        ASSERT(msg != NULL);
+
+        if (unpackSysExExperimentalMessageView(bytes, len, &msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)) {
+            msg->StatusClass = StatusClassSystemMessage;
+            msg->SystemMessage = SystemMessageSystemExclusive;
+            msg->Data.SysEx.Id = SysExIdExperimental;
+            return true;
+        }
+
+        return false;
+    }
+
 ///////////// SysEx: Manufacturer Messages          /////////////
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExManufacturerMessage(uint8_t *bytes, uint32_t manufacturerId, uint8_t *data,
-                                                uint8_t dataLength) {
+    inline size_t packSysExManufacturerMessage(uint8_t *bytes, uint32_t manufacturerId, uint8_t *data,
+                                                size_t dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(isSysExManufacturerId(manufacturerId));
         ASSERT(dataLength == 0 || data != NULL);
 
-        uint8_t len = 1;
+        size_t len = 1;
 
         bytes[0] = SystemMessageSystemExclusive;
         len += packSysExId(&bytes[1], manufacturerId);
 
-        for (uint8_t i = 0; i < dataLength; i++) {
+        for (size_t i = 0; i < dataLength; i++) {
             bytes[len++] = data[i];
         }
 
@@ -1220,21 +1246,24 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExManufacturerMessageObj( uint8_t *bytes, Message_t * msg ){
+    inline size_t packSysExManufacturerMessageObj( uint8_t *bytes, Message_t * msg ){
         ASSERT( msg != NULL );
 
         return packSysExManufacturerMessage( bytes, msg->Data.SysEx.Id, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
 
-    inline bool unpackSysExManufacturerMessage(uint8_t *bytes, uint8_t len, uint32_t *manufacturerId, uint8_t *data,
-                                               uint8_t *dataLength) {
+    /**
+     * Like unpackSysExManufacturerMessage() but instead of copying the payload <data> is set to point into <bytes>.
+     */
+    inline bool unpackSysExManufacturerMessageView(uint8_t *bytes, size_t len, uint32_t *manufacturerId, uint8_t **data,
+                                               size_t *dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(manufacturerId != NULL);
         ASSERT(data != NULL);
         ASSERT(dataLength != NULL);
 
-        uint8_t p = 1;
+        size_t p = 1;
 
         if ((len < 2 && bytes[1] != SysExIdManufacturerExtension_Byte) ||
             (len < 4 && bytes[1] == SysExIdManufacturerExtension_Byte) ||
@@ -1254,19 +1283,35 @@ namespace MidiMessage {
             len--;
 //        }
 
+        *data = &bytes[p];
+
         if (len <= p) {
             *dataLength = 0;
         } else {
-            for (uint8_t i = p, j = 0; i < len; i++, j++) {
-                data[j] = bytes[i];
-            }
             *dataLength = len - p;
         }
 
         return true;
     }
 
-    inline bool unpackSysExManufacturerMessageObj( uint8_t *bytes, uint8_t length, Message_t * msg ){
+    inline bool unpackSysExManufacturerMessage(uint8_t *bytes, size_t len, uint32_t *manufacturerId, uint8_t *data,
+                                               size_t *dataLength) {
+        ASSERT(data != NULL);
+
+        uint8_t * view;
+
+        if ( ! unpackSysExManufacturerMessageView(bytes, len, manufacturerId, &view, dataLength) ){
+            return false;
+        }
+
+        for (size_t i = 0; i < *dataLength; i++) {
+            data[i] = view[i];
+        }
+
+        return true;
+    }
+
+    inline bool unpackSysExManufacturerMessageObj( uint8_t *bytes, size_t length, Message_t * msg ){
         ASSERT( msg != NULL );
 
         if ( unpackSysExManufacturerMessage(bytes, length, &msg->Data.SysEx.Id, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length) ){
@@ -1278,6 +1323,18 @@ namespace MidiMessage {
         return false;
     }
 
+    inline bool unpackSysExManufacturerMessageViewObj( uint8_t *bytes, size_t length, Message_t * msg ){
+        ASSERT( msg != NULL );
+
+        if ( unpackSysExManufacturerMessageView(bytes, length, &msg->Data.SysEx.Id, &msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length) ){
+            msg->StatusClass = StatusClassSystemMessage;
+            msg->SystemMessage = SystemMessageSystemExclusive;
+            return true;
+        }
+
+        return false;
+    }
+
 ///////////// SysEx: MIDI Time Code + Cueing         ////////////
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
@@ -1322,7 +1379,7 @@ namespace MidiMessage {
         return packSysExRtMtcFullMessageObjMtc(bytes, msg->Channel, &msg->Data.SysEx.Data.MidiTimeCode);
     }
 
-    inline bool unpackSysExRtMtcFullMessage(uint8_t *bytes, uint8_t len, uint8_t *deviceId, uint8_t *fps, uint8_t *hour,
+    inline bool unpackSysExRtMtcFullMessage(uint8_t *bytes, size_t len, uint8_t *deviceId, uint8_t *fps, uint8_t *hour,
                                           uint8_t *minute, uint8_t *second, uint8_t *frame) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
@@ -1364,7 +1421,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtMtcFullMessageObjMtc(uint8_t *bytes, uint8_t len, uint8_t *deviceId, MidiTimeCode_t *mtc) {
+    inline bool unpackSysExRtMtcFullMessageObjMtc(uint8_t *bytes, size_t len, uint8_t *deviceId, MidiTimeCode_t *mtc) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(mtc != NULL);
@@ -1378,7 +1435,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline bool unpackSysExRtMtcFullMessageObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackSysExRtMtcFullMessageObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackSysExRtMtcFullMessageObjMtc(bytes, len, &msg->Channel, &msg->Data.SysEx.Data.MidiTimeCode)) {
@@ -1423,7 +1480,7 @@ namespace MidiMessage {
         return packSysExRtMtcUserBits(bytes, msg->Channel, msg->Data.SysEx.ByteData);
     }
 
-    inline bool unpackSysExRtMtcUserBits(uint8_t *bytes, uint8_t len, uint8_t *deviceId, uint8_t *userBits) {
+    inline bool unpackSysExRtMtcUserBits(uint8_t *bytes, size_t len, uint8_t *deviceId, uint8_t *userBits) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(userBits != NULL);
@@ -1457,7 +1514,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtMtcUserBitsObj(uint8_t *bytes, uint8_t len, Message_t *msg) {
+    inline bool unpackSysExRtMtcUserBitsObj(uint8_t *bytes, size_t len, Message_t *msg) {
         ASSERT(msg != NULL);
 
         if (unpackSysExRtMtcUserBits(bytes, len, &msg->Channel, msg->Data.SysEx.ByteData)) {
@@ -1492,7 +1549,7 @@ namespace MidiMessage {
         return 0;
     }
 
-    inline bool unpackSysExRtMidiTimeCodeObj(uint8_t * bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExRtMidiTimeCodeObj(uint8_t * bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL );
 
         if (length < 5) {
@@ -1510,10 +1567,10 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t packSysExNonRtMtcCueingSetupMessage(uint8_t * bytes, uint8_t msgType, uint8_t deviceId,
+    inline size_t packSysExNonRtMtcCueingSetupMessage(uint8_t * bytes, uint8_t msgType, uint8_t deviceId,
                                                        uint8_t fps, uint8_t hour, uint8_t minute, uint8_t second,
                                                        uint8_t frame, uint8_t fractionalFrame, uint16_t eventNumber,
-                                                       uint8_t * addInfo, uint8_t addInfoLen) {
+                                                       uint8_t * addInfo, size_t addInfoLen) {
         ASSERT(isSysExNonRtMtc(msgType));
         ASSERT(!isSysExNonRtMtcWithAddInfo(msgType) || addInfoLen > 0);
         ASSERT(bytes != NULL);
@@ -1527,7 +1584,7 @@ namespace MidiMessage {
         ASSERT(eventNumber <= MaxEventNumber);
         ASSERT( addInfoLen == 0 || addInfo != NULL );
 
-        int msgLen = MsgLenSysExNonRtMtcCueingSetupMessageMin - 1; // min message length (w/o EOX)
+        size_t msgLen = MsgLenSysExNonRtMtcCueingSetupMessageMin - 1; // min message length (w/o EOX)
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -1561,9 +1618,9 @@ namespace MidiMessage {
         return msgLen;
     }
 
-    inline uint8_t packSysExNonRtMtcCueingSetupMessageObjCue(uint8_t * bytes, uint8_t msgType, uint8_t deviceId,
+    inline size_t packSysExNonRtMtcCueingSetupMessageObjCue(uint8_t * bytes, uint8_t msgType, uint8_t deviceId,
                                                        MtcCueingData_t * cueing, uint8_t * addInfo,
-                                                       uint8_t addInfoLen) {
+                                                       size_t addInfoLen) {
         ASSERT( cueing != NULL );
 
         return packSysExNonRtMtcCueingSetupMessage(bytes, msgType, deviceId, cueing->MidiTimeCode.Fps,
@@ -1571,7 +1628,7 @@ namespace MidiMessage {
                                                    cueing->MidiTimeCode.FractionalFrame, cueing->EventNumber, addInfo, addInfoLen);
     }
 
-    inline uint8_t packSysExNonRtMtcCueingSetupMessageObj( uint8_t * bytes, Message_t * msg ){
+    inline size_t packSysExNonRtMtcCueingSetupMessageObj( uint8_t * bytes, Message_t * msg ){
         ASSERT( msg != NULL );
         ASSERT( msg->StatusClass == StatusClassSystemMessage);
         ASSERT( msg->SystemMessage == SystemMessageSystemExclusive);
@@ -1582,10 +1639,10 @@ namespace MidiMessage {
         return packSysExNonRtMtcCueingSetupMessageObjCue( bytes, msg->Data.SysEx.SubId2, msg->Channel, &msg->Data.SysEx.Data.Cueing, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
-    inline bool unpackSysExNonRtMtcCueingSetupMessage(uint8_t * bytes, uint8_t len,
+    inline bool unpackSysExNonRtMtcCueingSetupMessage(uint8_t * bytes, size_t len,
                                                       uint8_t * deviceId, uint8_t  * msgType, uint8_t * fps, uint8_t * hour, uint8_t * minute,
                                                       uint8_t * second, uint8_t * frame, uint8_t * fractionalFrame,
-                                                      uint16_t * eventNumber, uint8_t * addInfo, uint8_t * addInfoLen) {
+                                                      uint16_t * eventNumber, uint8_t * addInfo, size_t * addInfoLen) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(msgType != NULL);
@@ -1625,13 +1682,13 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtMtcCueingSetupMessageObjCue( uint8_t * bytes, uint8_t len, uint8_t * deviceId, uint8_t * msgType, MtcCueingData_t * cueing, uint8_t *addInfo, uint8_t *addInfoLen){
+    inline bool unpackSysExNonRtMtcCueingSetupMessageObjCue( uint8_t * bytes, size_t len, uint8_t * deviceId, uint8_t * msgType, MtcCueingData_t * cueing, uint8_t *addInfo, size_t *addInfoLen){
         ASSERT( cueing != NULL );
 
         return unpackSysExNonRtMtcCueingSetupMessage( bytes, len, deviceId, msgType, &cueing->MidiTimeCode.Fps, &cueing->MidiTimeCode.Hour, &cueing->MidiTimeCode.Minute, &cueing->MidiTimeCode.Second, &cueing->MidiTimeCode.Frame, &cueing->MidiTimeCode.FractionalFrame, &cueing->EventNumber, addInfo, addInfoLen);
     }
 
-    inline bool unpackSysExNonRtMtcCueingSetupMessageObj(uint8_t * bytes, uint8_t len, Message_t * msg ){
+    inline bool unpackSysExNonRtMtcCueingSetupMessageObj(uint8_t * bytes, size_t len, Message_t * msg ){
         ASSERT( msg != NULL );
 
         if ( unpackSysExNonRtMtcCueingSetupMessageObjCue(bytes, len, &msg->Channel, &msg->Data.SysEx.SubId2, &msg->Data.SysEx.Data.Cueing, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length ) ){
@@ -1646,15 +1703,15 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t packSysExRtMtcCueingSetupMessage(uint8_t *bytes, uint8_t deviceId, uint8_t msgType,
-                                                    uint16_t eventNumber, uint8_t *addInfo, uint32_t addInfoLen) {
+    inline size_t packSysExRtMtcCueingSetupMessage(uint8_t *bytes, uint8_t deviceId, uint8_t msgType,
+                                                    uint16_t eventNumber, uint8_t *addInfo, size_t addInfoLen) {
         ASSERT( isSysExRtMtcCueing(msgType) );
         ASSERT( !isSysExRtMtcCueingWithAddInfo(msgType) || addInfoLen > 0  );
         ASSERT( bytes != NULL );
         ASSERT( deviceId <= MaxU7 );
         ASSERT( eventNumber <= MaxEventNumber );
 
-        int len = 7; // min message length (w/o EOX)
+        size_t len = 7; // min message length (w/o EOX)
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
@@ -1673,16 +1730,16 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExRtMtcCueingSetupMessageObj( uint8_t * bytes, Message_t * msg ){
+    inline size_t packSysExRtMtcCueingSetupMessageObj( uint8_t * bytes, Message_t * msg ){
         ASSERT( msg != NULL );
 
         return packSysExRtMtcCueingSetupMessage( bytes, msg->Channel, msg->Data.SysEx.SubId2, msg->Data.SysEx.Data.Cueing.EventNumber, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
 
-    inline bool unpackSysExRtMtcCueingSetupMessage(uint8_t *bytes, uint8_t len, uint8_t *deviceId,
+    inline bool unpackSysExRtMtcCueingSetupMessage(uint8_t *bytes, size_t len, uint8_t *deviceId,
                                                    uint8_t *msgType, uint16_t *eventNumber, uint8_t *addInfo,
-                                                   uint8_t *addInfoLen) {
+                                                   size_t *addInfoLen) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(eventNumber != NULL);
@@ -1709,7 +1766,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtMtcCueingSetupMessageObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtMtcCueingSetupMessageObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT( msg != NULL );
 
         if (unpackSysExRtMtcCueingSetupMessage( bytes, length, &msg->Channel, &msg->Data.SysEx.SubId2, &msg->Data.SysEx.Data.Cueing.EventNumber, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length) ){
@@ -1819,7 +1876,7 @@ namespace MidiMessage {
 //        return true;
 //    }
 
-    inline bool unpackSysExNonRtGenInfoIdentityReply(uint8_t *bytes, uint8_t len, uint8_t *deviceId,
+    inline bool unpackSysExNonRtGenInfoIdentityReply(uint8_t *bytes, size_t len, uint8_t *deviceId,
                                                       uint32_t *manufacturerId, uint16_t *deviceFamily,
                                                       uint16_t *deviceFamilyMember, uint8_t *softwareRevision) {
         ASSERT(bytes != NULL);
@@ -1849,7 +1906,7 @@ namespace MidiMessage {
             return false;
         }
 
-        int l = 5;
+        size_t l = 5;
 
         *deviceId = bytes[2] & DataMask;
 
@@ -1869,7 +1926,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtGeneralInformationObj( uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtGeneralInformationObj( uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL );
 
         if (length < 5 || isControlByte(bytes[length-1])){
@@ -1988,7 +2045,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline bool unpackSysExRtDcBasic(uint8_t *bytes, uint8_t len, uint8_t *deviceId, uint8_t *type,
+    inline bool unpackSysExRtDcBasic(uint8_t *bytes, size_t len, uint8_t *deviceId, uint8_t *type,
                                     uint16_t *value) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
@@ -2023,7 +2080,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExRtDcGlobalParameterControl(uint8_t *bytes, uint8_t len, uint8_t *deviceId,
+    inline bool unpackSysExRtDcGlobalParameterControl(uint8_t *bytes, size_t len, uint8_t *deviceId,
                                              GlobalParameterControl_t *gpc) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
@@ -2062,7 +2119,7 @@ namespace MidiMessage {
 //            gpc->Data[l] |= bytes[i++] & NibbleMask;
 //        }
 
-        for (int i = 8 ; i < len && bytes[i] != SystemMessageEndOfExclusive; i++, l++) {
+        for (size_t i = 8 ; i < len && bytes[i] != SystemMessageEndOfExclusive; i++, l++) {
             gpc->Data[l] = bytes[i];
         }
 
@@ -2071,7 +2128,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtDeviceControlObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExRtDeviceControlObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL );
 
         if (length < 5){
@@ -2116,7 +2173,7 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExRtControllerDestinationSetting( uint8_t * bytes, uint8_t deviceId, uint8_t subId2, uint8_t channel, uint8_t controller, uint8_t * data, uint8_t dataLength){
+    inline size_t packSysExRtControllerDestinationSetting( uint8_t * bytes, uint8_t deviceId, uint8_t subId2, uint8_t channel, uint8_t controller, uint8_t * data, size_t dataLength){
         ASSERT( bytes != NULL );
         ASSERT( deviceId <= MaxU7 );
         ASSERT( isSysExRtCds(subId2) );
@@ -2134,7 +2191,7 @@ namespace MidiMessage {
         bytes[4] = subId2;
         bytes[5] = channel;
 
-        uint8_t length = 0;
+        size_t length = 0;
 
         if (subId2 == SysExRtCdsController){
             bytes[6] = controller;
@@ -2143,7 +2200,7 @@ namespace MidiMessage {
             length = 6;
         }
 
-        for(uint8_t i = 0; i < dataLength; i++){
+        for(size_t i = 0; i < dataLength; i++){
             bytes[length++] = data[i];
         }
 
@@ -2152,11 +2209,11 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExRtControllerDestinationSettingObj( uint8_t * bytes, Message_t * msg){
+    inline size_t packSysExRtControllerDestinationSettingObj( uint8_t * bytes, Message_t * msg){
         return packSysExRtControllerDestinationSetting(bytes, msg->Channel, msg->Data.SysEx.SubId2, msg->Data.SysEx.Data.ControllerDestinationSetting.Channel, msg->Data.SysEx.Data.ControllerDestinationSetting.Controller, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExRtControllerDestinationSetting( uint8_t * bytes, uint8_t length, uint8_t * deviceId, uint8_t *subId2, uint8_t * channel, uint8_t * controller, uint8_t * data, uint8_t * dataLength){
+    inline bool unpackSysExRtControllerDestinationSetting( uint8_t * bytes, size_t length, uint8_t * deviceId, uint8_t *subId2, uint8_t * channel, uint8_t * controller, uint8_t * data, size_t * dataLength){
         ASSERT( bytes != NULL );
         ASSERT( deviceId != NULL );
         ASSERT( channel != NULL );
@@ -2185,7 +2242,7 @@ namespace MidiMessage {
         }
 
         length--; // skip trailing control byte
-        uint8_t l = 0;
+        size_t l = 0;
 
         while(p < length){
             data[l++] = bytes[p++];
@@ -2196,7 +2253,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtControllerDestinationSettingObj( uint8_t * bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtControllerDestinationSettingObj( uint8_t * bytes, size_t length, Message_t * msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExRtControllerDestinationSetting(bytes, length, &msg->Channel, &msg->Data.SysEx.SubId2, &msg->Data.SysEx.Data.ControllerDestinationSetting.Channel, &msg->Data.SysEx.Data.ControllerDestinationSetting.Controller, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)){
@@ -2215,7 +2272,7 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExRtKeybasedInstrumentControl( uint8_t * bytes, uint8_t deviceId, uint8_t channel, uint8_t key, uint8_t * data, uint8_t dataLength){
+    inline size_t packSysExRtKeybasedInstrumentControl( uint8_t * bytes, uint8_t deviceId, uint8_t channel, uint8_t key, uint8_t * data, size_t dataLength){
         ASSERT( bytes != NULL );
         ASSERT( deviceId <= MaxU7 );
         ASSERT(channel <= MaxU4 );
@@ -2233,9 +2290,9 @@ namespace MidiMessage {
         bytes[5] = channel;
         bytes[6] = key;
 
-        uint8_t length = 7;
+        size_t length = 7;
 
-        for(uint8_t i = 0; i < dataLength; i++){
+        for(size_t i = 0; i < dataLength; i++){
             bytes[length++] = data[i];
         }
 
@@ -2244,11 +2301,11 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExRtKeybasedInstrumentControlObj( uint8_t * bytes, Message_t * msg){
+    inline size_t packSysExRtKeybasedInstrumentControlObj( uint8_t * bytes, Message_t * msg){
         return packSysExRtKeybasedInstrumentControl(bytes, msg->Channel, msg->Data.SysEx.Data.ControllerDestinationSetting.Channel, msg->Data.SysEx.Data.ControllerDestinationSetting.Controller, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExRtKeybasedInstrumentControl( uint8_t * bytes, uint8_t length, uint8_t * deviceId, uint8_t *channel, uint8_t * key, uint8_t * data, uint8_t * dataLength){
+    inline bool unpackSysExRtKeybasedInstrumentControl( uint8_t * bytes, size_t length, uint8_t * deviceId, uint8_t *channel, uint8_t * key, uint8_t * data, size_t * dataLength){
         ASSERT( bytes != NULL );
         ASSERT( deviceId != NULL );
         ASSERT( channel != NULL );
@@ -2267,10 +2324,10 @@ namespace MidiMessage {
         *channel = bytes[5];
         *key = bytes[6];
 
-        uint8_t p = 7;
+        size_t p = 7;
 
         length--; // skip trailing control byte
-        uint8_t l = 0;
+        size_t l = 0;
 
         while(p < length){
             data[l++] = bytes[p++];
@@ -2281,7 +2338,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtKeybasedInstrumentControlObj( uint8_t * bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtKeybasedInstrumentControlObj( uint8_t * bytes, size_t length, Message_t * msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExRtKeybasedInstrumentControl(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.KeybasedInstrumentControl.Channel, &msg->Data.SysEx.Data.KeybasedInstrumentControl.Key, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)){
@@ -2325,7 +2382,7 @@ namespace MidiMessage {
         return packSysExNonRtGeneralMidi(bytes, msg->Channel, msg->Data.SysEx.SubId2);
     }
 
-    inline bool unpackSysExNonRtGeneralMidi(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *subId2){
+    inline bool unpackSysExNonRtGeneralMidi(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *subId2){
         ASSERT( bytes != NULL );
         ASSERT(deviceId != NULL);
         ASSERT( subId2 != NULL);
@@ -2343,7 +2400,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtGeneralMidiObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtGeneralMidiObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL );
 
         if (unpackSysExNonRtGeneralMidi(bytes, length, &msg->Channel, &msg->Data.SysEx.SubId2)){
@@ -2368,22 +2425,22 @@ namespace MidiMessage {
      * if command == 0, it is assumed the data structure is taken care of externally by the caller. That is, any commands must be
      * given by <data> where of <data[0]> would be the first (and possibly only) command.
      */
-    inline uint8_t packSysExRtMmcCommandMessage(uint8_t *bytes, uint8_t deviceId, uint8_t *data,
-                                         uint8_t dataLength) {
+    inline size_t packSysExRtMmcCommandMessage(uint8_t *bytes, uint8_t deviceId, uint8_t *data,
+                                         size_t dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId <= MaxU7);
         ASSERT((dataLength == 0) || (data != NULL));
         ASSERT(dataLength <= MaxU7);
         ASSERT(isSysExRtMmcCommand(data[0]));
 
-        uint32_t len = 4;
+        size_t len = 4;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
         bytes[2] = deviceId & DataMask;
         bytes[3] = SysExRtMidiMachineControlCommand;
 
-        for (uint8_t i = 0; i < dataLength; i++) {
+        for (size_t i = 0; i < dataLength; i++) {
             bytes[len++] = data[i];
         }
 
@@ -2394,14 +2451,14 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExRtMmcCommandMessageObj( uint8_t *bytes, Message_t * msg ){
+    inline size_t packSysExRtMmcCommandMessageObj( uint8_t *bytes, Message_t * msg ){
         ASSERT( msg != NULL );
 
         return packSysExRtMmcCommandMessage( bytes, msg->Channel, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
-    inline bool unpackSysExRtMmcCommandMessage(uint8_t *bytes, uint8_t len, uint8_t *deviceId,
-                                        uint8_t *data, uint8_t *dataLength) {
+    inline bool unpackSysExRtMmcCommandMessage(uint8_t *bytes, size_t len, uint8_t *deviceId,
+                                        uint8_t *data, size_t *dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(data != NULL);
@@ -2429,9 +2486,9 @@ namespace MidiMessage {
 
         *deviceId = bytes[2];
 
-        uint8_t l = len - MsgLenSysExRtMmcCommandWithoutData;
+        size_t l = len - MsgLenSysExRtMmcCommandWithoutData;
 
-        for (uint8_t i = 4, j = 0; j < l; i++, j++) {
+        for (size_t i = 4, j = 0; j < l; i++, j++) {
             data[j] = bytes[i];
         }
 
@@ -2441,7 +2498,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExRtMmcCommandMessageObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtMmcCommandMessageObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT( msg != NULL );
 
         if ( unpackSysExRtMmcCommandMessage( bytes, length, &msg->Channel, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length) ){
@@ -2548,7 +2605,7 @@ namespace MidiMessage {
         }
     }
 
-    inline bool unpackSysExRtMmcCommand( uint8_t * bytes, uint8_t length, SysExRtMmcCommandData_t * cmd ){
+    inline bool unpackSysExRtMmcCommand( uint8_t * bytes, size_t length, SysExRtMmcCommandData_t * cmd ){
         ASSERT( bytes != NULL );
         ASSERT( cmd != NULL );
 
@@ -2562,7 +2619,7 @@ namespace MidiMessage {
         cmd->Command.Value = 0;
 
 
-        uint8_t len = 0;
+        size_t len = 0;
 
         len += copyExtensibleValueBytes( cmd->Command.Bytes, bytes, true );
 
@@ -2663,22 +2720,22 @@ namespace MidiMessage {
     /**
      * MMC Responses allow for multiple responses in a sysex message
      */
-    inline uint8_t packSysExRtMmcResponseMessage(uint8_t *bytes, uint8_t deviceId, uint8_t *data,
-                                         uint8_t dataLength) {
+    inline size_t packSysExRtMmcResponseMessage(uint8_t *bytes, uint8_t deviceId, uint8_t *data,
+                                         size_t dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId <= MaxU7);
         ASSERT((dataLength == 0) || (data != NULL));
         ASSERT(dataLength <= MaxU7);
         ASSERT(isSysExRtMmcCommand(data[0]));
 
-        uint32_t len = 5;
+        size_t len = 5;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
         bytes[2] = deviceId & DataMask;
         bytes[3] = SysExRtMidiMachineControlResponse;
 
-        for (uint8_t i = 0; i < dataLength; i++) {
+        for (size_t i = 0; i < dataLength; i++) {
             bytes[len++] = data[i];
         }
 
@@ -2689,14 +2746,14 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExRtMmcResponseMessageObj( uint8_t *bytes, Message_t * msg ){
+    inline size_t packSysExRtMmcResponseMessageObj( uint8_t *bytes, Message_t * msg ){
         ASSERT( msg != NULL );
 
         return packSysExRtMmcResponseMessage( bytes, msg->Channel, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
-    inline bool unpackSysExRtMmcResponseMessage(uint8_t *bytes, uint8_t len, uint8_t *deviceId,
-                                        uint8_t *data, uint8_t *dataLength) {
+    inline bool unpackSysExRtMmcResponseMessage(uint8_t *bytes, size_t len, uint8_t *deviceId,
+                                        uint8_t *data, size_t *dataLength) {
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(data != NULL);
@@ -2724,9 +2781,9 @@ namespace MidiMessage {
 
         *deviceId = bytes[2];
 
-        uint8_t l = len - MsgLenSysExRtMmcResponseWithoutData;
+        size_t l = len - MsgLenSysExRtMmcResponseWithoutData;
 
-        for (uint8_t i = 4, j = 0; j < l; i++, j++) {
+        for (size_t i = 4, j = 0; j < l; i++, j++) {
             data[j] = bytes[i];
         }
 
@@ -2736,7 +2793,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExRtMmcResponseMessageObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtMmcResponseMessageObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT( msg != NULL );
 
         if ( unpackSysExRtMmcResponseMessage( bytes, length, &msg->Channel, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length) ){
@@ -2756,7 +2813,7 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExRtMobilePhoneControl(uint8_t *bytes, uint8_t phoneId, SysExRtMobileData_t *mobile, uint8_t * data, uint8_t dataLength){
+    inline size_t packSysExRtMobilePhoneControl(uint8_t *bytes, uint8_t phoneId, SysExRtMobileData_t *mobile, uint8_t * data, size_t dataLength){
         ASSERT( bytes != NULL);
         ASSERT(phoneId <= MaxU7);
         ASSERT(mobile !=NULL);
@@ -2765,7 +2822,7 @@ namespace MidiMessage {
         ASSERT( mobile->Command.Id != SysExRtMobileCmdIdFollowMidiChannels || (dataLength % 3 == 0));
         ASSERT(dataLength==0 || data !=NULL);
 
-        uint8_t length = 6;
+        size_t length = 6;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
@@ -2787,7 +2844,7 @@ namespace MidiMessage {
             case SysExRtMobileCmdIdManufacturer:
                 length += packSysExId( &bytes[length], mobile->Command.ManufacturerId);
 
-                for (uint8_t i = 0; i < dataLength; i++){
+                for (size_t i = 0; i < dataLength; i++){
                     bytes[length++] = data[i];
                 }
                 break;
@@ -2799,7 +2856,7 @@ namespace MidiMessage {
                 break;
 
             case SysExRtMobileCmdIdFollowMidiChannels:
-                for (uint8_t i = 0; i < dataLength; i++){
+                for (size_t i = 0; i < dataLength; i++){
                     bytes[length++] = data[i];
                 }
                 break;
@@ -2821,7 +2878,7 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExRtMobilePhoneControlObj(uint8_t *bytes, Message_t * msg){
+    inline size_t packSysExRtMobilePhoneControlObj(uint8_t *bytes, Message_t * msg){
         ASSERT( msg != NULL);
         ASSERT( msg->StatusClass == StatusClassSystemMessage );
         ASSERT( msg->SystemMessage == SystemMessageSystemExclusive );
@@ -2831,7 +2888,7 @@ namespace MidiMessage {
         return packSysExRtMobilePhoneControl(bytes, msg->Channel, &msg->Data.SysEx.Data.MobilePhoneControl, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
     }
 
-    inline bool unpackSysExRtMobilePhoneControl(uint8_t *bytes, uint8_t length, uint8_t *phoneId, SysExRtMobileData_t *mobile, uint8_t * data, uint8_t *dataLength){
+    inline bool unpackSysExRtMobilePhoneControl(uint8_t *bytes, size_t length, uint8_t *phoneId, SysExRtMobileData_t *mobile, uint8_t * data, size_t *dataLength){
         ASSERT( bytes!=NULL);
         ASSERT(phoneId !=NULL);
         ASSERT(mobile!=NULL);
@@ -2845,7 +2902,7 @@ namespace MidiMessage {
             return false;
         }
 
-        uint8_t l = 6;
+        size_t l = 6;
 
         *phoneId = bytes[2];
         mobile->DeviceClass.Id = bytes[5];
@@ -2868,7 +2925,7 @@ namespace MidiMessage {
 
                 *dataLength = length - l - 1;
 
-                for (uint8_t i = 0, I = *dataLength; i < I; i++){
+                for (size_t i = 0, I = *dataLength; i < I; i++){
                     data[i] = bytes[l++];
                 }
                 break;
@@ -2882,7 +2939,7 @@ namespace MidiMessage {
                 break;
 
             case SysExRtMobileCmdIdFollowMidiChannels:
-                for (uint8_t i = 0, I = length - 9; i < I; i++){
+                for (size_t i = 0, I = length - 9; i < I; i++){
                      data[i] = bytes[l++];
                 }
                 *dataLength = length - 9;
@@ -2908,7 +2965,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtMobilePhoneControlObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExRtMobilePhoneControlObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT(msg!=NULL);
         ASSERT(msg->Data.SysEx.ByteData != NULL);
 
@@ -2929,14 +2986,14 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExRtMidiShowControl( uint8_t * bytes, uint8_t deviceId, MidiShowControlData_t * msc ){
+    inline size_t packSysExRtMidiShowControl( uint8_t * bytes, uint8_t deviceId, MidiShowControlData_t * msc ){
         ASSERT( bytes != NULL );
         ASSERT( deviceId <= MaxU7 );
         ASSERT( msc != NULL );
         ASSERT( isSysExRtMscCmdFmt(msc->CommandFormat.Bytes[0]) );
         ASSERT( isSysExRtMscCmd(msc->Command.Bytes[0]) );
 
-        uint8_t len = 4;
+        size_t len = 4;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
@@ -3055,20 +3112,20 @@ namespace MidiMessage {
         return len;
     }
 
-    inline uint8_t packSysExRtMidiShowControlObj( uint8_t * bytes, Message_t * msg ){
+    inline size_t packSysExRtMidiShowControlObj( uint8_t * bytes, Message_t * msg ){
         ASSERT( msg != NULL );
 
         return packSysExRtMidiShowControl( bytes, msg->Channel, &msg->Data.SysEx.Data.MidiShowControl );
     }
 
 
-    inline bool unpackSysExRtMidiShowControl(uint8_t * bytes, uint8_t len, uint8_t * deviceId, MidiShowControlData_t * msc ) {
+    inline bool unpackSysExRtMidiShowControl(uint8_t * bytes, size_t len, uint8_t * deviceId, MidiShowControlData_t * msc ) {
         ASSERT( bytes != NULL );
         ASSERT( deviceId != NULL );
         ASSERT( msc != NULL );
 
 
-        if (len < 5) {
+        if (len < 7 || ! isControlByte(bytes[len-1])) {
             return false;
         }
         if (bytes[0] != SystemMessageSystemExclusive) {
@@ -3087,19 +3144,65 @@ namespace MidiMessage {
             return false;
         }
 
-        uint8_t pos = 4;
+        size_t pos = 4;
 
         *deviceId = bytes[2];
 
+        // (all fields must precede the terminating byte)
+        if ( ! isExtensibleValueWithin( &bytes[pos], len - 1 - pos ) ){
+            return false;
+        }
+
         pos += copyExtensibleValueBytes( msc->CommandFormat.Bytes, &bytes[pos], true );
 
         if ( ! isSysExRtMscCmd(msc->CommandFormat.Bytes[0]) ){
             return false;
         }
 
+        if ( ! isExtensibleValueWithin( &bytes[pos], len - 1 - pos ) ){
+            return false;
+        }
+
 //        ASSERT(false);
         pos += copyExtensibleValueBytes( msc->Command.Bytes, &bytes[pos], true );
 
+        // number of bytes of fixed size fields (before any cue number)
+        size_t fixed = 0;
+
+        switch( msc->Command.Bytes[0] ){
+            case SysExRtMscCmdTimedGo:
+            case SysExRtMscCmdSetClock:
+                fixed = 5;
+                break;
+
+            case SysExRtMscCmdSet:
+            case SysExRtMscCmdStandingBy:
+                fixed = 9;
+                break;
+
+            case SysExRtMscCmdFire:
+                fixed = 1;
+                break;
+
+            case SysExRtMscCmdStandby:
+            case SysExRtMscCmdGo2Pc:
+                fixed = 8;
+                break;
+
+            case SysExRtMscCmdComplete:
+            case SysExRtMscCmdCancel:
+                fixed = 4;
+                break;
+
+            case SysExRtMscCmdCancelled:
+            case SysExRtMscCmdAbort:
+                fixed = 6;
+                break;
+        }
+
+        if (pos + fixed > len - 1){
+            return false;
+        }
 
         switch( msc->Command.Bytes[0] ){
             case SysExRtMscCmdGo:
@@ -3113,7 +3216,7 @@ namespace MidiMessage {
                 break;
 
             case SysExRtMscCmdTimedGo:
-                pos += unpackMidiTimeCodeLong( &bytes[len], &msc->MidiTimeCode );
+                pos += unpackMidiTimeCodeLong( &bytes[pos], &msc->MidiTimeCode );
                 pos += unpackMscCueNumber( &bytes[pos], len - pos, &msc->CueNumber.Number, &msc->CueNumber.List, &msc->CueNumber.Path );
                 break;
 
@@ -3191,7 +3294,7 @@ namespace MidiMessage {
                 pos += unpackSysExRtMscStatus( &bytes[pos], &msc->Status );
                 msc->SequenceNumber = unpackU14( &bytes[pos]);
                 pos += 2;
-                pos += unpackMscCueNumber( &bytes[len], len - pos, &msc->CueNumber.Number, &msc->CueNumber.List, &msc->CueNumber.Path );
+                pos += unpackMscCueNumber( &bytes[pos], len - pos, &msc->CueNumber.Number, &msc->CueNumber.List, &msc->CueNumber.Path );
                 break;
 
             case SysExRtMscCmdAllOff:
@@ -3208,7 +3311,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtMidiShowControlObj(uint8_t * bytes, uint8_t length, Message_t * msg ) {
+    inline bool unpackSysExRtMidiShowControlObj(uint8_t * bytes, size_t length, Message_t * msg ) {
         ASSERT( msg != NULL );
 
         if ( unpackSysExRtMidiShowControl(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.MidiShowControl) ){
@@ -3274,7 +3377,7 @@ namespace MidiMessage {
                                        msg->Data.SysEx.Data.SampleDump.Header.LoopType);
     }
 
-    inline bool unpackSysExNonRtSdsHeader(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *sampleFormat, uint32_t *samplePeriod, uint32_t *sampleLength, uint32_t *loopStartPoint, uint32_t *loopEndPoint, uint8_t *loopType ){
+    inline bool unpackSysExNonRtSdsHeader(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *sampleFormat, uint32_t *samplePeriod, uint32_t *sampleLength, uint32_t *loopStartPoint, uint32_t *loopEndPoint, uint8_t *loopType ){
         ASSERT( bytes!= NULL );
         ASSERT( deviceId != NULL );
         ASSERT( sampleNumber != NULL );
@@ -3309,7 +3412,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsHeaderObj(uint8_t * bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsHeaderObj(uint8_t * bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL);
 
         if (unpackSysExNonRtSdsHeader(bytes, length, &msg->Channel,
@@ -3333,7 +3436,7 @@ namespace MidiMessage {
 
 
 
-    inline uint8_t packSysExNonRtSdsDataPacket(uint8_t *bytes, uint8_t deviceId, uint8_t runningPacketCount, uint8_t * data, uint8_t dataLength, uint8_t checksum ){
+    inline size_t packSysExNonRtSdsDataPacket(uint8_t *bytes, uint8_t deviceId, uint8_t runningPacketCount, uint8_t * data, size_t dataLength, uint8_t checksum ){
 
         ASSERT( bytes!= NULL );
         ASSERT( deviceId <= MaxU7 );
@@ -3341,7 +3444,7 @@ namespace MidiMessage {
         ASSERT( dataLength == 0 || data != NULL );
         ASSERT( dataLength <= MaxU7 );
 
-        uint8_t length = MsgLenSysExNonRtSdsDataPacketMin - 2; // minus checksum + EOX
+        size_t length = MsgLenSysExNonRtSdsDataPacketMin - 2; // minus checksum + EOX
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -3350,7 +3453,7 @@ namespace MidiMessage {
 
         bytes[4] = runningPacketCount;
 
-        for (uint8_t i = 0; i < dataLength; i++, length++){
+        for (size_t i = 0; i < dataLength; i++, length++){
             bytes[length] = data[i];
         }
 
@@ -3367,14 +3470,17 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t packSysExNonRtSdsDataPacketObj(uint8_t * bytes, Message_t *msg){
+    inline size_t packSysExNonRtSdsDataPacketObj(uint8_t * bytes, Message_t *msg){
         ASSERT( msg != NULL);
 
         return packSysExNonRtSdsDataPacket(bytes, msg->Channel, msg->Data.SysEx.Data.SampleDump.DataPacket.RunningPacketCount, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length, msg->Data.SysEx.Data.SampleDump.DataPacket.Checksum );
     }
 
 
-    inline bool unpackSysExNonRtSdsDataPacket(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *runningPacketCount, uint8_t * data, uint8_t * dataLength, uint8_t *checksum, uint8_t *checksumVerification ){
+    /**
+     * Like unpackSysExNonRtSdsDataPacket() but instead of copying the sample data <data> is set to point into <bytes>.
+     */
+    inline bool unpackSysExNonRtSdsDataPacketView(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *runningPacketCount, uint8_t ** data, size_t * dataLength, uint8_t *checksum, uint8_t *checksumVerification ){
 
         ASSERT( bytes!= NULL );
         ASSERT( deviceId != NULL );
@@ -3396,14 +3502,8 @@ namespace MidiMessage {
 
         *runningPacketCount = bytes[4];
 
-        *dataLength = 0;
-
-        if (length > MsgLenSysExNonRtSdsDataPacketMin){
-            *dataLength = length - MsgLenSysExNonRtSdsDataPacketMin;
-            for(uint8_t p = 5, i = 0; i < *dataLength; i++, p++){
-                data[i] = bytes[p];
-            }
-        }
+        *data = &bytes[5];
+        *dataLength = length - MsgLenSysExNonRtSdsDataPacketMin;
 
         *checksum = bytes[length-2];
 
@@ -3412,13 +3512,29 @@ namespace MidiMessage {
         return true;
     }
 
+    inline bool unpackSysExNonRtSdsDataPacket(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *runningPacketCount, uint8_t * data, size_t * dataLength, uint8_t *checksum, uint8_t *checksumVerification ){
+        ASSERT( data != NULL );
+
+        uint8_t * view;
+
+        if ( ! unpackSysExNonRtSdsDataPacketView(bytes, length, deviceId, runningPacketCount, &view, dataLength, checksum, checksumVerification) ){
+            return false;
+        }
+
+        for(size_t i = 0; i < *dataLength; i++){
+            data[i] = view[i];
+        }
+
+        return true;
+    }
+
 //    inline bool unpackSysExNonRtSampleDataPacket(uint8_t *bytes, uint8_t length, uint8_t *deviceId, SysExNonRtSdsDataPacketData_t * data ){
 //        ASSERT( data != NULL );
 //
 //        return unpackSysExNonRtSdsDataPacket(bytes, length, deviceId, &data->RunningPacketCount, data->Data, &data->Length, &data->Checksum, &data->ChecksumVerification );
 //    }
 
-    inline bool unpackSysExNonRtSdsDataPacketObj(uint8_t * bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsDataPacketObj(uint8_t * bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL);
 
 
@@ -3433,6 +3549,21 @@ namespace MidiMessage {
         return false;
     }
 
+    inline bool unpackSysExNonRtSdsDataPacketViewObj(uint8_t * bytes, size_t length, Message_t *msg){
+        ASSERT( msg != NULL);
+
+
+        if (unpackSysExNonRtSdsDataPacketView(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.DataPacket.RunningPacketCount, &msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length, &msg->Data.SysEx.Data.SampleDump.DataPacket.Checksum, &msg->Data.SysEx.Data.SampleDump.DataPacket.ChecksumVerification )){
+            msg->StatusClass = StatusClassSystemMessage;
+            msg->SystemMessage = SystemMessageSystemExclusive;
+            msg->Data.SysEx.Id = SysExIdNonRealTime;
+            msg->Data.SysEx.SubId1 = SysExNonRtSampleDataPacket;
+            return true;
+        }
+
+        return false;
+    }
+
     inline uint8_t packSysExNonRtSdsRequest(uint8_t *bytes, uint8_t deviceId, uint16_t sampleNumber ){
 
         ASSERT( bytes!= NULL );
@@ -3458,7 +3589,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsRequest(uint8_t *bytes, uint8_t length, uint8_t * deviceId, uint16_t * sampleNumber ){
+    inline bool unpackSysExNonRtSdsRequest(uint8_t *bytes, size_t length, uint8_t * deviceId, uint16_t * sampleNumber ){
 
         ASSERT( bytes!= NULL );
         ASSERT( deviceId != NULL );
@@ -3477,7 +3608,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsRequestObj(uint8_t * bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsRequestObj(uint8_t * bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL);
 
         if (unpackSysExNonRtSdsRequest(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.Request.SampleNumber)){
@@ -3550,7 +3681,7 @@ namespace MidiMessage {
         );
     }
 
-    inline bool unpackSysExNonRtSdsExtHeader(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *sampleFormat, uint32_t *sampleRateIntegerPortion, uint32_t *sampleRateFractionalPortion, uint64_t *sampleLength, uint64_t *sustainLoopStart, uint64_t *sustainLoopEnd, uint8_t *loopType, uint8_t *numberofChannels){
+    inline bool unpackSysExNonRtSdsExtHeader(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *sampleFormat, uint32_t *sampleRateIntegerPortion, uint32_t *sampleRateFractionalPortion, uint64_t *sampleLength, uint64_t *sustainLoopStart, uint64_t *sustainLoopEnd, uint8_t *loopType, uint8_t *numberofChannels){
         ASSERT( bytes != NULL );
         ASSERT( deviceId != NULL);
         ASSERT(sampleNumber != NULL);
@@ -3571,6 +3702,7 @@ namespace MidiMessage {
             return false;
         }
 
+        *deviceId = bytes[2];
         *sampleNumber = unpackU14( &bytes[5]);
 
         *sampleFormat = bytes[7];
@@ -3588,7 +3720,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsExtHeaderObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExNonRtSdsExtHeaderObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT( msg != NULL );
 
         if (unpackSysExNonRtSdsExtHeader(bytes, length, &msg->Channel,
@@ -3653,7 +3785,7 @@ namespace MidiMessage {
         );
     }
 
-    inline bool unpackSysExNonRtSdsLoopPointTransmission(uint8_t * bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber, uint8_t *loopType, uint32_t *loopStartAddress, uint32_t *loopEndAddress){
+    inline bool unpackSysExNonRtSdsLoopPointTransmission(uint8_t * bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber, uint8_t *loopType, uint32_t *loopStartAddress, uint32_t *loopEndAddress){
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(sampleNumber != NULL);
@@ -3682,7 +3814,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsLoopPointTransmissionObj(uint8_t *bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExNonRtSdsLoopPointTransmissionObj(uint8_t *bytes, size_t length, Message_t * msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtSdsLoopPointTransmission(bytes, length, &msg->Channel,
@@ -3735,7 +3867,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsLoopPointRequest(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber){
+    inline bool unpackSysExNonRtSdsLoopPointRequest(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber){
         ASSERT( bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(sampleNumber != NULL);
@@ -3756,7 +3888,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsLoopPointRequestObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsLoopPointRequestObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtSdsLoopPointRequest( bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.LoopPointRequest.SampleNumber, &msg->Data.SysEx.Data.SampleDump.LoopPointRequest.LoopNumber)){
@@ -3818,7 +3950,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsExtLoopPointTransmission(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber, uint8_t *loopType, uint64_t *loopStartAddress, uint64_t *loopEndAddress){
+    inline bool unpackSysExNonRtSdsExtLoopPointTransmission(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber, uint8_t *loopType, uint64_t *loopStartAddress, uint64_t *loopEndAddress){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!=NULL);
         ASSERT(sampleNumber !=NULL);
@@ -3835,6 +3967,7 @@ namespace MidiMessage {
             return false;
         }
 
+        *deviceId = bytes[2];
         *sampleNumber = unpackU14( &bytes[5]);
         *loopNumber = unpackU14( &bytes[7]);
 
@@ -3848,7 +3981,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsExtLoopPointTransmissionObj(uint8_t *bytes, uint8_t length,  Message_t *msg){
+    inline bool unpackSysExNonRtSdsExtLoopPointTransmissionObj(uint8_t *bytes, size_t length,  Message_t *msg){
         ASSERT( msg != NULL);
 
         if (unpackSysExNonRtSdsExtLoopPointTransmission(bytes, length, &msg->Channel,
@@ -3901,7 +4034,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsExtLoopPointRequest(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber){
+    inline bool unpackSysExNonRtSdsExtLoopPointRequest(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint16_t *loopNumber){
         ASSERT( bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(sampleNumber != NULL);
@@ -3922,7 +4055,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsExtLoopPointRequestObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsExtLoopPointRequestObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtSdsExtLoopPointRequest( bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.SampleNumber, &msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.LoopNumber)){
@@ -3937,7 +4070,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExNonRtSdsSampleNameTransmission(uint8_t *bytes, uint8_t deviceId, uint16_t sampleNumber, uint8_t languageTagLength, uint8_t nameLength, uint8_t * data){
+    inline size_t packSysExNonRtSdsSampleNameTransmission(uint8_t *bytes, uint8_t deviceId, uint16_t sampleNumber, uint8_t languageTagLength, uint8_t nameLength, uint8_t * data){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId<=MaxU7);
         ASSERT(sampleNumber <= MaxU14);
@@ -3945,7 +4078,7 @@ namespace MidiMessage {
         ASSERT(nameLength <= MaxU7);
         ASSERT(data !=NULL);
 
-        uint8_t length = 8;
+        size_t length = 8;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -3973,7 +4106,7 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t packSysExNonRtSdsSampleNameTransmissionObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtSdsSampleNameTransmissionObj(uint8_t *bytes, Message_t *msg){
         ASSERT( msg != NULL);
         ASSERT( msg->StatusClass == StatusClassSystemMessage);
         ASSERT(msg->SystemMessage == SystemMessageSystemExclusive);
@@ -3984,7 +4117,7 @@ namespace MidiMessage {
         return packSysExNonRtSdsSampleNameTransmission(bytes, msg->Channel, msg->Data.SysEx.Data.SampleDump.NameTransmission.SampleNumber, msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength, msg->Data.SysEx.Data.SampleDump.NameTransmission.NameLength, msg->Data.SysEx.ByteData);
     }
 
-    inline bool unpackSysExNonRtSdsSampleNameTransmission(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *languageTagLength, uint8_t *nameLength, uint8_t *data){
+    inline bool unpackSysExNonRtSdsSampleNameTransmission(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber, uint8_t *languageTagLength, uint8_t *nameLength, uint8_t *data){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!= NULL);
         ASSERT(sampleNumber != NULL);
@@ -3993,7 +4126,7 @@ namespace MidiMessage {
         ASSERT(nameLength != NULL);
 //        ASSERT(name != NULL);
 
-        uint8_t pos = 8;
+        size_t pos = 8;
 
         if (length < 8 || ! isControlByte(bytes[length-1])){
             return false;
@@ -4007,16 +4140,25 @@ namespace MidiMessage {
 
         *languageTagLength = bytes[7];
 
-        uint8_t d = 0;
+        // language tag and name length must precede the terminating byte
+        if (pos + *languageTagLength >= length - 1){
+            return false;
+        }
+
+        size_t d = 0;
 
-        for(uint8_t i = 0; i < *languageTagLength; i++){
+        for(size_t i = 0; i < *languageTagLength; i++){
             data[d++] = bytes[pos++];
         }
 //        data[d++] = '\0';
 
         *nameLength = bytes[pos++];
 
-        for(uint8_t i = 0; i < *nameLength; i++){
+        if (pos + *nameLength > length - 1){
+            return false;
+        }
+
+        for(size_t i = 0; i < *nameLength; i++){
             data[d++] = bytes[pos++];
         }
 //        data[d++] = '\0';
@@ -4025,7 +4167,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtSdsSampleNameTransmissionObj(uint8_t *bytes,uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsSampleNameTransmissionObj(uint8_t *bytes,size_t length, Message_t *msg){
         ASSERT( msg != NULL);
 
         if (unpackSysExNonRtSdsSampleNameTransmission(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.NameTransmission.SampleNumber, &msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength, &msg->Data.SysEx.Data.SampleDump.NameTransmission.NameLength, msg->Data.SysEx.ByteData)){
@@ -4070,7 +4212,7 @@ namespace MidiMessage {
         return packSysExNonRtSdsSampleNameRequest( bytes, msg->Channel, msg->Data.SysEx.Data.SampleDump.NameRequest.SampleNumber);
     }
 
-    inline bool unpackSysExNonRtSdsSampleNameRequest(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint16_t *sampleNumber){
+    inline bool unpackSysExNonRtSdsSampleNameRequest(uint8_t *bytes, size_t length, uint8_t *deviceId, uint16_t *sampleNumber){
         ASSERT( bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(sampleNumber != NULL);
@@ -4089,7 +4231,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtSdsSampleNameRequestObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsSampleNameRequestObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtSdsSampleNameRequest( bytes, length, &msg->Channel, &msg->Data.SysEx.Data.SampleDump.NameRequest.SampleNumber)){
@@ -4105,7 +4247,7 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t packSysExNonRtSdsExtObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtSdsExtObj(uint8_t *bytes, Message_t *msg){
         ASSERT( msg != NULL );
         ASSERT( isSysExNonRtSds(msg->Data.SysEx.SubId2) );
 
@@ -4137,7 +4279,7 @@ namespace MidiMessage {
     }
 
 
-    inline uint8_t unpackSysExNonRtSdsExtObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtSdsExtObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT( msg != NULL );
 
 
@@ -4174,14 +4316,14 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExNonRtMvcSetParameter(uint8_t *bytes, uint8_t deviceId, uint32_t parameterAddress, uint8_t * data, uint8_t dataLength){
+    inline size_t packSysExNonRtMvcSetParameter(uint8_t *bytes, uint8_t deviceId, uint32_t parameterAddress, uint8_t * data, size_t dataLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId<=MaxU7);
         ASSERT(isSysExNonRtMvcAddress(parameterAddress));
         ASSERT(data!=NULL);
         ASSERT(dataLength>0);
 
-        uint8_t length = 8;
+        size_t length = 8;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -4192,7 +4334,7 @@ namespace MidiMessage {
         bytes[6] = (parameterAddress >> 8) & DataMask;
         bytes[7] = parameterAddress & DataMask;
 
-        for(uint8_t i = 0; i < dataLength; i++){
+        for(size_t i = 0; i < dataLength; i++){
             bytes[length++] = data[i];
         }
 
@@ -4201,7 +4343,7 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExNonRtMvcSetParameterObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtMvcSetParameterObj(uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
         ASSERT(msg->StatusClass == StatusClassSystemMessage);
         ASSERT(msg->SystemMessage == SystemMessageSystemExclusive);
@@ -4212,7 +4354,7 @@ namespace MidiMessage {
         return packSysExNonRtMvcSetParameter(bytes, msg->Channel, msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExNonRtMvcSetParameter(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint32_t *parameterAddress, uint8_t * data, uint8_t *dataLength){
+    inline bool unpackSysExNonRtMvcSetParameter(uint8_t *bytes, size_t length, uint8_t *deviceId, uint32_t *parameterAddress, uint8_t * data, size_t *dataLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!=NULL);
         ASSERT(parameterAddress!=NULL);
@@ -4232,14 +4374,14 @@ namespace MidiMessage {
 
         *dataLength = length - 9;
 
-        for(uint8_t i = 0, b = 8; i < *dataLength; i++, b++){
+        for(size_t i = 0, b = 8; i < *dataLength; i++, b++){
             data[i] = bytes[b];
         }
 
         return true;
     }
 
-    inline bool unpackSysExNonRtMvcSetParameterObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtMvcSetParameterObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         if (unpackSysExNonRtMvcSetParameter(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)){
@@ -4287,7 +4429,7 @@ namespace MidiMessage {
         return packSysExNonRtTuningBulkDumpRequest(bytes, msg->Channel, msg->Data.SysEx.Data.Tuning.BulkDumpRequest.TuningProgram );
     }
 
-    inline bool unpackSysExNonRtTuningBulkDumpRequest(uint8_t * bytes, uint8_t length, uint8_t *deviceId, uint8_t *tuningProgram){
+    inline bool unpackSysExNonRtTuningBulkDumpRequest(uint8_t * bytes, size_t length, uint8_t *deviceId, uint8_t *tuningProgram){
         ASSERT(bytes != NULL);
         ASSERT(deviceId != NULL);
         ASSERT(tuningProgram != NULL);
@@ -4305,7 +4447,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtTuningBulkDumpRequestObj(uint8_t * bytes, uint8_t length, Message_t * msg){
+    inline bool unpackSysExNonRtTuningBulkDumpRequestObj(uint8_t * bytes, size_t length, Message_t * msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExNonRtTuningBulkDumpRequest(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.Tuning.BulkDumpRequest.TuningProgram)){
@@ -4353,7 +4495,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExNonRtTuningObj(uint8_t * bytes, uint8_t length, Message_t *msg ){
+    inline bool unpackSysExNonRtTuningObj(uint8_t * bytes, size_t length, Message_t *msg ){
 
         switch(bytes[4]){
             case SysExNonRtMtsBulkDumpRequest:
@@ -4389,13 +4531,13 @@ namespace MidiMessage {
 /////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////
 
-    inline uint8_t packSysExNonRtFileDumpRequest( uint8_t *bytes, uint8_t deviceId, uint8_t senderId, uint8_t type[4], uint8_t * name, uint8_t nameLen){
+    inline size_t packSysExNonRtFileDumpRequest( uint8_t *bytes, uint8_t deviceId, uint8_t senderId, uint8_t type[4], uint8_t * name, size_t nameLen){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId<=MaxU7);
         ASSERT(senderId<MaxU7); // can not be broadcast
         ASSERT(name!=NULL);
 
-        uint8_t length = 10;
+        size_t length = 10;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -4408,7 +4550,7 @@ namespace MidiMessage {
         bytes[8] = type[2];
         bytes[9] = type[3];
 
-        for(uint8_t i = 0; i < nameLen; i++){
+        for(size_t i = 0; i < nameLen; i++){
             bytes[length++] = name[i];
         }
 
@@ -4417,7 +4559,7 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExNonRtFileDumpRequestObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtFileDumpRequestObj(uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
         ASSERT(msg->StatusClass == StatusClassSystemMessage);
         ASSERT(msg->SystemMessage == SystemMessageSystemExclusive);
@@ -4428,7 +4570,7 @@ namespace MidiMessage {
         return packSysExNonRtFileDumpRequest(bytes, msg->Channel, msg->Data.SysEx.Data.FileDump.SourceDeviceId, msg->Data.SysEx.Data.FileDump.Type, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExNonRtFileDumpRequest(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *senderId, uint8_t type[4], uint8_t *name, uint8_t *nameLength){
+    inline bool unpackSysExNonRtFileDumpRequest(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *senderId, uint8_t type[4], uint8_t *name, size_t *nameLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!=NULL);
         ASSERT(senderId!=NULL);
@@ -4452,8 +4594,8 @@ namespace MidiMessage {
 
         length--;
 
-        uint8_t l = 0;
-        for(uint8_t b = 10; b < length; b++){
+        size_t l = 0;
+        for(size_t b = 10; b < length; b++){
             name[l++] = bytes[b];
         }
 
@@ -4462,7 +4604,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtFileDumpRequestObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtFileDumpRequestObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         if (unpackSysExNonRtFileDumpRequest(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.FileDump.SourceDeviceId, msg->Data.SysEx.Data.FileDump.Type, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)){
@@ -4477,14 +4619,14 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExNonRtFileDumpHeader(uint8_t *bytes, uint8_t deviceId, uint8_t senderId, uint8_t type[4], uint32_t fileLength, uint8_t *name, uint8_t nameLength){
+    inline size_t packSysExNonRtFileDumpHeader(uint8_t *bytes, uint8_t deviceId, uint8_t senderId, uint8_t type[4], uint32_t fileLength, uint8_t *name, size_t nameLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId<=MaxU7);
         ASSERT(senderId<MaxU7);
         ASSERT(type!=NULL);
         ASSERT(name!=NULL);
         
-        uint8_t length = 14;
+        size_t length = 14;
         
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -4499,7 +4641,7 @@ namespace MidiMessage {
 
         packU28(&bytes[10], fileLength);
 
-        for(uint8_t i = 0; i < nameLength; i++){
+        for(size_t i = 0; i < nameLength; i++){
             bytes[length++] = name[i];
         }
 
@@ -4508,13 +4650,13 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExNonRtFileDumpHeaderObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtFileDumpHeaderObj(uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
 
         return packSysExNonRtFileDumpHeader(bytes, msg->Channel, msg->Data.SysEx.Data.FileDump.SourceDeviceId, msg->Data.SysEx.Data.FileDump.Type, msg->Data.SysEx.Data.FileDump.FileLength, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
     }
 
-    inline bool unpackSysExNonRtFileDumpHeader(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *senderId, uint8_t type[4], uint32_t *fileLength, uint8_t *name, uint8_t *nameLength){
+    inline bool unpackSysExNonRtFileDumpHeader(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *senderId, uint8_t type[4], uint32_t *fileLength, uint8_t *name, size_t *nameLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!=NULL);
         ASSERT(senderId!=NULL);
@@ -4541,8 +4683,8 @@ namespace MidiMessage {
 
         length--;
 
-        uint8_t l = 0;
-        for(uint8_t b = 14; b < length; b++){
+        size_t l = 0;
+        for(size_t b = 14; b < length; b++){
             name[l++] = bytes[b];
         }
 
@@ -4551,7 +4693,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExNonRtFileDumpHeaderObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtFileDumpHeaderObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         if (unpackSysExNonRtFileDumpHeader(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.FileDump.SourceDeviceId, msg->Data.SysEx.Data.FileDump.Type, &msg->Data.SysEx.Data.FileDump.FileLength, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length)){
@@ -4566,14 +4708,14 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExNonRtFileDumpDataPacket(uint8_t *bytes, uint8_t deviceId, uint8_t packetNumber, uint8_t *data, uint8_t dataLength, uint8_t checksum){
+    inline size_t packSysExNonRtFileDumpDataPacket(uint8_t *bytes, uint8_t deviceId, uint8_t packetNumber, uint8_t *data, size_t dataLength, uint8_t checksum){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId<=MaxU7);
         ASSERT(packetNumber<=MaxU7);
         ASSERT(dataLength>0);
         ASSERT(dataLength<=MaxU7);
 
-        uint8_t length = 7;
+        size_t length = 7;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdNonRealTime_Byte;
@@ -4598,7 +4740,7 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExNonRtFileDumpDataPacketObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtFileDumpDataPacketObj(uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
         ASSERT(msg->StatusClass == StatusClassSystemMessage);
         ASSERT(msg->SystemMessage == SystemMessageSystemExclusive);
@@ -4609,7 +4751,7 @@ namespace MidiMessage {
         return packSysExNonRtFileDumpDataPacket(bytes, msg->Channel, msg->Data.SysEx.Data.FileDump.PacketNumber, msg->Data.SysEx.ByteData, msg->Data.SysEx.Length, msg->Data.SysEx.Data.FileDump.Checksum);
     }
 
-    inline bool unpackSysExNonRtFileDumpDataPacket(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *packetNumber, uint8_t *data, uint8_t *dataLength, uint8_t *checksum, uint8_t *checksumVerification){
+    inline bool unpackSysExNonRtFileDumpDataPacket(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *packetNumber, uint8_t *data, size_t *dataLength, uint8_t *checksum, uint8_t *checksumVerification){
         ASSERT(bytes != NULL);
         ASSERT(deviceId !=NULL);
         ASSERT(packetNumber!=NULL);
@@ -4625,7 +4767,7 @@ namespace MidiMessage {
             return false;
         }
 
-        uint8_t len = 7;
+        size_t len = 7;
 
         *deviceId = bytes[2];
         *packetNumber = bytes[5];
@@ -4643,7 +4785,7 @@ namespace MidiMessage {
 
 
 
-    inline bool unpackSysExNonRtFileDumpDataPacketObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtFileDumpDataPacketObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         if (unpackSysExNonRtFileDumpDataPacket(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.FileDump.PacketNumber, msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length, &msg->Data.SysEx.Data.FileDump.Checksum, &msg->Data.SysEx.Data.FileDump.ChecksumVerification)){
@@ -4658,7 +4800,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExNonRtFileDumpObj(uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExNonRtFileDumpObj(uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
 
         switch(msg->Data.SysEx.SubId2){
@@ -4675,7 +4817,7 @@ namespace MidiMessage {
         return 0;
     }
 
-    inline bool unpackSysExNonRtFileDumpObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExNonRtFileDumpObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         switch(bytes[4]){
@@ -4726,7 +4868,7 @@ namespace MidiMessage {
         return packSysExRtNotationInformationBarNumber(bytes, msg->Channel, msg->Data.SysEx.Data.NotationInformation.BarNumber);
     }
 
-    inline bool unpackSysExRtNotationInformationBarNumber(uint8_t *bytes, uint8_t length, uint8_t *deviceId, int16_t *barNumber){
+    inline bool unpackSysExRtNotationInformationBarNumber(uint8_t *bytes, size_t length, uint8_t *deviceId, int16_t *barNumber){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId !=NULL);
         ASSERT(barNumber!=NULL);
@@ -4745,7 +4887,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtNotationInformationBarNumberObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExRtNotationInformationBarNumberObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         if (unpackSysExRtNotationInformationBarNumber(bytes, length, &msg->Channel, &msg->Data.SysEx.Data.NotationInformation.BarNumber)){
@@ -4760,7 +4902,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExRtNotationInformationTimeSignature(uint8_t *bytes, uint8_t deviceId, uint8_t subId2, uint8_t timeSignatureNumerator, uint8_t timeSignatureDenominator, uint8_t midiClocksInMetronomeClick, uint8_t notes32sInMidiQuarterNote, uint8_t *addSignature, uint8_t addSignatureLength){
+    inline size_t packSysExRtNotationInformationTimeSignature(uint8_t *bytes, uint8_t deviceId, uint8_t subId2, uint8_t timeSignatureNumerator, uint8_t timeSignatureDenominator, uint8_t midiClocksInMetronomeClick, uint8_t notes32sInMidiQuarterNote, uint8_t *addSignature, uint8_t addSignatureLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId <= MaxU7);
         ASSERT(timeSignatureNumerator <= MaxU7);
@@ -4771,7 +4913,7 @@ namespace MidiMessage {
         ASSERT( addSignatureLength == 0 || addSignature != NULL);
         ASSERT( addSignatureLength % 2 == 0);
 
-        uint8_t length = 10;
+        size_t length = 10;
 
         bytes[0] = SystemMessageSystemExclusive;
         bytes[1] = SysExIdRealTime_Byte;
@@ -4795,7 +4937,7 @@ namespace MidiMessage {
         return length;
     }
 
-    inline uint8_t packSysExRtNotationInformationTimeSignatureObj(uint8_t *bytes, Message_t * msg){
+    inline size_t packSysExRtNotationInformationTimeSignatureObj(uint8_t *bytes, Message_t * msg){
         ASSERT(msg!=NULL);
         ASSERT(msg->StatusClass == StatusClassSystemMessage);
         ASSERT(msg->SystemMessage == SystemMessageSystemExclusive);
@@ -4812,7 +4954,7 @@ namespace MidiMessage {
         );
     }
 
-    inline bool unpackSysExRtNotationInformationTimeSignature(uint8_t *bytes, uint8_t length, uint8_t *deviceId, uint8_t *subId2, uint8_t *timeSignatureNumerator, uint8_t *timeSignatureDenominator, uint8_t *midiClocksInMetronomeClick, uint8_t *notes32sInMidiQuarterNote, uint8_t *addSignature, uint8_t *addSignatureLength){
+    inline bool unpackSysExRtNotationInformationTimeSignature(uint8_t *bytes, size_t length, uint8_t *deviceId, uint8_t *subId2, uint8_t *timeSignatureNumerator, uint8_t *timeSignatureDenominator, uint8_t *midiClocksInMetronomeClick, uint8_t *notes32sInMidiQuarterNote, uint8_t *addSignature, size_t *addSignatureLength){
         ASSERT(bytes!=NULL);
         ASSERT(deviceId!=NULL);
         ASSERT(subId2!=NULL);
@@ -4843,7 +4985,7 @@ namespace MidiMessage {
         *midiClocksInMetronomeClick = bytes[8];
         *notes32sInMidiQuarterNote = bytes[9];
 
-        for (uint8_t i = 0, b = 10; i < n; i++, b++){
+        for (size_t i = 0, b = 10; i < n; i++, b++){
             addSignature[i] = bytes[b];
         }
 
@@ -4852,7 +4994,7 @@ namespace MidiMessage {
         return true;
     }
 
-    inline bool unpackSysExRtNotationInformationTimeSignatureObj(uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExRtNotationInformationTimeSignatureObj(uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg != NULL);
 
         if (unpackSysExRtNotationInformationTimeSignature(bytes, length, &msg->Channel, &msg->Data.SysEx.SubId2,
@@ -4872,7 +5014,7 @@ namespace MidiMessage {
         return false;
     }
 
-    inline uint8_t packSysExRtNotationInformationObj( uint8_t *bytes, Message_t *msg){
+    inline size_t packSysExRtNotationInformationObj( uint8_t *bytes, Message_t *msg){
         ASSERT(msg!=NULL);
 
         switch(msg->Data.SysEx.SubId2){
@@ -4888,7 +5030,7 @@ namespace MidiMessage {
     }
 
 
-    inline bool unpackSysExRtNotationInformationObj( uint8_t *bytes, uint8_t length, Message_t *msg){
+    inline bool unpackSysExRtNotationInformationObj( uint8_t *bytes, size_t length, Message_t *msg){
         ASSERT(msg!=NULL);
 
         switch(bytes[4]){
@@ -12,10 +12,22 @@ namespace MidiMessage {
     extern "C" {
 #endif
 
+    /**
+     * Events passed to the SysEx handler of a parser in streaming mode.
+     */
+    typedef enum {
+        ParserSysExEventBegin   = 0, // bytes points to the initial SysEx byte (F0)
+        ParserSysExEventData    = 1, // bytes points to a chunk of data bytes
+        ParserSysExEventEnd     = 2  // bytes points to the terminating EOX (or is NULL if terminated by another status byte)
+    } ParserSysExEvent_t;
+
     /**
      * Parser for continuous parsing of incoming byte stream.
      *
      * Can deal with Running Status (if enabled) and interleaved System Real Time Messages (see MIDI spec).
+     *
+     * If a SysEx handler is set (see parser_setSysExHandler()) SysEx messages are not buffered but streamed in chunks
+     * pointing directly into the received data, thus SysEx messages of any length can be processed with constant memory.
      */
 
     typedef struct {
@@ -23,7 +35,7 @@ namespace MidiMessage {
         bool RunningStatusEnabled;
 
         uint8_t *Buffer;
-        uint8_t MaxLength;
+        size_t MaxLength;
 
         Message_t *Message;
 
@@ -31,25 +43,194 @@ namespace MidiMessage {
 
         void (*MessageHandler)(Message_t *message, void *context);
 
-        void (*DiscardingDataHandler)(uint8_t *bytes, uint8_t length, void *context);
+        void (*DiscardingDataHandler)(uint8_t *bytes, size_t length, void *context);
+
+        size_t Length;
+
+        void (*SysExHandler)(ParserSysExEvent_t event, uint8_t *bytes, size_t length, void *context);
+
+        bool SysExStreaming;
+
+        bool SysExViewsEnabled;
 
-        uint8_t Length;
+        void (*ShortMessageHandler)(ShortMessage_t message, void *context);
+
+        // the buffer holds a SysEx (terminated by another status byte) that was emitted but is yet to be passed to
+        // the discarding data handler (after the message handler)
+        bool DiscardPending;
 
     } Parser_t;
 
 
-    void parser_init(Parser_t * parser, bool runningStatusEnabled, uint8_t * buffer, uint8_t maxLength, Message_t * msg, void (*messageHandler)(Message_t * message, void * context), void (*discardingDataHandler)(uint8_t * bytes, uint8_t length, void * context), void * context);
+    /**
+     * Length at which a buffered Universal (Non-)Realtime SysEx message is complete without EOX, as given by its
+     * sub-ids (see unpack()). Returns 0 if the message can only be completed by a control byte or if the sub-ids are
+     * yet unknown.
+     *
+     * NOTE: MIDI Show Control messages are only complete with a control byte.
+     */
+    inline size_t parser_sysExCompleteLength( uint8_t * buffer, size_t length ){
+
+        if (length < 4){
+            return 0;
+        }
+
+        if (buffer[1] == SysExIdNonRealTime_Byte){
+
+            if (isSysExNonRtHandshake(buffer[3])){
+                return MsgLenSysExNonRtGeneralHandshaking;
+            }
+
+            if (length < 5 || buffer[3] != SysExNonRtGeneralInformation){
+                return 0;
+            }
+
+            if (buffer[4] == SysExNonRtGenInfoIdentityRequest){
+                return MsgLenSysExNonRtGenInfoIdentityRequest - 1;
+            }
+
+            // (the unpacker expects a three byte manufacturer id)
+            if (buffer[4] == SysExNonRtGenInfoIdentityReply){
+                return MsgLenSysExNonRtGenInfoIdentityReply + 1;
+            }
+
+            return 0;
+        }
+
+        if (buffer[1] == SysExIdRealTime_Byte){
+
+            if (length < 5 || buffer[3] != SysExRtMidiTimeCode){
+                return 0;
+            }
+
+            if (buffer[4] == SysExRtMtcFullMessage){
+                return MsgLenSysExRtMtcFullMessage - 1;
+            }
+
+            if (buffer[4] == SysExRtMtcUserBits){
+                return MsgLenSysExRtMtcUserBits;
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * Tells wether the buffered bytes may possibly form a complete message, so that unpack() is not called needlessly
+     * after every single byte.
+     *
+     * Non-SysEx messages can only be complete when their expected length (as given by the status byte) is reached.
+     * Universal (Non-)Realtime SysEx messages may be complete without EOX at the length given by their sub-ids (see
+     * parser_sysExCompleteLength()), whereas all other SysEx messages require a terminating control byte.
+     */
+    inline bool parser_isCompletable( uint8_t * buffer, size_t length, uint8_t lastByte ){
+
+        if (buffer[0] == SystemMessageSystemExclusive){
+            if (isControlByte(lastByte)){
+                return length > 1;
+            }
+            return length == parser_sysExCompleteLength(buffer, length);
+        }
+
+        // a stray EOX is accepted as single byte system message
+        if (buffer[0] == SystemMessageEndOfExclusive){
+            return length == MsgLenSystemMessage;
+        }
+
+        return length == getMsgLen(buffer[0]);
+    }
+
+    /**
+     * Maximum number of data bytes that can be appended to a buffered SysEx message (of at least two bytes) without
+     * possibly completing it, ie that may be copied as a whole instead of being checked one by one.
+     */
+    inline size_t parser_sysExDataRun( uint8_t * buffer, size_t length ){
+
+        if (buffer[1] != SysExIdRealTime_Byte && buffer[1] != SysExIdNonRealTime_Byte){
+            return SIZE_MAX;
+        }
+
+        // sub-ids yet unknown
+        if (length < 5){
+            return 0;
+        }
+
+        size_t complete = parser_sysExCompleteLength(buffer, length);
+
+        if (complete <= length){
+            return SIZE_MAX;
+        }
+
+        return complete - 1 - length;
+    }
+
+    void parser_init(Parser_t * parser, bool runningStatusEnabled, uint8_t * buffer, size_t maxLength, Message_t * msg, void (*messageHandler)(Message_t * message, void * context), void (*discardingDataHandler)(uint8_t * bytes, size_t length, void * context), void * context);
 
     inline void parser_reset(Parser_t * parser) {
         parser->Length = 0;
         parser->Buffer[0] = 0;
+        parser->SysExStreaming = false;
+        parser->DiscardPending = false;
+    }
+
+    /**
+     * Enables (or disables if NULL) streaming mode for SysEx messages.
+     *
+     * In streaming mode any SysEx message is passed to the handler as a Begin event, any number of Data events and
+     * an End event instead of being passed to the message handler. The concatenated chunks form the original
+     * message. Data chunks are never copied, ie they are only valid during the handler call.
+     *
+     * @param sysExHandler  handler to receive SysEx events (NULL to disable streaming mode)
+     */
+    inline void parser_setSysExHandler(Parser_t * parser, void (*sysExHandler)(ParserSysExEvent_t event, uint8_t * bytes, size_t length, void * context)) {
+        parser->SysExHandler = sysExHandler;
+        parser->SysExStreaming = false;
+    }
+
+    /**
+     * Enables (or disables) unpacking of SysEx messages as views (see unpackView()), ie the payload of experimental,
+     * manufacturer and sample dump data packet messages is not copied but points into the parser's buffer.
+     *
+     * With parser_receivedData() the message's own SysEx.ByteData is restored after each message handler call.
+     * With parser_receivedDataBatch() views are only valid until the next message is parsed and the caller has to
+     * restore SysEx.ByteData of the messages itself.
+     */
+    inline void parser_setSysExViewsEnabled(Parser_t * parser, bool enabled) {
+        parser->SysExViewsEnabled = enabled;
+    }
+
+    /**
+     * Sets (or unsets if NULL) a handler for compact messages (see ShortMessage_t).
+     *
+     * If set, channel voice and system real time messages are passed to this handler (instead of the message handler,
+     * nor are they stored by parser_receivedDataBatch()), thereby skipping the unpacking into a Message_t.
+     */
+    inline void parser_setShortMessageHandler(Parser_t * parser, void (*shortMessageHandler)(ShortMessage_t message, void * context)) {
+        parser->ShortMessageHandler = shortMessageHandler;
     }
 
     /**
      * @param data      incoming data buffer
      * @param len       length of incoming data
      */
-    void parser_receivedData(Parser_t * parser, uint8_t * data, uint8_t len);
+    void parser_receivedData(Parser_t * parser, uint8_t * data, size_t len);
+
+    /**
+     * Like parser_receivedData() but instead of calling the message handler parsed messages are stored in the given
+     * array. Stops as soon as the array is full (or after a SysEx terminated by a status byte other than EOX, which
+     * is then passed to the discarding data handler on the next call), ie the remaining data must be passed again.
+     *
+     * Note: any message's SysEx.ByteData must point to a sufficiently large buffer (as with the parser's own message).
+     *
+     * @param data          incoming data buffer
+     * @param len           length of incoming data
+     * @param messages      array to be filled with parsed messages
+     * @param offsets       (optional) array to be filled with offset of the respective message's last byte in data
+     * @param maxMessages   size of arrays
+     * @param consumed      (optional) number of bytes processed
+     * @return              number of parsed messages
+     */
+    size_t parser_receivedDataBatch(Parser_t * parser, uint8_t * data, size_t len, Message_t * messages, size_t * offsets, size_t maxMessages, size_t * consumed);
 
 #ifdef __cplusplus
     } // extern "C"
@@ -32,16 +32,19 @@ namespace MidiMessage {
         bool RunningStatusEnabled;
 
         uint8_t *Buffer;
-        uint16_t MaxLength;
+        size_t MaxLength;
 
         void *Context;
 
-        void (*MessageHandler)(uint8_t *message, uint16_t length, void *context);
+        void (*MessageHandler)(uint8_t *message, size_t length, void *context);
         void (*NRpnHandler)(uint8_t channel, NRpnType_t type, NRpnAction_t action, uint16_t controller, uint16_t value, void *context);
 
-        void (*DiscardingDataHandler)(uint8_t *bytes, uint16_t length, void *context);
+        void (*DiscardingDataHandler)(uint8_t *bytes, size_t length, void *context);
 
-        uint16_t Length;
+        size_t Length;
+
+        uint8_t ExpectedLength;
+        bool DataValid;
 
         NRpnType_t NRpnType;
         uint8_t NRpnMsgCount;
@@ -56,6 +59,9 @@ namespace MidiMessage {
         parser->Length = 0;
         parser->Buffer[0] = 0;
 
+        parser->ExpectedLength = 0;
+        parser->DataValid = false;
+
         parser->NRpnMsgCount = 0;
     }
 
@@ -63,10 +69,10 @@ namespace MidiMessage {
       SimpleParser_t * parser,
       bool runningStatusEnabled,
       uint8_t * buffer,
-      uint16_t maxLength,
-      void (*messageHandler)(uint8_t *message, uint16_t length, void * context),
+      size_t maxLength,
+      void (*messageHandler)(uint8_t *message, size_t length, void * context),
       void (*nrpnHandler)(uint8_t channel, NRpnType_t type, NRpnAction_t action,  uint16_t controller, uint16_t value, void *context),
-      void (*discardingDataHandler)(uint8_t * bytes, uint16_t length, void * context),
+      void (*discardingDataHandler)(uint8_t * bytes, size_t length, void * context),
       void * context){
 
         parser->RunningStatusEnabled = runningStatusEnabled;
@@ -88,7 +94,7 @@ namespace MidiMessage {
      * @param data      incoming data buffer
      * @param len       length of incoming data
      */
-    void simpleparser_receivedData(SimpleParser_t * parser, uint8_t * data, uint16_t len);
+    void simpleparser_receivedData(SimpleParser_t * parser, uint8_t * data, size_t len);
 
 #ifdef __cplusplus
     } // extern "C"
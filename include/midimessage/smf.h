@@ -0,0 +1,317 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_SMF_H
+#define MIDIMESSAGE_SMF_H
+
+#include "midimessage/midimessage.h"
+
+// memory mapping of files (POSIX only)
+#if defined(__unix__) || defined(__APPLE__)
+#define SMF_MMAP 1
+#endif
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    /**
+     * Standard MIDI File (SMF) reading and writing.
+     *
+     * Reading is zero-copy and allocation-free, ie operates on the complete file in memory (eg mapped with
+     * smf_mapFile()) and any event data points into it. Writing is into a caller provided buffer.
+     */
+
+    const uint8_t SmfHeaderChunkLength = 14; // "MThd" <length (4 bytes)> <format> <tracks> <division>
+    const uint8_t SmfChunkHeaderLength = 8; // <type (4 bytes)> <length (4 bytes)>
+
+    // maximal length of an encoded variable length quantity (28 bit value)
+    const uint8_t SmfVarLenMaxLength = 4;
+    const uint32_t SmfVarLenMax = 0x0FFFFFFF;
+
+    typedef enum {
+        SmfFormatSingleTrack        = 0,
+        SmfFormatMultiTrack         = 1,
+        SmfFormatMultiSequence      = 2
+    } SmfFormat_t;
+
+    typedef enum {
+        SmfEventTypeMidi            = 0, // (non-SysEx) MIDI message
+        SmfEventTypeSysEx           = 1, // F0 <length> <bytes>, ie SysEx (or first packet of)
+        SmfEventTypeEscape          = 2, // F7 <length> <bytes>, ie SysEx continuation packet or any other bytes
+        SmfEventTypeMeta            = 3  // FF <type> <length> <bytes>
+    } SmfEventType_t;
+
+    typedef enum {
+        SmfMetaSequenceNumber       = 0x00,
+        SmfMetaText                 = 0x01,
+        SmfMetaCopyright            = 0x02,
+        SmfMetaTrackName            = 0x03,
+        SmfMetaInstrumentName       = 0x04,
+        SmfMetaLyric                = 0x05,
+        SmfMetaMarker               = 0x06,
+        SmfMetaCuePoint             = 0x07,
+        SmfMetaChannelPrefix        = 0x20,
+        SmfMetaEndOfTrack           = 0x2F,
+        SmfMetaSetTempo             = 0x51,
+        SmfMetaSmpteOffset          = 0x54,
+        SmfMetaTimeSignature        = 0x58,
+        SmfMetaKeySignature         = 0x59,
+        SmfMetaSequencerSpecific    = 0x7F
+    } SmfMetaType_t;
+
+    typedef enum {
+        SmfResultOk                 = 0,
+        SmfResultEnd                = 1,
+        SmfResultError              = -1
+    } SmfResult_t;
+
+    typedef struct {
+        uint16_t Format;
+        uint16_t TrackCount;
+        uint16_t Division; // ticks per quarter note, or (if MSB set) negative SMPTE format and ticks per frame
+    } SmfHeader_t;
+
+    typedef struct {
+        uint8_t * Data; // track chunk data
+        uint32_t Length;
+        uint32_t Position;
+        uint8_t RunningStatus;
+        uint64_t Time; // absolute time (ticks) of last event
+    } SmfTrack_t;
+
+    typedef struct {
+        uint8_t Type; // SmfEventType_t
+        uint32_t Delta; // delta time (ticks)
+        uint64_t Time; // absolute time (ticks)
+
+        uint8_t MetaType; // SmfMetaType_t, meta events only
+
+        // MIDI messages: complete message (ie including any running status), SysEx/Escape/Meta: data following the length
+        uint8_t * Data;
+        uint32_t Length;
+
+        uint8_t Bytes[3]; // (MIDI messages point here)
+    } SmfEvent_t;
+
+    typedef struct {
+        uint8_t * Buffer;
+        size_t MaxLength;
+        size_t Length;
+
+        size_t TrackStart; // offset of the chunk header of the current track
+        uint8_t RunningStatus;
+    } SmfWriter_t;
+
+    // upper bound of the packed length of universal (non-)realtime SysEx messages beyond their data length (the longest
+    // being MIDI Show Control messages with three cue number parts of up to 255 characters)
+    const size_t SmfUniversalSysExMaxOverhead = 800;
+
+    // universal SysEx messages are packed into a scratch buffer of this length if there is no room for the upper bound
+    const size_t SmfWriterScratchLength = 1024;
+
+    typedef struct {
+        uint8_t * Data;
+        size_t Length;
+    } SmfFile_t;
+
+    /**
+     * Usage statistics of (a corpus of) files, see smf_scan().
+     */
+    typedef struct {
+        uint64_t Files;
+        uint64_t InvalidFiles;
+        uint64_t Tracks;
+        uint64_t Events;
+        uint64_t MetaEvents;
+        uint64_t SysExEvents;
+
+        uint64_t Notes[128]; // note on (velocity > 0) count per key
+        uint64_t Controllers[128]; // control change count per controller
+
+        // sysex count per id: single byte ids (including experimental and universal ones) and extended manufacturer
+        // ids (00 <byte1> <byte2>, indexed by byte1 << 7 | byte2)
+        uint64_t SysExIds[128];
+        uint64_t SysExExtendedIds[1 << 14];
+    } SmfStatistics_t;
+
+    /**
+     * Packs an unsigned integer (<= SmfVarLenMax) as variable length quantity (7 bits per byte, most significant group
+     * first, MSB set on all but the last byte).
+     *
+     * @param   bytes   destination (at least SmfVarLenMaxLength bytes)
+     * @return          number of bytes written
+     */
+    inline uint8_t packSmfVarLen( uint8_t * bytes, uint32_t value ){
+        ASSERT( bytes != NULL );
+        ASSERT( value <= SmfVarLenMax );
+
+        uint8_t len = 1;
+        while (len < SmfVarLenMaxLength && (value >> (7*len)) > 0){
+            len++;
+        }
+
+        for(uint8_t i = 0; i < len; i++){
+            bytes[i] = ((value >> (7*(len - 1 - i))) & DataMask) | (i < len - 1 ? 0x80 : 0);
+        }
+
+        return len;
+    }
+
+    /**
+     * @param   bytes   source bytes
+     * @param   length  available bytes
+     * @param   value   decoded value
+     * @return          number of bytes consumed, zero if incomplete or invalid
+     */
+    inline uint8_t unpackSmfVarLen( uint8_t * bytes, size_t length, uint32_t * value ){
+        ASSERT( bytes != NULL );
+        ASSERT( value != NULL );
+
+        uint32_t v = 0;
+
+        for(uint8_t i = 0; i < length && i < SmfVarLenMaxLength; i++){
+            v = (v << 7) | (bytes[i] & DataMask);
+
+            if ((bytes[i] & 0x80) == 0){
+                *value = v;
+                return i + 1;
+            }
+        }
+
+        return 0;
+    }
+
+    inline uint32_t unpackSmfU32( uint8_t * bytes ){
+        return (((uint32_t)bytes[0]) << 24) | (((uint32_t)bytes[1]) << 16) | (((uint32_t)bytes[2]) << 8) | bytes[3];
+    }
+
+    inline void packSmfU32( uint8_t * bytes, uint32_t value ){
+        bytes[0] = (value >> 24) & 0xFF;
+        bytes[1] = (value >> 16) & 0xFF;
+        bytes[2] = (value >> 8) & 0xFF;
+        bytes[3] = value & 0xFF;
+    }
+
+    /**
+     * @param   data    complete file
+     * @param   length  length of file
+     * @param   header  header
+     * @return          true iff file starts with a valid header chunk
+     */
+    bool smf_readHeader( uint8_t * data, size_t length, SmfHeader_t * header );
+
+    /**
+     * Sets up the next track (any non-track chunks are skipped).
+     *
+     * @param   data    complete file
+     * @param   length  length of file
+     * @param   offset  offset of next chunk (initially zero), updated to the chunk following the track
+     * @param   track   track to set up
+     * @return          SmfResult_t
+     */
+    int smf_nextTrack( uint8_t * data, size_t length, size_t * offset, SmfTrack_t * track );
+
+    /**
+     * Reads the next event of a track (running status, ie omitted status bytes are restored).
+     *
+     * @return          SmfResult_t
+     */
+    int smf_readEvent( SmfTrack_t * track, SmfEvent_t * event );
+
+    /**
+     * Unpacks a MIDI or (complete) SysEx event.
+     *
+     * @param   event       event to unpack
+     * @param   msg         destination (SysEx.ByteData must point to a sufficiently large buffer)
+     * @param   buffer      buffer for SysEx events (event length + 1), may be NULL if there are none
+     * @param   maxLength   size of buffer
+     * @return              true iff a valid message was unpacked
+     */
+    bool smf_unpackEvent( SmfEvent_t * event, Message_t * msg, uint8_t * buffer, size_t maxLength );
+
+    void smfstatistics_reset( SmfStatistics_t * stats );
+
+    /**
+     * Adds the counts of <src> to <dst> (eg to merge per thread statistics).
+     */
+    void smfstatistics_merge( SmfStatistics_t * dst, SmfStatistics_t * src );
+
+    /**
+     * Scans a complete file and adds its events to the statistics (allocation-free).
+     *
+     * @param   data    complete file
+     * @param   length  length of file
+     * @param   stats   statistics to add to
+     * @return          true iff file is valid (counts up to any invalid event are added anyway)
+     */
+    bool smf_scan( uint8_t * data, size_t length, SmfStatistics_t * stats );
+
+    /**
+     * Writes the header chunk.
+     *
+     * @return          false iff buffer too small
+     */
+    bool smfwriter_init( SmfWriter_t * writer, uint8_t * buffer, size_t maxLength, uint16_t format, uint16_t trackCount, uint16_t division );
+
+    /**
+     * Starts a new track chunk.
+     *
+     * @return          false iff buffer too small
+     */
+    bool smfwriter_beginTrack( SmfWriter_t * writer );
+
+    /**
+     * Writes a (SysEx or other) message of the current track, using running status where possible.
+     *
+     * Universal SysEx messages must fit the scratch buffer (SmfWriterScratchLength) or the buffer must have room for
+     * SmfUniversalSysExMaxOverhead plus their data length, ie msg->Data.SysEx.Length must be set (zero for messages
+     * without data, as by unpack() and MessagefromString()).
+     *
+     * @return          false iff buffer too small (or message invalid)
+     */
+    bool smfwriter_writeMessage( SmfWriter_t * writer, uint32_t delta, Message_t * msg );
+
+    /**
+     * Writes a (packed) event of the current track, ie a MIDI message as status and data bytes (using running status
+     * where possible), or a SysEx (SystemMessageSystemExclusive) or escape (SystemMessageEndOfExclusive) packet.
+     *
+     * @return          false iff buffer too small
+     */
+    bool smfwriter_writeEvent( SmfWriter_t * writer, uint32_t delta, uint8_t status, uint8_t * data, uint32_t length );
+
+    /**
+     * Writes a meta event of the current track.
+     *
+     * @return          false iff buffer too small
+     */
+    bool smfwriter_writeMeta( SmfWriter_t * writer, uint32_t delta, uint8_t type, uint8_t * data, uint32_t length );
+
+    /**
+     * Writes the end of track meta event and completes the track chunk.
+     *
+     * @return          false iff buffer too small
+     */
+    bool smfwriter_endTrack( SmfWriter_t * writer, uint32_t delta );
+
+#ifdef SMF_MMAP
+
+    /**
+     * Memory maps a file (read-only).
+     *
+     * @return          true iff file could be mapped
+     */
+    bool smf_mapFile( const char * path, SmfFile_t * file );
+
+    void smf_unmapFile( SmfFile_t * file );
+
+#endif //SMF_MMAP
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_SMF_H
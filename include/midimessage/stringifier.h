@@ -59,9 +59,33 @@ namespace MidiMessage {
      * @param bytes     Destination buffer to write message to
      * @param msg       Source message from which to generate human-readable message
      * @return          Length of generated
+     * @see MessageStringLength()
      */
     int MessagetoString(uint8_t *bytes, Message_t *msg);
 
+    /**
+     * Like MessagetoString() but never writes beyond the given size of the destination buffer (the message is generated
+     * once, ie there is no need to compute its length beforehand).
+     *
+     * @param bytes     Destination buffer to write message to
+     * @param size      Size of destination buffer
+     * @param msg       Source message from which to generate human-readable message
+     * @return          Length of generated, zero if it does not fit including the terminating null (the buffer then
+     *                  holds a partial message) or msg can not be stringified
+     */
+    int MessagetoStringBounded(uint8_t *bytes, size_t size, Message_t *msg);
+
+    /**
+     * Computes the exact length of the message as generated by MessagetoString() (without writing it), ie the
+     * destination buffer requires one more byte (for the terminating null).
+     *
+     * Messages may thus be stringified back-to-back into one buffer of the total size.
+     *
+     * @param msg       Source message
+     * @return          Length of generated, zero if msg can not be stringified
+     */
+    int MessageStringLength(Message_t *msg);
+
     /**
      * Helper function to argumentify a given command line delimited by spaces.
      *
@@ -0,0 +1,278 @@
+/**
+ * \file
+ */
+
+#ifndef MIDIMESSAGE_UMP_H
+#define MIDIMESSAGE_UMP_H
+
+#include "midimessage/midimessage.h"
+#include "midimessage/parser.h"
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    /**
+     * MIDI 2.0 Universal MIDI Packet (UMP) message types (upper nibble of the first word).
+     */
+    typedef enum {
+        UmpMessageTypeUtility               = 0x0,
+        UmpMessageTypeSystem                = 0x1,  // system common & real time (32 bit)
+        UmpMessageTypeMidi1ChannelVoice     = 0x2,  // MIDI 1.0 channel voice (32 bit)
+        UmpMessageTypeData64                = 0x3,  // 7-bit SysEx data (64 bit)
+        UmpMessageTypeMidi2ChannelVoice     = 0x4,
+        UmpMessageTypeData128               = 0x5
+    } UmpMessageType_t;
+
+    /**
+     * Status of a 7-bit SysEx data packet (message type 0x3).
+     */
+    typedef enum {
+        UmpSysEx7Complete   = 0x0,  // complete SysEx in one packet
+        UmpSysEx7Start      = 0x1,
+        UmpSysEx7Continue   = 0x2,
+        UmpSysEx7End        = 0x3
+    } UmpSysEx7Status_t;
+
+    const uint8_t UmpGroupMask              = 0x0F;
+    const uint8_t UmpSysEx7MaxLength        = 6;    // data bytes per SysEx packet
+
+    inline uint8_t getUmpMessageType( uint32_t word ){
+        return (word >> 28) & 0x0F;
+    }
+
+    inline uint8_t getUmpGroup( uint32_t word ){
+        return (word >> 24) & UmpGroupMask;
+    }
+
+    /**
+     * Number of 32 bit words of a packet as given by the message type of its first word.
+     */
+    inline uint8_t getUmpWordCount( uint32_t word ){
+        switch(getUmpMessageType(word)){
+            case 0x0: case 0x1: case 0x2: case 0x6: case 0x7:
+                return 1;
+            case 0x3: case 0x4: case 0x8: case 0x9: case 0xA:
+                return 2;
+            case 0xB: case 0xC:
+                return 3;
+            default:
+                return 4;
+        }
+    }
+
+    /**
+     * Packs a compact message as system (0x1) or MIDI 1.0 channel voice (0x2) packet.
+     *
+     * @param   words   destination (one word)
+     * @param   group   UMP group (0-15)
+     * @param   msg     message to pack
+     * @return          number of words packed, zero if message can not be represented (invalid status or SysEx)
+     */
+    inline uint8_t packUmpShortMessage( uint32_t * words, uint8_t group, ShortMessage_t * msg ){
+        ASSERT( words != NULL );
+        ASSERT( msg != NULL );
+        ASSERT( (group & UmpGroupMask) == group );
+
+        // (sysex, EOX and undefined status bytes have no fixed length)
+        uint8_t length = isControlByte(msg->Status) ? getMsgLen(msg->Status) : 0;
+
+        if (length == 0){
+            return 0;
+        }
+
+        uint32_t type = getStatusClass(msg->Status) == StatusClassSystemMessage ? UmpMessageTypeSystem : UmpMessageTypeMidi1ChannelVoice;
+
+        words[0] = (type << 28) | ((uint32_t)group << 24) | ((uint32_t)msg->Status << 16)
+                   | (length > 1 ? ((uint32_t)(msg->Data1 & DataMask) << 8) : 0)
+                   | (length > 2 ? (uint32_t)(msg->Data2 & DataMask) : 0);
+
+        return 1;
+    }
+
+    /**
+     * @param   words   source packet (one word)
+     * @param   group   (optional) UMP group of packet
+     * @param   msg     destination message
+     * @return          true iff words is a valid system (0x1) or MIDI 1.0 channel voice (0x2) packet
+     */
+    inline bool unpackUmpShortMessage( uint32_t * words, uint8_t * group, ShortMessage_t * msg ){
+        ASSERT( words != NULL );
+        ASSERT( msg != NULL );
+
+        uint8_t type = getUmpMessageType(words[0]);
+        uint8_t status = (words[0] >> 16) & 0xFF;
+
+        if (type == UmpMessageTypeSystem){
+            if ( getStatusClass(status) != StatusClassSystemMessage || status == SystemMessageSystemExclusive || status == SystemMessageEndOfExclusive ){
+                return false;
+            }
+        } else if (type == UmpMessageTypeMidi1ChannelVoice){
+            if ( ! isControlByte(status) || getStatusClass(status) == StatusClassSystemMessage ){
+                return false;
+            }
+        } else {
+            return false;
+        }
+
+        uint8_t bytes[3] = { status, (uint8_t)((words[0] >> 8) & 0xFF), (uint8_t)(words[0] & 0xFF) };
+
+        if ( ! unpackShortMessage(bytes, getMsgLen(status), msg) ){
+            return false;
+        }
+
+        if (group != NULL){
+            *group = getUmpGroup(words[0]);
+        }
+
+        return true;
+    }
+
+    /**
+     * Packs a 7-bit SysEx data packet (message type 0x3), data excludes the initial SysEx byte and the EOX.
+     *
+     * @param   words   destination (two words)
+     * @param   group   UMP group (0-15)
+     * @param   status  UmpSysEx7Status_t
+     * @param   data    data bytes
+     * @param   length  number of data bytes (0-6)
+     * @return          number of words packed
+     */
+    inline uint8_t packUmpSysEx7( uint32_t * words, uint8_t group, uint8_t status, uint8_t * data, uint8_t length ){
+        ASSERT( words != NULL );
+        ASSERT( (group & UmpGroupMask) == group );
+        ASSERT( status <= UmpSysEx7End );
+        ASSERT( length <= UmpSysEx7MaxLength );
+        ASSERT( length == 0 || data != NULL );
+
+        uint8_t b[UmpSysEx7MaxLength] = {0,0,0,0,0,0};
+
+        for(uint8_t i = 0; i < length; i++){
+            b[i] = data[i] & DataMask;
+        }
+
+        words[0] = ((uint32_t)UmpMessageTypeData64 << 28) | ((uint32_t)group << 24) | ((uint32_t)status << 20) | ((uint32_t)length << 16)
+                   | ((uint32_t)b[0] << 8) | (uint32_t)b[1];
+        words[1] = ((uint32_t)b[2] << 24) | ((uint32_t)b[3] << 16) | ((uint32_t)b[4] << 8) | (uint32_t)b[5];
+
+        return 2;
+    }
+
+    /**
+     * @param   words   source packet (two words)
+     * @param   group   (optional) UMP group of packet
+     * @param   status  UmpSysEx7Status_t of packet
+     * @param   data    destination of data bytes (at least 6 bytes)
+     * @param   length  number of data bytes
+     * @return          true iff words is a valid 7-bit SysEx data packet
+     */
+    inline bool unpackUmpSysEx7( uint32_t * words, uint8_t * group, uint8_t * status, uint8_t * data, uint8_t * length ){
+        ASSERT( words != NULL );
+        ASSERT( status != NULL );
+        ASSERT( data != NULL );
+        ASSERT( length != NULL );
+
+        if (getUmpMessageType(words[0]) != UmpMessageTypeData64){
+            return false;
+        }
+
+        uint8_t st = (words[0] >> 20) & 0x0F;
+        uint8_t len = (words[0] >> 16) & 0x0F;
+
+        if (st > UmpSysEx7End || len > UmpSysEx7MaxLength){
+            return false;
+        }
+
+        uint8_t b[UmpSysEx7MaxLength] = {
+            (uint8_t)((words[0] >> 8) & 0xFF), (uint8_t)(words[0] & 0xFF),
+            (uint8_t)((words[1] >> 24) & 0xFF), (uint8_t)((words[1] >> 16) & 0xFF), (uint8_t)((words[1] >> 8) & 0xFF), (uint8_t)(words[1] & 0xFF)
+        };
+
+        for(uint8_t i = 0; i < len; i++){
+            if ( ! isDataByte(b[i]) ){
+                return false;
+            }
+            data[i] = b[i];
+        }
+
+        if (group != NULL){
+            *group = getUmpGroup(words[0]);
+        }
+        *status = st;
+        *length = len;
+
+        return true;
+    }
+
+
+    /**
+     * Stateful converter of a MIDI 1.0 byte stream into UMP words (see umpencoder_receivedData()).
+     *
+     * Uses a Parser_t in SysEx streaming mode with a compact message handler, ie messages are never unpacked into a
+     * Message_t and SysEx messages of any length are converted with constant memory.
+     */
+    typedef struct {
+
+        Parser_t Parser;
+
+        uint8_t Buffer[4];
+
+        Message_t Message;
+
+        uint8_t Group;
+
+        // pending sysex data (not yet known wether start/continue or end packet)
+        uint8_t SysEx[UmpSysEx7MaxLength];
+        uint8_t SysExLength;
+        bool SysExStarted;
+
+        uint32_t * Words;
+        size_t Count;
+
+    } UmpEncoder_t;
+
+    /**
+     * @param encoder               encoder to initialize
+     * @param runningStatusEnabled  accept running status in byte stream
+     * @param group                 UMP group of generated packets (0-15)
+     */
+    void umpencoder_init( UmpEncoder_t * encoder, bool runningStatusEnabled, uint8_t group );
+
+    inline void umpencoder_reset( UmpEncoder_t * encoder ){
+        parser_reset( &encoder->Parser );
+        encoder->SysExLength = 0;
+        encoder->SysExStarted = false;
+    }
+
+    /**
+     * Converts a chunk of a MIDI 1.0 byte stream into UMP words: system (0x1), MIDI 1.0 channel voice (0x2) and 7-bit
+     * SysEx data (0x3) packets. Incomplete messages (and up to six bytes of SysEx data) are kept for the next call.
+     *
+     * @param data      incoming data buffer
+     * @param len       length of incoming data
+     * @param words     destination, must provide room for at least 2 * len words
+     * @return          number of words written
+     */
+    size_t umpencoder_receivedData( UmpEncoder_t * encoder, uint8_t * data, size_t len, uint32_t * words );
+
+    /**
+     * Converts system (0x1), MIDI 1.0 channel voice (0x2) and 7-bit SysEx data (0x3) packets into a MIDI 1.0 byte
+     * stream (without running status). Packets of any other (or incomplete) message type are skipped, the group is
+     * ignored.
+     *
+     * As 7-bit SysEx packets are converted individually no state has to be kept between calls.
+     *
+     * @param words     source packets
+     * @param count     number of words
+     * @param bytes     destination, must provide room for at least 4 * count bytes
+     * @return          number of bytes written
+     */
+    size_t umpToBytes( uint32_t * words, size_t count, uint8_t * bytes );
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
+
+#endif //MIDIMESSAGE_UMP_H
@@ -0,0 +1,396 @@
+#include <midimessage/capture.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    size_t capturewriter_init( CaptureWriter_t * writer, uint8_t * dst, void (*syncHandler)(CaptureIndexEntry_t * entry, void * context), void * context ){
+        ASSERT( writer != NULL );
+        ASSERT( dst != NULL );
+
+        writer->Time = 0;
+        writer->Offset = CaptureHeaderLength;
+        writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+        capture_resetParameters( writer->Parameters );
+
+        writer->SyncIntervalNs = 1000000000;
+        writer->SyncIntervalEvents = 1024;
+
+        writer->LastSyncTime = 0;
+        writer->EventsSinceSync = 0;
+
+        writer->SyncHandler = syncHandler;
+        writer->Context = context;
+
+        memcpy( dst, CaptureHeader, CaptureHeaderLength );
+
+        return CaptureHeaderLength;
+    }
+
+    static size_t writeSync( CaptureWriter_t * writer, uint8_t * dst, uint64_t time ){
+
+        if (writer->SyncHandler != NULL){
+            CaptureIndexEntry_t entry;
+            entry.Time = time;
+            entry.Offset = writer->Offset;
+            writer->SyncHandler( &entry, writer->Context );
+        }
+
+        size_t len = packVarInt( dst, time - writer->Time );
+        dst[len++] = CaptureSyncMarker;
+        len += packVarInt( &dst[len], time );
+        dst[len++] = writer->RunningStatus;
+
+        // only channels with a parameter state are listed
+        uint16_t mask = 0;
+        for(uint8_t i = 0; i < 16; i++){
+            if (capture_isParameterSet( &writer->Parameters[i] )){
+                mask |= 1 << i;
+            }
+        }
+
+        len += packVarInt( &dst[len], mask );
+
+        for(uint8_t i = 0; i < 16; i++){
+            if (mask & (1 << i)){
+                dst[len++] = writer->Parameters[i].Type;
+                dst[len++] = writer->Parameters[i].Nrpn[0];
+                dst[len++] = writer->Parameters[i].Nrpn[1];
+                dst[len++] = writer->Parameters[i].Rpn[0];
+                dst[len++] = writer->Parameters[i].Rpn[1];
+            }
+        }
+
+        writer->Time = time;
+        writer->Offset += len;
+        writer->LastSyncTime = time;
+        writer->EventsSinceSync = 0;
+
+        return len;
+    }
+
+    size_t capturewriter_writeMessage( CaptureWriter_t * writer, uint8_t * dst, uint64_t time, uint8_t * bytes, size_t length ){
+        ASSERT( writer != NULL );
+        ASSERT( dst != NULL );
+        ASSERT( bytes != NULL );
+        ASSERT( length > 0 );
+        ASSERT( time >= writer->Time );
+
+        size_t sync = 0;
+
+        // the very first message is always preceded by a sync point
+        if (writer->Offset == CaptureHeaderLength ||
+            time - writer->LastSyncTime >= writer->SyncIntervalNs ||
+            writer->EventsSinceSync >= writer->SyncIntervalEvents){
+            sync = writeSync( writer, dst, time );
+        }
+
+        size_t len = sync;
+
+        len += packVarInt( &dst[len], time - writer->Time );
+
+        if (bytes[0] == SystemMessageSystemExclusive){
+            // the running status is cancelled by any sysex
+            writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+            dst[len++] = SystemMessageSystemExclusive;
+            len += packVarInt( &dst[len], length - 1 );
+            memcpy( &dst[len], &bytes[1], length - 1 );
+            len += length - 1;
+        } else if (updateRunningStatus( &writer->RunningStatus, bytes[0] ) && isRunningStatus(bytes[0])){
+            memcpy( &dst[len], &bytes[1], length - 1 );
+            len += length - 1;
+        } else {
+            memcpy( &dst[len], bytes, length );
+            len += length;
+        }
+
+        if (bytes[0] != SystemMessageSystemExclusive){
+            capture_updateParameters( writer->Parameters, bytes[0], &bytes[1] );
+        }
+
+        writer->Time = time;
+        writer->Offset += len - sync;
+        writer->EventsSinceSync++;
+
+        return len;
+    }
+
+    size_t capturewriter_finish( CaptureWriter_t * writer, uint8_t * dst, CaptureIndexEntry_t * index, size_t indexLength ){
+        ASSERT( writer != NULL );
+        ASSERT( dst != NULL );
+        ASSERT( index != NULL || indexLength == 0 );
+
+        size_t len = packVarInt( dst, 0 );
+        dst[len++] = CaptureEndMarker;
+
+        uint64_t indexOffset = writer->Offset + len;
+
+        for(size_t i = 0; i < indexLength; i++, len += CaptureIndexEntryLength){
+            capture_packU64( &dst[len], index[i].Time );
+            capture_packU64( &dst[len + 8], index[i].Offset );
+        }
+
+        capture_packU64( &dst[len], indexOffset );
+        memcpy( &dst[len + 8], CaptureTrailer, sizeof(CaptureTrailer) );
+        len += CaptureTrailerLength;
+
+        writer->Offset += len;
+
+        return len;
+    }
+
+    /**
+     * Reads a record, respectively tells why it could not be read.
+     *
+     * @param   bytes   destination of message, NULL to only validate
+     * @return          number of bytes consumed, zero if incomplete, -1 if invalid
+     */
+    static int64_t readRecord( CaptureReader_t * reader, uint8_t * src, size_t len, uint64_t * time, uint8_t * bytes, size_t maxLength, size_t * length ){
+
+        uint64_t delta;
+
+        size_t n = unpackVarInt( src, len, &delta );
+        if (n == 0){
+            return len < VarIntMaxLength ? 0 : -1;
+        }
+        if (n >= len){
+            return 0;
+        }
+
+        uint8_t status = src[n];
+
+        *length = 0;
+
+        if (status == CaptureSyncMarker){
+            uint64_t t;
+            uint8_t m = unpackVarInt( &src[n+1], len - n - 1, &t );
+            if (m == 0){
+                return len - n - 1 < VarIntMaxLength ? 0 : -1;
+            }
+            n += 1 + m;
+            if (n >= len){
+                return 0;
+            }
+            uint8_t runningStatus = src[n++];
+
+            uint64_t mask;
+            m = unpackVarInt( &src[n], len - n, &mask );
+            if (m == 0){
+                return len - n < VarIntMaxLength ? 0 : -1;
+            }
+            n += m;
+
+            if (mask > 0xFFFF){
+                return -1;
+            }
+
+            uint8_t count = 0;
+            for(uint8_t i = 0; i < 16; i++){
+                count += (mask >> i) & 1;
+            }
+            if (count * CaptureParameterLength > len - n){
+                return 0;
+            }
+
+            capture_resetParameters( reader->Parameters );
+
+            for(uint8_t i = 0; i < 16; i++){
+                if (mask & (1 << i)){
+                    reader->Parameters[i].Type = src[n++];
+                    reader->Parameters[i].Nrpn[0] = src[n++];
+                    reader->Parameters[i].Nrpn[1] = src[n++];
+                    reader->Parameters[i].Rpn[0] = src[n++];
+                    reader->Parameters[i].Rpn[1] = src[n++];
+                }
+            }
+
+            reader->Time = t;
+            reader->RunningStatus = runningStatus;
+            *time = t;
+            return n;
+        }
+
+        if (status == CaptureEndMarker){
+            reader->Time += delta;
+            reader->Ended = true;
+            *time = reader->Time;
+            return n + 1;
+        }
+
+        if (status == SystemMessageSystemExclusive){
+            uint64_t l;
+            uint8_t m = unpackVarInt( &src[n+1], len - n - 1, &l );
+            if (m == 0){
+                return len - n - 1 < VarIntMaxLength ? 0 : -1;
+            }
+            if (l + 1 > maxLength){
+                return -1;
+            }
+            n += 1 + m;
+            if (l > len - n){
+                return 0;
+            }
+            if (bytes != NULL){
+                bytes[0] = SystemMessageSystemExclusive;
+                memcpy( &bytes[1], &src[n], l );
+            }
+
+            reader->RunningStatus = MidiMessage_RunningStatusNotSet;
+            reader->Time += delta;
+            *time = reader->Time;
+            *length = l + 1;
+            return n + l;
+        }
+
+        size_t msgLen;
+
+        if (isDataByte(status)){
+            // running status
+            if ( ! isRunningStatus(reader->RunningStatus) ){
+                return -1;
+            }
+            status = reader->RunningStatus;
+            msgLen = getMsgLen( status );
+            if (msgLen - 1 > len - n){
+                return 0;
+            }
+            if (bytes != NULL){
+                bytes[0] = status;
+                memcpy( &bytes[1], &src[n], msgLen - 1 );
+            }
+            capture_updateParameters( reader->Parameters, status, &src[n] );
+            n += msgLen - 1;
+        } else {
+            // (a stray EOX is a valid message of its own)
+            msgLen = status == SystemMessageEndOfExclusive ? 1 : getMsgLen( status );
+            if (msgLen == 0){
+                return -1;
+            }
+            if (msgLen > len - n){
+                return 0;
+            }
+            if (bytes != NULL){
+                memcpy( bytes, &src[n], msgLen );
+            }
+            capture_updateParameters( reader->Parameters, status, &src[n+1] );
+            n += msgLen;
+
+            updateRunningStatus( &reader->RunningStatus, status );
+        }
+
+        reader->Time += delta;
+        *time = reader->Time;
+        *length = msgLen;
+
+        return n;
+    }
+
+    size_t capturereader_read( CaptureReader_t * reader, uint8_t * src, size_t len, uint64_t * time, uint8_t * bytes, size_t maxLength, size_t * length ){
+        ASSERT( reader != NULL );
+        ASSERT( src != NULL );
+        ASSERT( time != NULL );
+        ASSERT( maxLength >= 3 );
+        ASSERT( length != NULL );
+
+        int64_t n = readRecord( reader, src, len, time, bytes, maxLength, length );
+
+        return n > 0 ? n : 0;
+    }
+
+    bool capturereader_isInvalid( CaptureReader_t * reader, uint8_t * src, size_t len, size_t maxLength ){
+        ASSERT( reader != NULL );
+        ASSERT( src != NULL );
+
+        // read using a copy such that the state is not modified
+        CaptureReader_t r = *reader;
+        uint64_t time;
+        size_t length;
+
+        return readRecord( &r, src, len, &time, NULL, maxLength, &length ) < 0;
+    }
+
+    bool capture_findIndexEntry( uint8_t * index, size_t count, uint64_t time, CaptureIndexEntry_t * entry ){
+        ASSERT( index != NULL || count == 0 );
+        ASSERT( entry != NULL );
+
+        // number of entries at or before time
+        size_t lo = 0, hi = count;
+
+        while (lo < hi){
+            size_t mid = lo + (hi - lo) / 2;
+
+            if (capture_unpackU64( &index[mid * CaptureIndexEntryLength] ) <= time){
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+
+        if (lo == 0){
+            return false;
+        }
+
+        capture_unpackIndexEntry( &index[(lo - 1) * CaptureIndexEntryLength], entry );
+
+        return true;
+    }
+
+    size_t capture_seek( CaptureReader_t * reader, uint8_t * capture, size_t length, uint64_t time ){
+        ASSERT( reader != NULL );
+        ASSERT( capture != NULL );
+
+        if (length < CaptureHeaderLength + CaptureTrailerLength || memcmp( capture, CaptureHeader, CaptureHeaderLength ) != 0){
+            return 0;
+        }
+
+        uint64_t indexOffset;
+        size_t indexEnd = length - CaptureTrailerLength;
+
+        if ( ! capture_unpackTrailer( &capture[indexEnd], &indexOffset ) ||
+             indexOffset < CaptureHeaderLength || indexOffset > indexEnd ||
+             (indexEnd - indexOffset) % CaptureIndexEntryLength != 0){
+            return 0;
+        }
+
+        CaptureIndexEntry_t entry;
+        size_t offset = CaptureHeaderLength;
+
+        if (capture_findIndexEntry( &capture[indexOffset], (indexEnd - indexOffset) / CaptureIndexEntryLength, time, &entry )){
+            if (entry.Offset < CaptureHeaderLength || entry.Offset >= indexOffset){
+                return 0;
+            }
+            offset = entry.Offset;
+        }
+
+        capturereader_init( reader );
+
+        // scan forward (the records end at the index)
+        while (true){
+            CaptureReader_t next = *reader;
+            uint64_t t;
+            size_t l;
+
+            size_t n = capturereader_read( &next, &capture[offset], indexOffset - offset, &t, NULL, length, &l );
+
+            if (n == 0){
+                return 0;
+            }
+
+            // stop before the first message at or after time (or the end marker)
+            if ((l > 0 && t >= time) || next.Ended){
+                return offset;
+            }
+
+            *reader = next;
+            offset += n;
+        }
+    }
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
@@ -9,8 +9,14 @@
 //#include <string.h>
 #include <string.h>
 #include <unistd.h>
+#include <errno.h>
+#include <ctype.h>
+#include <math.h>
 #include <getopt.h>
 #include <sys/time.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <time.h>
 
 #include <util-hex.h>
@@ -19,6 +25,9 @@
 #include <midimessage/stringifier.h>
 #include <midimessage/parser.h>
 #include <midimessage/commonccs.h>
+#include <midimessage/eventlist.h>
+#include <midimessage/capture.h>
+#include <midimessage/merge.h>
 
 
 using namespace std;
@@ -31,13 +40,25 @@ typedef enum {
     ModeUndefined       = 0,
     ModeParse           = 1,
     ModeGenerate        = 2,
-    ModeConvert        = 3
+    ModeConvert        = 3,
+    ModeCompile         = 4,
+    ModePlay            = 5,
+    ModeRecord          = 6,
+    ModeEncodeCapture   = 7,
+    ModeDecodeCapture   = 8,
+    ModeMerge           = 9
 } Mode_t;
 
 inline bool isValidMode( Mode_t mode ){
     return (mode == ModeParse ||
             mode == ModeGenerate ||
-            mode == ModeConvert
+            mode == ModeConvert ||
+            mode == ModeCompile ||
+            mode == ModePlay ||
+            mode == ModeRecord ||
+            mode == ModeEncodeCapture ||
+            mode == ModeDecodeCapture ||
+            mode == ModeMerge
     );
 }
 
@@ -53,6 +74,12 @@ typedef enum {
     ResolutionMilli = 1
 } Resolution_t;
 
+typedef enum {
+    FlushMessage    = 0,
+    FlushBlock      = 1,
+    FlushExit       = 2
+} Flush_t;
+
 
 ///////// Variables
 
@@ -75,6 +102,51 @@ struct {
 };
 
 
+// Playback scheduler (timed generation): absolute deadlines on the monotonic clock and jitter statistics
+struct {
+    struct timespec deadline;
+    unsigned long count;
+    long long jitterMin;
+    long long jitterMax;
+    double jitterSum;
+    double jitterSumSq;
+} scheduler;
+
+// accumulated delay (ns) of the next compiled event
+uint64_t compileDelta = 0;
+
+// capture writer (recording and encoding), absolute time (ns) of next encoded message and collected index
+CaptureWriter_t captureWriter;
+uint64_t captureTime = 0;
+struct {
+    CaptureIndexEntry_t * entries;
+    size_t length;
+    size_t size;
+} captureIndex = {
+        .entries = NULL,
+        .length = 0,
+        .size = 0
+};
+
+// time (ns) of last captured message played or decoded
+uint64_t captureLastTime = 0;
+
+// Seek option (capture playback and decoding)
+struct {
+    bool enabled;
+    uint64_t time;
+} seekOpt = {
+        .enabled = false,
+        .time = 0
+};
+
+// sleep until this long before a deadline, then spin (ns)
+#define SCHEDULER_SPIN_NS 50000
+
+// size of (binary) message buffers, ie the longest message (eg SysEx dump) parsed, packed or captured
+#define MESSAGE_BUFFER_SIZE (64*1024)
+
+
 // Options prefix/suffix
 char prefix[32] = "";
 char suffix[32] = "";
@@ -90,34 +162,73 @@ Process_t process;
 
 bool useHex = false;
 
+// Output flush policy (parse mode)
+Flush_t flushPolicy = FlushBlock;
+
 ///////// Signatures
 
 void printHelp( void );
 unsigned long getNow();
+uint64_t getTimedUnitNs();
+
+void scheduler_start(void);
+void scheduler_wait(uint64_t delay);
+void scheduler_report(void);
 
 void generator(void);
 void generatorError(int code, uint8_t argc, uint8_t ** argv);
 void writeMidiPacket( Message_t * msg );
+void writeMidiBytes( uint8_t * bytes, size_t length );
+
+void player(void);
+
+void captureStart(void);
+void captureMessage( uint64_t time, uint8_t * bytes, size_t length );
+void discardedMessage( uint64_t time, size_t length );
+void captureFinish(void);
+void captureIndexAdd( CaptureIndexEntry_t * entry, void * context );
+void readCapture( CaptureReader_t * reader, void (*handler)(uint64_t time, uint8_t * bytes, size_t length), size_t maxLength );
+void seekCapture( CaptureReader_t * reader, void (*handler)(uint64_t time, uint8_t * bytes, size_t length) );
+bool parseSeekTime( char * str, uint64_t * time );
+
+void recorder(void);
+void recordedMessage( Message_t * msg, void * context );
+void recordDiscardingData( uint8_t * data, size_t length, void * context );
+void decoder(void);
+
+void merger(int argc, char * argv[]);
+bool mergeScriptNext( void * cursor, MergeEvent_t * event );
+
+size_t readStdin( uint8_t * buffer, size_t maxLength );
+
+uint8_t * messageLine( uint8_t * buffer, size_t size, Message_t * msg, int * length );
 
 void parser(void);
 void parsedMessage( Message_t * msg, void * context );
-void discardingData( uint8_t * data, uint8_t length, void * context );
+void discardingData( uint8_t * data, size_t length, void * context );
 
 
 
 void printHelp( void ) {
     printf("Usage:\n");
     printf("\t midimessage-cli [-h?]\n");
-    printf("\t midimessage-cli [--running-status|-r] [--timed|-t[milli|micro]] (--parse|-p) [-d] [--nprn-filter]\n");
+    printf("\t midimessage-cli [--running-status|-r] [--timed|-t[milli|micro]] (--parse|-p) [-d] [--nprn-filter] [--flush=(message|block|exit)]\n");
     printf("\t midimessage-cli [--running-status|-r] [--timed|-t[milli|micro]] (--generate|-g) [-x0|-x1] [-v[N]] [--prefix=<prefix>] [--suffix=<suffix] [<cmd> ...]\n");
     printf("\t midimessage-cli --convert=(nibblize|denibblize|sevenbitize|desevenbitize) [--hex] [<data xN>]\n");
+    printf("\t midimessage-cli [--timed|-t[milli|micro]] --compile\n");
+    printf("\t midimessage-cli [--running-status|-r] [--seek=<time>] --play\n");
+    printf("\t midimessage-cli [--running-status|-r] --record\n");
+    printf("\t midimessage-cli [--timed|-t[milli|micro]] --encode-capture\n");
+    printf("\t midimessage-cli [--timed|-t[milli|micro]] [--seek=<time>] --decode-capture\n");
+    printf("\t midimessage-cli [--timed|-t[milli|micro]] --merge <file> ...\n");
 
     printf("\nOptions:\n");
     printf("\t -h|-? \t\t\t\t show this help\n");
     printf("\t --running-status|-r \t\t Accept (when parsing) or generate messages that rely on the running status (see MIDI specs)\n");
-    printf("\t --timed|-t[milli|micro] \t Enables the capture or playback of delta-time information (ie the time between messages). Optionally the time resolution (milliseconds or microseconds) can be specified (default = micro)\n");
+    printf("\t --timed|-t[milli|micro] \t Enables the capture or playback of delta-time information (ie the time between messages). Optionally the time resolution (milliseconds or microseconds) can be specified (default = micro). When generating, playback jitter statistics are written to STDERR at exit.\n");
     printf("\t --parse|-p [<binary-data>] \t Enter parse mode and optionally pass as first argument (binary) message to be parsed. If no argument is provided starts reading binary stream from STDIN. Each successfully parsed message will be printed to STDOUT and terminated with a newline.\n");
     printf("\t -d \t\t\t\t In parsing mode only, instead of silent discarding output any discarded data to STDERR.\n");
+    printf("\t --flush=(message|block|exit) \t In parsing mode only, flush output after each message (live use), after each block read from STDIN (default; blocks are as small as the incoming data, thus live input is still passed on immediately) or at exit only (files).\n");
     printf("\t --nrpn-filter \t\t\t\t In parsing mode only, assume CC-sequences 99-98-96 (increment), 99-98-97 (decrement), 99-98-6-38 (data entry) are NRPN sequences, thus these will be filtered even if impartial (!! ie, 99-98-6-2 will only output the message for 2; this is a convenience feature and can not be solved for the general case) \n");
     printf("\t --generate|-g [<cmd> ...] \t Enter generation mode and optionally pass command to be generated. If no command is given, expects one command from STDIN per line. Generated (binary) messages are written to STDOUT.\n");
     printf("\t --prefix=<prefix> \t\t Prefixes given string (max 32 bytes) before each binary sequence (only when in generation mode). A single %%d can be given which will be replaced with the length of the following binary message (incompatible with running-status mode).\n");
@@ -126,6 +237,13 @@ void printHelp( void ) {
     printf("\t -v0, -v1 \t\t\t In generation mode, print command parsing result (on error only) to STDERR. Default := do NOT print (-v0).\n");
     printf("\t --convert=.. \t\t\t Enter convertion mode, ie transform incoming STDIN using convertion method and write to STDOUT (raw bytes).\n");
     printf("\t --hex \t\t\t\t In convertion mode (only), hex input/output\n");
+    printf("\t --compile \t\t\t Enter compile mode, ie compile a (timed) generation script from STDIN into a binary event list written to STDOUT (see include/midimessage/eventlist.h)\n");
+    printf("\t --play \t\t\t Enter playback mode, ie play a compiled event list or a capture from STDIN with its timing and write the (binary) messages to STDOUT.\n");
+    printf("\t --record \t\t\t Enter record mode, ie parse (binary) messages from STDIN and write them with their (ns) timing as capture to STDOUT (see include/midimessage/capture.h)\n");
+    printf("\t --encode-capture \t\t Encode a (timed) generation script from STDIN as capture written to STDOUT.\n");
+    printf("\t --decode-capture \t\t Decode a capture from STDIN to a (timed) generation script written to STDOUT.\n");
+    printf("\t --seek=[[<hh>:]<mm>:]<ss>[.<fraction>] \t When playing or decoding a capture (which must be a file, ie not a pipe), start at given time. Any NRPN/RPN parameter selection is restored first.\n");
+    printf("\t --merge <file> ... \t\t Enter merge mode, ie merge the given captures and/or timed generation scripts (eg recorded with --parse --timed) in time order into one capture written to STDOUT. Script delays are in the units given by --timed (which is required for scripts).\n");
 
     printf("\nFancy pants note: the parsing output format is identical to the generation command format ;) \n");
 
@@ -296,6 +414,12 @@ void printHelp( void ) {
     printf("\t cat test.recording | bin/midimessage-cli -gtmilli | bin/midimessage-cli -p\n");
     printf("\t bin/midimessage-cli --convert=nibblize --hex 1337 > test.nibblized\n");
     printf("\t cat test.nibblized | bin/midimessage-cli --convert=denibblize --hex\n");
+    printf("\t cat test.recording | bin/midimessage-cli -tmilli --compile > test.events\n");
+    printf("\t cat test.events | bin/midimessage-cli --play | bin/midimessage-cli -p\n");
+    printf("\t bin/midimessage-cli -g | bin/midimessage-cli --record > test.capture\n");
+    printf("\t cat test.capture | bin/midimessage-cli -tmilli --decode-capture\n");
+    printf("\t bin/midimessage-cli --seek=01:23:45.000 --play < test.capture\n");
+    printf("\t bin/midimessage-cli -tmilli --merge test.capture test.recording | bin/midimessage-cli -tmilli --decode-capture\n");
     printf("\t bin/midimessage-cli -v1 -g nrpn 1 128 255 | bin/midimessage-cli -p\n");
     printf("\t bin/midimessage-cli -v1 -g nrpn 1 128 256 | bin/midimessage-cli -p --nrpn-filter\n");
 }
@@ -305,7 +429,7 @@ unsigned long getNow(){
 
     struct timespec c;
 
-    if (clock_gettime(CLOCK_REALTIME, &c) == -1) {
+    if (clock_gettime(CLOCK_MONOTONIC, &c) == -1) {
         perror("error calling clock_gettime()");
         exit(EXIT_FAILURE);
     }
@@ -317,6 +441,99 @@ unsigned long getNow(){
     return c.tv_sec * 1000000 + c.tv_nsec / 1000;
 }
 
+uint64_t getTimedUnitNs(){
+    return timedOpt.resolution == ResolutionMilli ? 1000000 : 1000;
+}
+
+long long timespecDiffNs( struct timespec * a, struct timespec * b ){
+    return (a->tv_sec - b->tv_sec) * 1000000000LL + (a->tv_nsec - b->tv_nsec);
+}
+
+void scheduler_start(void){
+
+    if (clock_gettime(CLOCK_MONOTONIC, &scheduler.deadline) == -1) {
+        perror("error calling clock_gettime()");
+        exit(EXIT_FAILURE);
+    }
+
+    scheduler.count = 0;
+    scheduler.jitterMin = 0;
+    scheduler.jitterMax = 0;
+    scheduler.jitterSum = 0;
+    scheduler.jitterSumSq = 0;
+
+    // also report if exiting on error
+    atexit(scheduler_report);
+}
+
+/**
+ * Waits until <delay> (ns) after the previous deadline, ie delays do not accumulate any lateness.
+ * Sleeps (absolute deadline) and only spins for the last SCHEDULER_SPIN_NS.
+ */
+void scheduler_wait(uint64_t delay){
+
+    long long ns = (long long)delay;
+
+    scheduler.deadline.tv_sec += ns / 1000000000LL;
+    scheduler.deadline.tv_nsec += ns % 1000000000LL;
+    if (scheduler.deadline.tv_nsec >= 1000000000L){
+        scheduler.deadline.tv_sec++;
+        scheduler.deadline.tv_nsec -= 1000000000L;
+    }
+
+    struct timespec wakeup = scheduler.deadline;
+    wakeup.tv_nsec -= SCHEDULER_SPIN_NS;
+    if (wakeup.tv_nsec < 0){
+        wakeup.tv_sec--;
+        wakeup.tv_nsec += 1000000000L;
+    }
+
+#if defined(TIMER_ABSTIME)
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, NULL) == EINTR);
+#else
+    // no absolute sleep available (eg macOS), sleep relative to now
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    long long sleep = timespecDiffNs(&wakeup, &start);
+    if (sleep > 0){
+        struct timespec duration = { (time_t)(sleep / 1000000000LL), (long)(sleep % 1000000000LL) };
+        nanosleep(&duration, NULL);
+    }
+#endif
+
+    struct timespec now;
+    long long jitter;
+    do {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        jitter = timespecDiffNs(&now, &scheduler.deadline);
+    } while (jitter < 0);
+
+    if (scheduler.count == 0 || jitter < scheduler.jitterMin){
+        scheduler.jitterMin = jitter;
+    }
+    if (scheduler.count == 0 || jitter > scheduler.jitterMax){
+        scheduler.jitterMax = jitter;
+    }
+    scheduler.jitterSum += jitter;
+    scheduler.jitterSumSq += (double)jitter * jitter;
+    scheduler.count++;
+}
+
+void scheduler_report(void){
+
+    if (scheduler.count == 0){
+        return;
+    }
+
+    double mean = scheduler.jitterSum / scheduler.count;
+    double variance = scheduler.jitterSumSq / scheduler.count - mean * mean;
+
+    fprintf(stderr, "Playback jitter (us): events %lu, min %.3f, mean %.3f, max %.3f, stddev %.3f\n",
+            scheduler.count, scheduler.jitterMin / 1000.0, mean / 1000.0, scheduler.jitterMax / 1000.0,
+            (variance > 0 ? sqrt(variance) : 0) / 1000.0);
+}
+
 void generator(void){
     uint8_t line[255];
 
@@ -324,10 +541,15 @@ void generator(void){
     Message_t msg;
     msg.Data.SysEx.ByteData = sysexBuffer;
 
+    if (mode == ModeCompile){
+        fwrite(EventListHeader, 1, EventListHeaderLength, stdout);
+    }
+    else if (mode == ModeEncodeCapture){
+        captureStart();
+    }
     // start timer
-    if (timedOpt.enabled){
-        // record timer
-        timedOpt.lastTimestamp = getNow();
+    else if (timedOpt.enabled){
+        scheduler_start();
     }
 
     while(fgets((char*)line, sizeof(line), stdin ) != NULL){
@@ -344,17 +566,24 @@ void generator(void){
 
         // if the next command is delayed, we have to wait and update the arguments correspondingly
         if (timedOpt.enabled){
-            unsigned long delay = strtoul((char*)args[0], NULL, 10);
-            unsigned long waitUntil = timedOpt.lastTimestamp + delay;
-            unsigned long now;
-            do {
-                now = getNow();
-            } while( now < waitUntil );
+            uint64_t delay = strtoul((char*)args[0], NULL, 10) * getTimedUnitNs();
 
-            timedOpt.lastTimestamp = now;
+            // when compiling the delay is passed on to the next event
+            if (mode == ModeCompile){
+                compileDelta += delay;
+            } else if (mode == ModeEncodeCapture){
+                captureTime += delay;
+            } else {
+                scheduler_wait( delay );
+            }
 
             argsCount--;
             firstArg = &firstArg[1];
+
+            // a delay only
+            if (argsCount == 0){
+                continue;
+            }
         }
 
 
@@ -457,6 +686,10 @@ void generator(void){
             }
         }
     }
+
+    if (mode == ModeEncodeCapture){
+        captureFinish();
+    }
 }
 
 void generatorError(int code, uint8_t argc, uint8_t ** argv){
@@ -510,16 +743,35 @@ void generatorError(int code, uint8_t argc, uint8_t ** argv){
 
 void writeMidiPacket( Message_t * msg ){
 
-    static uint8_t runningStatusState = MidiMessage_RunningStatusNotSet;
-
-    uint8_t bytes[255];
-    uint8_t length = pack( bytes, msg );
+    static uint8_t bytes[MESSAGE_BUFFER_SIZE];
+    size_t length = pack( bytes, msg );
 
     if (length == 0){
         return;
     }
 
-    printf(prefix, length);
+    if (mode == ModeCompile){
+        static uint8_t event[sizeof(bytes) + 2 * VarIntMaxLength];
+
+        fwrite(event, 1, eventlist_packEvent(event, compileDelta, bytes, length), stdout);
+
+        compileDelta = 0;
+        return;
+    }
+
+    if (mode == ModeEncodeCapture){
+        captureMessage( captureTime, bytes, length );
+        return;
+    }
+
+    writeMidiBytes( bytes, length );
+}
+
+void writeMidiBytes( uint8_t * bytes, size_t length ){
+
+    static uint8_t runningStatusState = MidiMessage_RunningStatusNotSet;
+
+    printf(prefix, (int)length);
 
     if (runningStatusEnabled && updateRunningStatus( &runningStatusState, bytes[0] )){
         fwrite( &bytes[1], 1, length-1, stdout);
@@ -532,15 +784,18 @@ void writeMidiPacket( Message_t * msg ){
     fflush(stdout);
 }
 
+// size of blocks read from STDIN (and of the output buffer) in parse mode
+#define PARSE_BUFFER_SIZE (1024*1024)
+
 void parser(void){
 
-    uint8_t sysexBuffer[128];
+    uint8_t sysexBuffer[MESSAGE_BUFFER_SIZE];
     Message_t msg;
     msg.Data.SysEx.ByteData = sysexBuffer;
 
-    uint8_t dataBuffer[255];
+    uint8_t dataBuffer[MESSAGE_BUFFER_SIZE];
     Parser_t parser;
-    parser_init(&parser, runningStatusEnabled, dataBuffer, 255, &msg, parsedMessage, discardingData, NULL );
+    parser_init(&parser, runningStatusEnabled, dataBuffer, sizeof(dataBuffer), &msg, parsedMessage, discardingData, NULL );
 
     // start timer
     if (timedOpt.enabled){
@@ -549,74 +804,729 @@ void parser(void){
     }
 
 
-    int ch;
-    while( (ch = fgetc(stdin)) != EOF ){
-        uint8_t byte = (uint8_t)ch;
+    static uint8_t buffer[PARSE_BUFFER_SIZE];
+
+    // output is flushed according to flush policy only
+    setvbuf(stdout, NULL, _IOFBF, PARSE_BUFFER_SIZE);
+
+    size_t len;
+    while( (len = readStdin(buffer, sizeof(buffer))) > 0 ){
+
+        parser_receivedData(&parser, buffer, len );
+
+        if (flushPolicy == FlushBlock){
+            fflush(stdout);
+        }
+    }
+
+    fflush(stdout);
+}
+
+
+
+// size of blocks read from STDIN in playback mode (ie maximal event length)
+#define PLAY_BUFFER_SIZE (1024*1024)
+
+/**
+ * Reads the header of a compiled event list or capture (of identical length).
+ */
+void readPlaybackHeader( uint8_t * header ){
+
+    size_t len = 0;
+    size_t n;
+
+    while( len < EventListHeaderLength && (n = readStdin(&header[len], EventListHeaderLength - len)) > 0){
+        len += n;
+    }
 
-        parser_receivedData(&parser, &byte, 1 );
+    if (len < EventListHeaderLength){
+        fprintf(stderr, "Error: input is neither an event list nor a capture!\n");
+        exit(EXIT_FAILURE);
     }
 }
 
+void playCaptured( uint64_t time, uint8_t * bytes, size_t length ){
 
+    scheduler_wait( time - captureLastTime );
 
-typedef int (*Reader_t)(void);
-typedef uint8_t(*Converter_t)(uint8_t *,uint8_t *, uint8_t);
+    writeMidiBytes( bytes, length );
 
-void convert(Reader_t reader, Converter_t converter, uint8_t each){
+    captureLastTime = time;
+}
 
-    uint8_t src[16];
-    uint8_t dst[16];
-    uint8_t srcl = 0;
+void player(void){
 
-    void (*output)(uint8_t *,uint8_t) = [](uint8_t * data, uint8_t len){
+    static uint8_t buffer[PLAY_BUFFER_SIZE];
 
-        uint8_t buf[32];
+    readPlaybackHeader( buffer );
 
-        if (useHex){
-            byte_to_hex(buf, data, len);
-            fwrite( buf, 1, 2*len, stdout );
-        } else {
-            fwrite( data, 1, len, stdout );
+    if (memcmp(buffer, CaptureHeader, CaptureHeaderLength) == 0){
+        CaptureReader_t reader;
+        capturereader_init( &reader );
+
+        scheduler_start();
+
+        if (seekOpt.enabled){
+            seekCapture( &reader, playCaptured );
         }
-    };
 
-    int ch;
-    while( (ch = reader()) != EOF ){
-        uint8_t byte = (uint8_t)ch;
+        readCapture( &reader, playCaptured, PLAY_BUFFER_SIZE );
+        return;
+    }
 
-        if (useHex){
-            static uint8_t nibble = 0;
-            static uint8_t nibbles[2];
+    if (memcmp(buffer, EventListHeader, EventListHeaderLength) != 0){
+        fprintf(stderr, "Error: input is neither an event list nor a capture!\n");
+        exit(EXIT_FAILURE);
+    }
 
-            nibbles[nibble++] = byte;
+    if (seekOpt.enabled){
+        fprintf(stderr, "Error: can only seek in captures!\n");
+        exit(EXIT_FAILURE);
+    }
 
-            if (nibble >= 2){
-                if ( ! hex_to_byte(&src[srcl], nibbles, 1) ){
-                    fprintf(stderr, "Error: invalid hex input!\n");
-                }
-                srcl++;
-                nibble = 0;
+    size_t len = 0;
+    size_t n;
+
+    scheduler_start();
+
+    while( (n = readStdin(&buffer[len], sizeof(buffer) - len)) > 0 ){
+
+        len += n;
+
+        size_t pos = 0;
+        size_t consumed;
+
+        uint64_t delta;
+        uint8_t * bytes;
+        size_t length;
+
+        while( (consumed = eventlist_unpackEvent(&buffer[pos], len - pos, &delta, &bytes, &length)) > 0 ){
+
+            scheduler_wait( delta );
+
+            writeMidiBytes( bytes, length );
+
+            pos += consumed;
+        }
+
+        // keep incomplete event
+        len -= pos;
+        memmove(buffer, &buffer[pos], len);
+
+        if (len == sizeof(buffer)){
+            fprintf(stderr, "Error: event too long!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (len > 0){
+        fprintf(stderr, "Error: incomplete event at end of input!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Reads the records of a capture (following the header) from STDIN until the end marker and passes on any message.
+ */
+void readCapture( CaptureReader_t * reader, void (*handler)(uint64_t time, uint8_t * bytes, size_t length), size_t maxLength ){
+
+    static uint8_t buffer[PLAY_BUFFER_SIZE];
+    static uint8_t message[PLAY_BUFFER_SIZE];
+
+    size_t len = 0;
+    size_t n;
+
+    while( ! reader->Ended && (n = readStdin(&buffer[len], sizeof(buffer) - len)) > 0 ){
+
+        len += n;
+
+        size_t pos = 0;
+        size_t consumed;
+
+        uint64_t time;
+        size_t length;
+
+        while( ! reader->Ended && (consumed = capturereader_read(reader, &buffer[pos], len - pos, &time, message, maxLength, &length)) > 0 ){
+
+            if (length > 0){
+                handler( time, message, length );
             }
-        } else {
-            src[srcl++] = byte;
+
+            pos += consumed;
         }
 
-        if (srcl >= each){
+        if (reader->Ended){
+            break;
+        }
 
-            uint8_t dstl = converter(dst, src, srcl);
+        if (capturereader_isInvalid(reader, &buffer[pos], len - pos, maxLength)){
+            fprintf(stderr, "Error: invalid capture record!\n");
+            exit(EXIT_FAILURE);
+        }
 
-            output(dst, dstl);
+        // keep incomplete record
+        len -= pos;
+        memmove(buffer, &buffer[pos], len);
 
-            srcl = 0;
+        if (len == sizeof(buffer)){
+            fprintf(stderr, "Error: record too long!\n");
+            exit(EXIT_FAILURE);
         }
     }
-    // in case input terminated before group full
-    if (srcl > 0){
-        uint8_t dstl = converter(dst, src, srcl);
 
-        output(dst, dstl);
+    // the index and trailer are not needed for sequential reading
+    if ( ! reader->Ended ){
+        fprintf(stderr, "Error: incomplete capture at end of input!\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * Seeks (the file on) STDIN to the first message at or after the seek time and passes on the parameter selections
+ * as to restore the state of the receiver.
+ */
+void seekCapture( CaptureReader_t * reader, void (*handler)(uint64_t time, uint8_t * bytes, size_t length) ){
+
+    struct stat st;
+
+    if (fstat(STDIN_FILENO, &st) == -1 || ! S_ISREG(st.st_mode) || st.st_size == 0){
+        fprintf(stderr, "Error: can only seek in files!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    uint8_t * capture = (uint8_t*)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, STDIN_FILENO, 0);
+
+    if (capture == MAP_FAILED){
+        perror("error calling mmap()");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t offset = capture_seek( reader, capture, st.st_size, seekOpt.time );
+
+    munmap(capture, st.st_size);
+
+    if (offset == 0){
+        fprintf(stderr, "Error: invalid capture (or index)!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (lseek(STDIN_FILENO, offset, SEEK_SET) == -1){
+        perror("error calling lseek()");
+        exit(EXIT_FAILURE);
+    }
+
+    captureLastTime = seekOpt.time;
+
+    uint8_t bytes[6];
+
+    for(uint8_t i = 0; i < 16; i++){
+        if (capture_packParameterSelection( bytes, &reader->Parameters[i], i ) > 0){
+            handler( seekOpt.time, bytes, 3 );
+            handler( seekOpt.time, &bytes[3], 3 );
+        }
+    }
+}
+
+/**
+ * Parses [[<hh>:]<mm>:]<ss>[.<fraction>] into ns.
+ */
+bool parseSeekTime( char * str, uint64_t * time ){
+
+    uint64_t seconds = 0;
+    uint64_t fraction = 0;
+    uint64_t scale = 1000000000;
+
+    uint8_t fields = 0;
+
+    while (true){
+
+        if ( ! isdigit(*str) ){
+            return false;
+        }
+
+        uint64_t value = strtoull(str, &str, 10);
+
+        seconds = seconds * 60 + value;
+        fields++;
+
+        if (*str != ':'){
+            break;
+        }
+        if (fields == 3){
+            return false;
+        }
+        str++;
+    }
+
+    if (*str == '.'){
+        str++;
+        if ( ! isdigit(*str) ){
+            return false;
+        }
+        while (isdigit(*str)){
+            scale /= 10;
+            fraction += (*str - '0') * scale;
+            str++;
+        }
+    }
+
+    if (*str != '\0'){
+        return false;
+    }
+
+    *time = seconds * 1000000000 + fraction;
+
+    return true;
+}
+
+void captureIndexAdd( CaptureIndexEntry_t * entry, void * ){
+
+    if (captureIndex.length == captureIndex.size){
+        captureIndex.size = captureIndex.size > 0 ? 2 * captureIndex.size : 256;
+        captureIndex.entries = (CaptureIndexEntry_t*)realloc( captureIndex.entries, captureIndex.size * sizeof(CaptureIndexEntry_t) );
+
+        if (captureIndex.entries == NULL){
+            fprintf(stderr, "Error: out of memory!\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    captureIndex.entries[captureIndex.length++] = *entry;
+}
+
+void captureStart(void){
+
+    uint8_t header[CaptureHeaderLength];
+
+    fwrite( header, 1, capturewriter_init( &captureWriter, header, captureIndexAdd, NULL ), stdout );
+}
+
+/**
+ * Warns about a message that is too long to be captured (and thus missing from the output).
+ */
+void discardedMessage( uint64_t time, size_t length ){
+    fprintf(stderr, "Warning: discarding message at %llu ns (%zu bytes or more, max %d)\n", (unsigned long long)time, length, MESSAGE_BUFFER_SIZE);
+}
+
+void captureMessage( uint64_t time, uint8_t * bytes, size_t length ){
+
+    static uint8_t record[CaptureSyncMaxLength + VarIntMaxLength + 2 * MESSAGE_BUFFER_SIZE];
+
+    if (length > MESSAGE_BUFFER_SIZE){
+        discardedMessage( time, length );
+        return;
+    }
+
+    fwrite( record, 1, capturewriter_writeMessage( &captureWriter, record, time, bytes, length ), stdout );
+}
+
+void captureFinish(void){
+
+    size_t size = VarIntMaxLength + 1 + captureIndex.length * CaptureIndexEntryLength + CaptureTrailerLength;
+    uint8_t * trailer = (uint8_t*)malloc( size );
+
+    if (trailer == NULL){
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    fwrite( trailer, 1, capturewriter_finish( &captureWriter, trailer, captureIndex.entries, captureIndex.length ), stdout );
+
+    fflush(stdout);
+
+    free( trailer );
+    free( captureIndex.entries );
+}
+
+// start of recording (monotonic clock)
+struct timespec recordStart;
+
+void recorder(void){
+
+    uint8_t sysexBuffer[MESSAGE_BUFFER_SIZE];
+    Message_t msg;
+    msg.Data.SysEx.ByteData = sysexBuffer;
+
+    uint8_t dataBuffer[MESSAGE_BUFFER_SIZE];
+    Parser_t parser;
+    parser_init(&parser, runningStatusEnabled, dataBuffer, sizeof(dataBuffer), &msg, recordedMessage, recordDiscardingData, NULL );
+
+    static uint8_t buffer[PARSE_BUFFER_SIZE];
+
+    setvbuf(stdout, NULL, _IOFBF, PARSE_BUFFER_SIZE);
+
+    captureStart();
+
+    if (clock_gettime(CLOCK_MONOTONIC, &recordStart) == -1) {
+        perror("error calling clock_gettime()");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t len;
+    while( (len = readStdin(buffer, sizeof(buffer))) > 0 ){
+
+        parser_receivedData(&parser, buffer, len );
+
+        fflush(stdout);
+    }
+
+    captureFinish();
+}
+
+void recordedMessage( Message_t * msg, void * ){
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    static uint8_t bytes[MESSAGE_BUFFER_SIZE];
+    size_t length = pack( bytes, msg );
+
+    if (length == 0){
+        return;
+    }
+
+    captureMessage( (uint64_t)timespecDiffNs(&now, &recordStart), bytes, length );
+}
+
+void recordDiscardingData( uint8_t * data, size_t length, void * context ){
+
+    // the parser discards its full buffer if a message (ie SysEx) does not fit
+    if (length >= MESSAGE_BUFFER_SIZE){
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        discardedMessage( (uint64_t)timespecDiffNs(&now, &recordStart), length );
+    }
+
+    discardingData( data, length, context );
+}
+
+/**
+ * Stringifies msg followed by a newline into buffer or, if it does not fit (eg long SysEx as hex), into an allocated
+ * one (to be freed by the caller).
+ *
+ * @return  NULL if msg can not be stringified
+ */
+uint8_t * messageLine( uint8_t * buffer, size_t size, Message_t * msg, int * length ){
+
+    // (newline)
+    *length = MessagetoStringBounded( buffer, size - 1, msg );
+
+    if (*length > 0){
+        buffer[(*length)++] = '\n';
+        return buffer;
+    }
+
+    *length = MessageStringLength( msg );
+
+    if (*length <= 0){
+        return NULL;
+    }
+
+    // newline and terminating null
+    uint8_t * line = (uint8_t*)malloc( *length + 2 );
+
+    if (line == NULL){
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    MessagetoString( line, msg );
+
+    line[(*length)++] = '\n';
+
+    return line;
+}
+
+void decodedMessage( uint64_t time, uint8_t * bytes, size_t length ){
+
+    static uint8_t sysexBuffer[MESSAGE_BUFFER_SIZE];
+    Message_t msg;
+    msg.Data.SysEx.ByteData = sysexBuffer;
+
+    uint8_t stringBuffer[255];
+    uint8_t * line;
+    int len;
+
+    if ( ! unpack( bytes, length, &msg ) || (line = messageLine( stringBuffer, sizeof(stringBuffer), &msg, &len )) == NULL ){
+        discardingData( bytes, length, NULL );
+        return;
+    }
+
+    if (timedOpt.enabled){
+        // delays in units derived from the absolute times such that rounding errors do not accumulate
+        uint64_t unit = getTimedUnitNs();
+
+        printf("%llu ", (unsigned long long)(time / unit - captureLastTime / unit));
+
+        captureLastTime = time;
+    }
+
+    fwrite(line, 1, len, stdout);
+
+    if (line != stringBuffer){
+        free(line);
+    }
+}
+
+void decoder(void){
+
+    uint8_t header[CaptureHeaderLength];
+
+    readPlaybackHeader( header );
+
+    if (memcmp(header, CaptureHeader, CaptureHeaderLength) != 0){
+        fprintf(stderr, "Error: input is not a capture!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    setvbuf(stdout, NULL, _IOFBF, PARSE_BUFFER_SIZE);
+
+    CaptureReader_t reader;
+    capturereader_init( &reader );
+
+    if (seekOpt.enabled){
+        seekCapture( &reader, decodedMessage );
+    }
+
+    readCapture( &reader, decodedMessage, MESSAGE_BUFFER_SIZE );
+
+    fflush(stdout);
+}
+
+// (timed) generation script source of merge
+typedef struct {
+    FILE * file;
+    uint64_t time;
+    uint8_t bytes[255];
+    uint8_t sysexBuffer[128];
+} MergeScript_t;
+
+bool mergeScriptNext( void * cursor, MergeEvent_t * event ){
+
+    MergeScript_t * script = (MergeScript_t*)cursor;
+
+    uint8_t line[255];
+
+    Message_t msg;
+    msg.Data.SysEx.ByteData = script->sysexBuffer;
+
+    while(fgets((char*)line, sizeof(line), script->file) != NULL){
+
+        uint8_t *args[32];
+        uint8_t argsCount = stringToArgs( args, 32, line, strlen((char*)line) );
+
+        if (argsCount < 2){
+            continue;
+        }
+
+        script->time += strtoul((char*)args[0], NULL, 10) * getTimedUnitNs();
+
+        int result = MessagefromArgs( &msg, argsCount - 1, &args[1] );
+        size_t length;
+
+        if (result != StringifierResultOk || (length = pack( script->bytes, &msg )) == 0){
+            generatorError( result, argsCount - 1, &args[1] );
+            continue;
+        }
+
+        event->Time = script->time;
+        event->Status = script->bytes[0];
+        event->MetaType = 0;
+        event->Data = &script->bytes[1];
+        event->Length = length - 1;
+        event->Continues = false;
+
+        return true;
+    }
+
+    return false;
+}
+
+void merger(int argc, char * argv[]){
+
+    MergeSource_t * sources = (MergeSource_t*)calloc( argc, sizeof(MergeSource_t) );
+    size_t * heap = (size_t*)calloc( argc, sizeof(size_t) );
+
+    if (sources == NULL || heap == NULL){
+        fprintf(stderr, "Error: out of memory!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for(int i = 0; i < argc; i++){
+
+        int fd = open( argv[i], O_RDONLY );
+        struct stat st;
+
+        if (fd == -1 || fstat(fd, &st) == -1){
+            fprintf(stderr, "Error: failed to open %s\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+
+        // captures are read in place, anything else is assumed to be a script
+        uint8_t * data = st.st_size > 0 ? (uint8_t*)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0) : NULL;
+
+        MergeCaptureCursor_t * capture = (MergeCaptureCursor_t*)malloc( sizeof(MergeCaptureCursor_t) );
+
+        if (capture == NULL){
+            fprintf(stderr, "Error: out of memory!\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (data != NULL && data != MAP_FAILED && mergecapture_init( capture, data, st.st_size )){
+            close(fd);
+
+            sources[i].Next = mergecapture_next;
+            sources[i].Cursor = capture;
+            continue;
+        }
+
+        free( capture );
+
+        if (data != NULL && data != MAP_FAILED){
+            munmap( data, st.st_size );
+        }
+
+        if ( ! timedOpt.enabled ){
+            fprintf(stderr, "Error: %s is not a capture (scripts require --timed)\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+
+        MergeScript_t * script = (MergeScript_t*)malloc( sizeof(MergeScript_t) );
+
+        if (script == NULL || (script->file = fdopen( fd, "r" )) == NULL){
+            fprintf(stderr, "Error: failed to open %s\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+
+        script->time = 0;
+
+        sources[i].Next = mergeScriptNext;
+        sources[i].Cursor = script;
+    }
+
+    setvbuf(stdout, NULL, _IOFBF, PARSE_BUFFER_SIZE);
+
+    Merger_t merger;
+    merger_init( &merger, sources, argc, heap, false );
+
+    captureStart();
+
+    MergeEvent_t event;
+    static uint8_t bytes[MESSAGE_BUFFER_SIZE];
+
+    while( merger_next( &merger, &event ) ){
+
+        // (longer messages are discarded like when recording)
+        if (event.Length >= sizeof(bytes)){
+            discardedMessage( event.Time, 1 + event.Length );
+            continue;
+        }
+
+        captureMessage( event.Time, bytes, merge_packEvent( bytes, &event ) );
     }
 
+    captureFinish();
+
+    // (sources are released at exit)
+}
+
+// size of input chunks read (and converted) at once
+#define CONVERT_BUFFER_SIZE (1024*1024)
+
+typedef size_t (*Reader_t)(uint8_t * buffer, size_t maxLength);
+typedef size_t (*Converter_t)(ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length);
+typedef size_t (*Flusher_t)(ConverterState_t * state, uint8_t * dst);
+
+size_t readStdin( uint8_t * buffer, size_t maxLength ){
+    ssize_t len;
+
+    do {
+        len = read(STDIN_FILENO, buffer, maxLength);
+    } while (len < 0 && errno == EINTR);
+
+    return len > 0 ? (size_t)len : 0;
+}
+
+void convertOutput( uint8_t * data, size_t len ){
+
+    static uint8_t hex[2 * (2 * CONVERT_BUFFER_SIZE + 16)];
+
+    if (len == 0){
+        return;
+    }
+
+    if (useHex){
+        byte_to_hex(hex, data, len);
+        fwrite( hex, 1, 2*len, stdout );
+    } else {
+        fwrite( data, 1, len, stdout );
+    }
+}
+
+void convert(Reader_t reader, Converter_t converter, Flusher_t flusher){
+
+    // nibblizing doubles the size, other conversions require less (plus a pending group)
+    // (src holds a pending hex digit of the previous chunk in front)
+    static uint8_t src[1 + CONVERT_BUFFER_SIZE];
+    static uint8_t bytes[CONVERT_BUFFER_SIZE / 2 + 1];
+    static uint8_t dst[2 * CONVERT_BUFFER_SIZE + 16];
+
+    ConverterState_t state;
+    converter_reset(&state);
+
+    // odd hex digit of the previous chunk
+    bool pending = false;
+    uint8_t pendingDigit = 0;
+
+    size_t len;
+    while( (len = reader(&src[1], CONVERT_BUFFER_SIZE)) > 0 ){
+
+        uint8_t * data = &src[1];
+
+        if (useHex){
+
+            // compact to hex digits (in place, after the pending digit) and decode them at once
+            size_t digits = 0;
+            if (pending){
+                src[digits++] = pendingDigit;
+            }
+
+            for(size_t i = 1; i <= len; i++){
+                if ( ! isspace(src[i]) ){
+                    src[digits++] = src[i];
+                }
+            }
+
+            // keep an odd digit for the next chunk
+            pending = digits % 2 == 1;
+            if (pending){
+                pendingDigit = src[--digits];
+            }
+
+            if (digits > 0 && ! hex_to_byte(bytes, src, digits / 2) ){
+                fprintf(stderr, "Error: invalid hex input!\n");
+                exit(EXIT_FAILURE);
+            }
+
+            data = bytes;
+            len = digits / 2;
+        }
+
+        convertOutput( dst, converter(&state, dst, data, len) );
+    }
+
+    if (pending){
+        fprintf(stderr, "Error: invalid hex input (odd number of digits)!\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // in case input terminated before group full
+    if (flusher != NULL){
+        convertOutput( dst, flusher(&state, dst) );
+    }
+
+    fflush(stdout);
 }
 
 void parsedMessage( Message_t * msg, void * context ){
@@ -704,7 +1614,9 @@ void parsedMessage( Message_t * msg, void * context ){
                 printf("nrpn %d %d %d\n", nrpnChannel, controller, value);
             }
 
-            fflush(stdout);
+            if (flushPolicy == FlushMessage){
+                fflush(stdout);
+            }
 
             nrpnMsgCount = 0;
 
@@ -713,10 +1625,11 @@ void parsedMessage( Message_t * msg, void * context ){
     }
 
     uint8_t stringBuffer[255];
+    int length;
 
-    int length = MessagetoString(  stringBuffer, msg );
+    uint8_t * line = messageLine( stringBuffer, sizeof(stringBuffer), msg, &length );
 
-    if ( length > 0 ) {
+    if ( line != NULL ) {
 
         if (timedOpt.enabled){
 
@@ -728,13 +1641,19 @@ void parsedMessage( Message_t * msg, void * context ){
             timedOpt.lastTimestamp = now;
         }
 
-        printf("%s\n", stringBuffer);
+        fwrite(line, 1, length, stdout);
 
-        fflush(stdout);
+        if (line != stringBuffer){
+            free(line);
+        }
+
+        if (flushPolicy == FlushMessage){
+            fflush(stdout);
+        }
     }
 }
 
-void discardingData( uint8_t * data, uint8_t length, void * context ){
+void discardingData( uint8_t * data, size_t length, void * context ){
 
     if (printDiscardedData == false){
         return;
@@ -775,6 +1694,14 @@ int main(int argc, char * argv[], char * env[]){
                 {"convert", required_argument, 0, 0},
                 {"hex", no_argument, 0, 0},
                 {"nrpn-filter", no_argument, 0, 'n'},
+                {"flush", required_argument, 0, 0},
+                {"compile", no_argument, 0, 0},
+                {"play", no_argument, 0, 0},
+                {"record", no_argument, 0, 0},
+                {"encode-capture", no_argument, 0, 0},
+                {"decode-capture", no_argument, 0, 0},
+                {"seek", required_argument, 0, 0},
+                {"merge", no_argument, 0, 0},
                 {0,         0,              0,  0 }
         };
 
@@ -821,6 +1748,50 @@ int main(int argc, char * argv[], char * env[]){
                 else if (strcmp(long_options[option_index].name, "hex") == 0){
                     useHex = true;
                 }
+                else if (strcmp(long_options[option_index].name, "compile") == 0 || strcmp(long_options[option_index].name, "play") == 0){
+                    if (mode != ModeUndefined){
+                        printf("Can only enter one mode!\n");
+                        exit(EXIT_FAILURE);
+                    }
+                    mode = strcmp(long_options[option_index].name, "compile") == 0 ? ModeCompile : ModePlay;
+                }
+                else if (strcmp(long_options[option_index].name, "record") == 0 ||
+                         strcmp(long_options[option_index].name, "encode-capture") == 0 ||
+                         strcmp(long_options[option_index].name, "decode-capture") == 0 ||
+                         strcmp(long_options[option_index].name, "merge") == 0){
+                    if (mode != ModeUndefined){
+                        printf("Can only enter one mode!\n");
+                        exit(EXIT_FAILURE);
+                    }
+                    if (strcmp(long_options[option_index].name, "record") == 0){
+                        mode = ModeRecord;
+                    } else if (strcmp(long_options[option_index].name, "encode-capture") == 0){
+                        mode = ModeEncodeCapture;
+                    } else if (strcmp(long_options[option_index].name, "merge") == 0){
+                        mode = ModeMerge;
+                    } else {
+                        mode = ModeDecodeCapture;
+                    }
+                }
+                else if (strcmp(long_options[option_index].name, "seek") == 0){
+                    if ( ! parseSeekTime(optarg, &seekOpt.time) ){
+                        printf("Error: invalid seek time, [[<hh>:]<mm>:]<ss>[.<fraction>] expected, %s given\n", optarg);
+                        exit(EXIT_FAILURE);
+                    }
+                    seekOpt.enabled = true;
+                }
+                else if (strcmp(long_options[option_index].name, "flush") == 0){
+                    if (strcmp(optarg, "message") == 0){
+                        flushPolicy = FlushMessage;
+                    } else if (strcmp(optarg, "block") == 0){
+                        flushPolicy = FlushBlock;
+                    } else if (strcmp(optarg, "exit") == 0){
+                        flushPolicy = FlushExit;
+                    } else {
+                        printf("Flush policy not recognized!\n");
+                        exit(EXIT_FAILURE);
+                    }
+                }
                 break;
 
             case '?':
@@ -895,6 +1866,11 @@ int main(int argc, char * argv[], char * env[]){
         exit(EXIT_FAILURE);
     }
 
+    if (seekOpt.enabled && mode != ModePlay && mode != ModeDecodeCapture){
+        printf("Can only seek when playing or decoding captures!\n");
+        exit(EXIT_FAILURE);
+    }
+
 
     if (mode == ModeGenerate) {
 
@@ -1029,35 +2005,68 @@ int main(int argc, char * argv[], char * env[]){
         parser();
     }
 
+    if (mode == ModeCompile || mode == ModePlay){
+        if (optind < argc) {
+            printf("Compile and playback mode may not be called with additional arguments - data is read from stdin only.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (mode == ModeCompile){
+            // enter generator loop (reads stdin until eof)
+            generator();
+        } else {
+            player();
+        }
+    }
+
+    if (mode == ModeRecord || mode == ModeEncodeCapture || mode == ModeDecodeCapture){
+        if (optind < argc) {
+            printf("Capture modes may not be called with additional arguments - data is read from stdin only.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        if (mode == ModeRecord){
+            // enter recording loop (reads stdin until eof)
+            recorder();
+        } else if (mode == ModeEncodeCapture){
+            // enter generator loop (reads stdin until eof)
+            generator();
+        } else {
+            decoder();
+        }
+    }
+
+    if (mode == ModeMerge){
+        if (optind >= argc) {
+            printf("Merge mode requires at least one file.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        merger( argc - optind, &argv[optind] );
+    }
+
     if (mode == ModeConvert){
 
-        Converter_t converter;
-        uint8_t each;
+        Converter_t converter = NULL;
+        Flusher_t flusher = NULL;
 
         switch(process){
             case ProcessNibblize:
-                converter = [](uint8_t * dst, uint8_t * src, uint8_t length){
-                    return nibblize(dst, src, length);
+                // stateless
+                converter = [](ConverterState_t *, uint8_t * dst, uint8_t * src, size_t length){
+                    return nibblizeBlock(dst, src, length);
                 };
-                each = 1;
                 break;
             case ProcessDeNibblize:
-                converter = [](uint8_t * dst, uint8_t * src, uint8_t length){
-                    return denibblize(dst, src, length);
-                };
-                each = 2;
+                converter = denibblizeStream;
                 break;
             case ProcessSevenbitize:
-                converter = [](uint8_t * dst, uint8_t * src, uint8_t length){
-                    return sevenbitize(dst, src, length);
-                };
-                each = 7;
+                converter = sevenbitizeStream;
+                flusher = sevenbitizeFlush;
                 break;
             case ProcessDeSevenbitize:
-                converter = [](uint8_t * dst, uint8_t * src, uint8_t length){
-                    return desevenbitize(dst, src, length);
-                };
-                each = 8;
+                converter = desevenbitizeStream;
+                flusher = desevenbitizeFlush;
                 break;
         }
 
@@ -1067,22 +2076,22 @@ int main(int argc, char * argv[], char * env[]){
 
             gargv = (uint8_t**)&argv[optind];
 
-            reader = []() -> int {
-                static int i = 0;
-                static int len = strlen((char*)gargv[0]);
+            reader = [](uint8_t * buffer, size_t maxLength) -> size_t {
+                static size_t i = 0;
+                static size_t len = strlen((char*)gargv[0]);
 
-                if (i >= len){
-                    return EOF;
-                }
-                return gargv[0][i++];
+                size_t n = len - i < maxLength ? len - i : maxLength;
+
+                memcpy(buffer, &gargv[0][i], n);
+                i += n;
+
+                return n;
             };
         } else {
-            reader = []() -> int {
-                return fgetc(stdin);
-            };
+            reader = readStdin;
         }
 
-        convert( reader, converter, each);
+        convert( reader, converter, flusher );
     }
 
     return EXIT_SUCCESS;
@@ -0,0 +1,185 @@
+#include <midimessage/eventlist.h>
+#include <midimessage/stringifier.h>
+#include <midimessage/packers.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    size_t eventlist_packEvent( uint8_t * dst, uint64_t delta, uint8_t * bytes, size_t length ){
+        ASSERT( dst != NULL );
+        ASSERT( bytes != NULL || length == 0 );
+
+        size_t len = packVarInt( dst, delta );
+        len += packVarInt( &dst[len], length );
+
+        memcpy( &dst[len], bytes, length );
+
+        return len + length;
+    }
+
+    size_t eventlist_unpackEvent( uint8_t * src, size_t len, uint64_t * delta, uint8_t ** bytes, size_t * length ){
+        ASSERT( src != NULL );
+        ASSERT( delta != NULL );
+        ASSERT( bytes != NULL );
+        ASSERT( length != NULL );
+
+        uint64_t l;
+
+        size_t n = unpackVarInt( src, len, delta );
+        if (n == 0){
+            return 0;
+        }
+
+        uint8_t m = unpackVarInt( &src[n], len - n, &l );
+        if (m == 0){
+            return 0;
+        }
+        n += m;
+
+        if (l > len - n){
+            return 0;
+        }
+
+        *bytes = &src[n];
+        *length = l;
+
+        return n + l;
+    }
+
+    // writes a control change event (consuming the pending delta)
+    static size_t eventlist_packControlChange( uint8_t * dst, uint64_t * delta, uint8_t channel, uint8_t controller, uint8_t value ){
+        uint8_t bytes[MsgLenControlChange];
+
+        size_t len = eventlist_packEvent( dst, *delta, bytes, packControlChange( bytes, channel, controller, value ) );
+
+        *delta = 0;
+
+        return len;
+    }
+
+    static int eventlist_compileNrpn( uint8_t * dst, size_t * dstLength, uint64_t * delta, uint8_t argsCount, uint8_t ** args ){
+
+        if (argsCount < 4 || 5 < argsCount) {
+            return StringifierResultWrongArgCount;
+        }
+
+        uint8_t channel = atoi((char*)args[1]);
+        if (channel > MaxU4) {
+            return StringifierResultInvalidU4;
+        }
+
+        uint16_t controller = atoi((char*)args[2]);
+        if (controller > MaxU14) {
+            return StringifierResultInvalidU14;
+        }
+
+        uint8_t action = CcDataEntryMSB;
+        uint16_t value = 0;
+
+        if (strcmp((char*)args[3], "inc") == 0 || strcmp((char*)args[3], "dec") == 0){
+
+            action = args[3][0] == 'i' ? CcDataIncrement : CcDataDecrement;
+
+            if (argsCount == 5) {
+                value = atoi((char*)args[4]);
+
+                if (value > MaxU7) {
+                    return StringifierResultInvalidU7;
+                }
+            }
+        } else {
+
+            if (argsCount != 4) {
+                return StringifierResultWrongArgCount;
+            }
+
+            value = atoi((char*)args[3]);
+
+            if (value > MaxU14) {
+                return StringifierResultInvalidU14;
+            }
+        }
+
+        size_t len = eventlist_packControlChange( dst, delta, channel, CcNonRegisteredParameterMSB, (controller >> 7) & DataMask );
+        len += eventlist_packControlChange( &dst[len], delta, channel, CcNonRegisteredParameterLSB, controller & DataMask );
+
+        if (action == CcDataEntryMSB){
+            len += eventlist_packControlChange( &dst[len], delta, channel, CcDataEntryMSB, (value >> 7) & DataMask );
+            len += eventlist_packControlChange( &dst[len], delta, channel, CcDataEntryLSB, value & DataMask );
+        } else {
+            len += eventlist_packControlChange( &dst[len], delta, channel, action, value & DataMask );
+        }
+
+        *dstLength = len;
+
+        return StringifierResultOk;
+    }
+
+    int eventlist_compileLine( uint8_t * dst, size_t * dstLength, uint8_t * line, uint8_t lineLength, uint64_t unitNs, uint64_t * delta, Message_t * msg ){
+        ASSERT( dst != NULL );
+        ASSERT( dstLength != NULL );
+        ASSERT( line != NULL );
+        ASSERT( delta != NULL );
+        ASSERT( msg != NULL );
+
+        *dstLength = 0;
+
+        uint8_t * args[32];
+        uint8_t argsCount = stringToArgs( args, 32, line, lineLength );
+
+        if (argsCount == 0){
+            return StringifierResultOk;
+        }
+
+        uint8_t ** firstArg = args;
+
+        if (unitNs > 0){
+            *delta += strtoull( (char*)args[0], NULL, 10 ) * unitNs;
+
+            argsCount--;
+            firstArg = &firstArg[1];
+
+            // a delay only, to be passed on to the next event
+            if (argsCount == 0){
+                return StringifierResultOk;
+            }
+        }
+
+        if (strcmp((char*)firstArg[0], "nrpn") == 0){
+            return eventlist_compileNrpn( dst, dstLength, delta, argsCount, firstArg );
+        }
+
+        int result = MessagefromArgs( msg, argsCount, firstArg );
+
+        if (result != StringifierResultOk){
+            return result;
+        }
+
+        // pack behind the space reserved for the varints, then move into place
+        uint8_t * bytes = &dst[2 * VarIntMaxLength];
+        size_t length = pack( bytes, msg );
+
+        if (length == 0){
+            return StringifierResultPackError;
+        }
+
+        size_t len = packVarInt( dst, *delta );
+        len += packVarInt( &dst[len], length );
+
+        memmove( &dst[len], bytes, length );
+
+        *dstLength = len + length;
+        *delta = 0;
+
+        return StringifierResultOk;
+    }
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
@@ -0,0 +1,259 @@
+#include <midimessage/merge.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    static inline bool isBefore( Merger_t * merger, size_t a, size_t b ){
+        uint64_t ta = merger->Sources[a].Event.Time;
+        uint64_t tb = merger->Sources[b].Event.Time;
+
+        return ta < tb || (ta == tb && a < b);
+    }
+
+    static void heapPush( Merger_t * merger, size_t source ){
+        size_t i = merger->HeapLength++;
+
+        while (i > 0){
+            size_t parent = (i - 1) / 2;
+
+            if ( ! isBefore( merger, source, merger->Heap[parent] ) ){
+                break;
+            }
+
+            merger->Heap[i] = merger->Heap[parent];
+            i = parent;
+        }
+
+        merger->Heap[i] = source;
+    }
+
+    // replaces the top (or removes it if source is the last entry), restoring the heap order
+    static void heapReplaceTop( Merger_t * merger, size_t source ){
+        size_t i = 0;
+
+        while (true){
+            size_t child = 2 * i + 1;
+
+            if (child >= merger->HeapLength){
+                break;
+            }
+            if (child + 1 < merger->HeapLength && isBefore( merger, merger->Heap[child + 1], merger->Heap[child] )){
+                child++;
+            }
+            if ( ! isBefore( merger, merger->Heap[child], source ) ){
+                break;
+            }
+
+            merger->Heap[i] = merger->Heap[child];
+            i = child;
+        }
+
+        merger->Heap[i] = source;
+    }
+
+    static void heapPop( Merger_t * merger ){
+        if (--merger->HeapLength > 0){
+            heapReplaceTop( merger, merger->Heap[merger->HeapLength] );
+        }
+    }
+
+    void merger_init( Merger_t * merger, MergeSource_t * sources, size_t count, size_t * heap, bool runningStatusEnabled ){
+        ASSERT( merger != NULL );
+        ASSERT( sources != NULL || count == 0 );
+        ASSERT( heap != NULL || count == 0 );
+
+        merger->Sources = sources;
+        merger->Count = count;
+        merger->Heap = heap;
+        merger->HeapLength = 0;
+        merger->Locked = false;
+        merger->Pending = false;
+        merger->Time = 0;
+        merger->RunningStatusEnabled = runningStatusEnabled;
+        merger->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+        for(size_t i = 0; i < count; i++){
+            ASSERT( sources[i].Next != NULL );
+
+            if (sources[i].Next( sources[i].Cursor, &sources[i].Event )){
+                heapPush( merger, i );
+            }
+        }
+    }
+
+    bool merger_next( Merger_t * merger, MergeEvent_t * event ){
+        ASSERT( merger != NULL );
+        ASSERT( event != NULL );
+
+        // the source of the previous event is advanced only now, such that its data stays valid until this call
+        if (merger->Pending){
+            size_t source = merger->Heap[0];
+            MergeSource_t * s = &merger->Sources[source];
+
+            if ( ! s->Next( s->Cursor, &s->Event ) ){
+                heapPop( merger );
+                merger->Locked = false;
+            }
+            // while locked, the source stays on top regardless of its time
+            else if ( ! merger->Locked ){
+                heapReplaceTop( merger, source );
+            }
+
+            merger->Pending = false;
+        }
+
+        if (merger->HeapLength == 0){
+            return false;
+        }
+
+        size_t source = merger->Heap[0];
+
+        *event = merger->Sources[source].Event;
+        event->Source = source;
+        event->OmitStatus = false;
+
+        if (event->Time < merger->Time){
+            event->Time = merger->Time;
+        }
+        merger->Time = event->Time;
+
+        if (event->Status == MergeStatusMeta){
+            // (meta events do not occur in MIDI streams)
+        } else if (event->Status == 0){
+            merger->RunningStatus = MidiMessage_RunningStatusNotSet;
+        } else if (updateRunningStatus( &merger->RunningStatus, event->Status ) && isRunningStatus(event->Status)){
+            event->OmitStatus = merger->RunningStatusEnabled;
+        }
+
+        merger->Locked = event->Continues;
+        merger->Pending = true;
+
+        return true;
+    }
+
+    int mergesmf_init( MergeSmfCursor_t * cursor, uint8_t * data, size_t length, size_t * offset, bool metaEnabled ){
+        ASSERT( cursor != NULL );
+
+        cursor->MetaEnabled = metaEnabled;
+        cursor->SysEx = false;
+
+        return smf_nextTrack( data, length, offset, &cursor->Track );
+    }
+
+    bool mergesmf_next( void * c, MergeEvent_t * event ){
+        ASSERT( c != NULL );
+        ASSERT( event != NULL );
+
+        MergeSmfCursor_t * cursor = (MergeSmfCursor_t*)c;
+        SmfEvent_t e;
+
+        while( smf_readEvent( &cursor->Track, &e ) == SmfResultOk ){
+
+            event->Time = e.Time;
+            event->MetaType = 0;
+            event->Continues = false;
+
+            if (e.Type == SmfEventTypeMeta){
+                if ( ! cursor->MetaEnabled || e.MetaType == SmfMetaEndOfTrack ){
+                    continue;
+                }
+                event->Status = MergeStatusMeta;
+                event->MetaType = e.MetaType;
+                event->Data = e.Data;
+                event->Length = e.Length;
+            }
+            else if (e.Type == SmfEventTypeMidi){
+                // the data bytes precede the current position (also if the status was omitted)
+                event->Status = e.Data[0];
+                event->Data = &cursor->Track.Data[cursor->Track.Position - (e.Length - 1)];
+                event->Length = e.Length - 1;
+
+                cursor->SysEx = false;
+            }
+            else {
+                bool complete = e.Length > 0 && e.Data[e.Length - 1] == SystemMessageEndOfExclusive;
+
+                if (e.Type == SmfEventTypeSysEx){
+                    event->Status = SystemMessageSystemExclusive;
+                    event->Continues = ! complete;
+                } else {
+                    event->Status = 0;
+                    event->Continues = cursor->SysEx && ! complete;
+                }
+                event->Data = e.Data;
+                event->Length = e.Length;
+
+                cursor->SysEx = event->Continues;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool mergecapture_init( MergeCaptureCursor_t * cursor, uint8_t * data, size_t length ){
+        ASSERT( cursor != NULL );
+        ASSERT( data != NULL || length == 0 );
+
+        capturereader_init( &cursor->Reader );
+        cursor->Data = data;
+        cursor->Length = length;
+        cursor->Position = CaptureHeaderLength;
+
+        return length >= CaptureHeaderLength && memcmp( data, CaptureHeader, CaptureHeaderLength ) == 0;
+    }
+
+    bool mergecapture_next( void * c, MergeEvent_t * event ){
+        ASSERT( c != NULL );
+        ASSERT( event != NULL );
+
+        MergeCaptureCursor_t * cursor = (MergeCaptureCursor_t*)c;
+
+        while ( ! cursor->Reader.Ended ){
+
+            uint8_t * src = &cursor->Data[cursor->Position];
+            size_t len = cursor->Length - cursor->Position;
+
+            // the status is derived from the record before reading (running status)
+            uint64_t delta;
+            uint8_t k = unpackVarInt( src, len, &delta );
+            uint8_t runningStatus = cursor->Reader.RunningStatus;
+
+            uint64_t time;
+            size_t length;
+            size_t n = capturereader_read( &cursor->Reader, src, len, &time, NULL, len, &length );
+
+            if (k == 0 || n == 0){
+                return false;
+            }
+
+            cursor->Position += n;
+
+            if (length == 0){
+                continue;
+            }
+
+            event->Time = time;
+            event->MetaType = 0;
+            event->Continues = false;
+            event->Status = isDataByte( src[k] ) ? runningStatus : src[k];
+
+            // the (data) bytes following the status are stored last (also for SysEx)
+            event->Data = &src[n - (length - 1)];
+            event->Length = length - 1;
+
+            return true;
+        }
+
+        return false;
+    }
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
@@ -4,6 +4,13 @@
 
 
 #include <stddef.h>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 #include "midimessage/midimessage.h"
 #include "midimessage/packers.h"
@@ -25,59 +32,8 @@ namespace MidiMessage {
         if ( ! isControlByte(bytes[0]) ){
             return false;
         }
-/*
-
-    StatusClassNoteOff                  = 0x80,
-    StatusClassNoteOn                   = 0x90,
-    StatusClassPolyphonicKeyPressure    = 0xA0,
-    StatusClassControlChange            = 0xB0,
-    StatusClassProgramChange            = 0xC0,
-    StatusClassChannelPressure          = 0xD0,
-    StatusClassPitchBendChange          = 0xE0,
-    StatusClassSystemMessage            = 0xF0
-
-    SystemMessageSystemExclusive = 0xF0,
-    SystemMessageMtcQuarterFrame = 0xF1,
-    SystemMessageSongPositionPointer = 0xF2,
-    SystemMessageSongSelect = 0xF3,
-    SystemMessageTuneRequest = 0xF6,
-    SystemMessageEndOfExclusive = 0xF7,
-    SystemMessageTimingClock = 0xF8,
-    SystemMessageStart = 0xFA,
-    SystemMessageContinue = 0xFB,
-    SystemMessageStop = 0xFC,
-    SystemMessageActiveSensing = 0xFE,
-    SystemMessageReset = 0xFF
-*/
-
-        static const constexpr uint8_t lengthLUT[] = {
-          3, // 0 8* note off
-          3, // 1 9* note on
-          3, // 2 A* poly key press
-          3, // 3 B* cc
-          2, // 4 C* pc
-          2, // 5 D* ch press
-          3, // 6 E* pitch bend
-          0, // 7 F0 (sysex handled separately, pretty offset :)
-
-          2, // 8 F1 Mtc qf
-          3, // 9 F2 song pos p
-          2, // 10 F3 song sel
-          0, // 11 F4 invalid
-          0, // 12 F5 invalid
-          1, // 13 F6 tune req
-          0, // 14 F7 invalid (EOX)
-          1, // 15 F8 timing clck
-          0, // 16 F9 invalid
-          1, // 17 FA start
-          1, // 18 FB continue
-          1, // 19 FC stop
-          0, // 20 FD invalid
-          1, // 21 FE active sensing
-          1, // 22 FF reset
-        };
-
-        uint8_t testDataBytesUntil;
+
+        size_t testDataBytesUntil;
 
         if (bytes[0] == 0xF0){
 
@@ -90,18 +46,8 @@ namespace MidiMessage {
           testDataBytesUntil = len - 1;
 
         } else {
-          uint8_t lut;
-
-          if ((bytes[0] & 0xF0) != 0xF0){
-            // if is not system message (0xF0)
-            lut = (bytes[0] >> 4) & 0x07;
-          } else {
-            // if is system message
-            lut = (bytes[0] & 0x0F) + 7;
-          }
-
           // does message have the right length?
-          if (len != lengthLUT[lut]){
+          if (len != getMsgLen(bytes[0])){
             return false;
           }
 
@@ -114,311 +60,488 @@ namespace MidiMessage {
           testDataBytesUntil = len;
         }
 
-        for( size_t i = 1; i < testDataBytesUntil; i++ ){
-          if ( ! isDataByte(bytes[i]) ){
-            return false;
-          }
-        }
-
-        return true;
+        // all bytes in between must be data bytes
+        return findControlByte( &bytes[1], testDataBytesUntil - 1 ) == testDataBytesUntil - 1;
     }
 
+    size_t findControlByte( uint8_t * bytes, size_t len ){
+        ASSERT( bytes != NULL || len == 0 );
 
-    inline void * memcpy( void * dst, void * src, uint8_t count ){
-        for(uint8_t i = 0; i < count; i++){
-            ((uint8_t*)dst)[i] = ((uint8_t*)src)[i];
-        }
-        return dst;
-    }
-
-    uint8_t pack( uint8_t * bytes, Message_t * msg ){
-        ASSERT( bytes != NULL);
-        ASSERT( msg != NULL );
-        ASSERT( msg->Data.SysEx.ByteData != NULL );
+        size_t i = 0;
 
-        int len;
+        // the most significant bit of each byte is set for control bytes, which is exactly what movemask extracts
 
-        if (isStatusClass(msg->StatusClass) && msg->StatusClass != StatusClassSystemMessage) {
-            switch (msg->StatusClass) {
+#if defined(__AVX2__)
+        for(; i + 32 <= len; i += 32){
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8( _mm256_loadu_si256( (const __m256i*)&bytes[i] ) );
+            if (mask != 0){
+                return i + __builtin_ctz(mask);
+            }
+        }
+#endif
 
-                case StatusClassNoteOff:
-                    return packNoteOffObj(bytes, msg);
+#if defined(__AVX2__) || defined(__SSE2__)
+        for(; i + 16 <= len; i += 16){
+            uint32_t mask = (uint32_t)_mm_movemask_epi8( _mm_loadu_si128( (const __m128i*)&bytes[i] ) );
+            if (mask != 0){
+                return i + __builtin_ctz(mask);
+            }
+        }
+#endif
 
-                case StatusClassNoteOn:
-                    return packNoteOnObj(bytes, msg);
+        for(; i < len; i++){
+            if ( ! isDataByte(bytes[i]) ){
+                return i;
+            }
+        }
 
-                case StatusClassPolyphonicKeyPressure:
-                    return packPolyphonicKeyPressureObj(bytes, msg);
+        return len;
+    }
 
-                case StatusClassControlChange:
-                    return packControlChangeObj(bytes, msg);
 
-                case StatusClassProgramChange:
-                    return packProgramChangeObj(bytes, msg);
+    size_t nibblizeBlock( uint8_t * dst, uint8_t * src, size_t length ){
+        ASSERT( (dst != NULL && src != NULL) || length == 0 );
 
-                case StatusClassChannelPressure:
-                    return packChannelPressureObj(bytes, msg);
+        size_t i = 0;
 
-                case StatusClassPitchBendChange:
-                    return packPitchBendChangeObj(bytes, msg);
+#if defined(__AVX2__) || defined(__SSE2__)
+        const __m128i mask = _mm_set1_epi8( NibbleMask );
 
-                case StatusClassSystemMessage:
-                    // processed below
-                    break;
+        for(; i + 16 <= length; i += 16){
+            __m128i v = _mm_loadu_si128( (const __m128i*)&src[i] );
+            __m128i ls = _mm_and_si128( v, mask );
+            __m128i ms = _mm_and_si128( _mm_srli_epi16( v, 4 ), mask );
 
-                default:
-                    ASSERT(false); // should not occur, if msg setup correctly
-                    return 0;
-            }
+            // interleave to LS, MS nibble pairs
+            _mm_storeu_si128( (__m128i*)&dst[2*i], _mm_unpacklo_epi8( ls, ms ) );
+            _mm_storeu_si128( (__m128i*)&dst[2*i + 16], _mm_unpackhi_epi8( ls, ms ) );
         }
+#endif
 
+        nibblize( &dst[2*i], &src[i], length - i );
 
-        if (msg->StatusClass == StatusClassSystemMessage && isSystemMessage(msg->SystemMessage) && msg->SystemMessage != SystemMessageSystemExclusive) {
+        return 2 * length;
+    }
 
-            switch (msg->SystemMessage)
-            {
-                case SystemMessageMtcQuarterFrame:
-                    return packMtcQuarterFrameObj( bytes, msg );
+    size_t denibblizeBlock( uint8_t * dst, uint8_t * src, size_t length ){
+        ASSERT( (dst != NULL && src != NULL) || length == 0 );
+        ASSERT( length % 2 == 0 );
 
-                case SystemMessageSongPositionPointer:
-                    return packSongPositionPointerObj( bytes, msg );
+        size_t i = 0;
 
-                case SystemMessageSongSelect:
-                    return packSongSelectObj( bytes, msg );
+#if defined(__AVX2__) || defined(__SSE2__)
+        const __m128i mask = _mm_set1_epi16( NibbleMask );
 
-                case SystemMessageTuneRequest:
-                case SystemMessageEndOfExclusive:
-                case SystemMessageTimingClock:
-                case SystemMessageStart:
-                case SystemMessageContinue:
-                case SystemMessageStop:
-                case SystemMessageActiveSensing:
-                case SystemMessageReset:
-                    return packSystemMessageObj( bytes, msg );
+        for(; i + 32 <= length; i += 32){
+            // each 16 bit lane holds a LS, MS nibble pair
+            __m128i a = _mm_loadu_si128( (const __m128i*)&src[i] );
+            __m128i b = _mm_loadu_si128( (const __m128i*)&src[i + 16] );
 
-                case SystemMessageSystemExclusive:
-                    // processed below
-                    break;
+            a = _mm_or_si128( _mm_and_si128( a, mask ), _mm_slli_epi16( _mm_and_si128( _mm_srli_epi16( a, 8 ), mask ), 4 ) );
+            b = _mm_or_si128( _mm_and_si128( b, mask ), _mm_slli_epi16( _mm_and_si128( _mm_srli_epi16( b, 8 ), mask ), 4 ) );
 
-                default:
-                    ASSERT(false); // should not occur, if msg setup correctly
-                    return 0;
-            }
+            _mm_storeu_si128( (__m128i*)&dst[i / 2], _mm_packus_epi16( a, b ) );
         }
+#endif
 
-        if (msg->StatusClass == StatusClassSystemMessage && msg->SystemMessage == SystemMessageSystemExclusive){
-
-            bytes[0] = msg->SystemMessage;
+        denibblize( &dst[i / 2], &src[i], length - i );
 
-            if (msg->Data.SysEx.Id == SysExIdExperimental){
-                return packSysExExperimentalMessageObj( bytes, msg );
-            } // (msg->Data.SysEx.Id == SysExIdExperimental)
+        return length / 2;
+    }
 
-            if (isSysExManufacturerId( msg->Data.SysEx.Id )){
-                return packSysExManufacturerMessageObj( bytes, msg );
-            } // (isSysExManufacturerId( msg->Data.SysEx.Id ))
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SEVENBIT_SWAR
 
-            if (msg->Data.SysEx.Id == SysExIdRealTime){
+    // multipliers gathering the MSBs of a group into a single byte (and vice versa) without any carries
+    const uint64_t SevenbitGatherMSBs = (1ULL << 62) | (1ULL << 53) | (1ULL << 44) | (1ULL << 35) | (1ULL << 26) | (1ULL << 17) | (1ULL << 8);
+    const uint64_t SevenbitSpreadMSBs = (1ULL << 1) | (1ULL << 10) | (1ULL << 19) | (1ULL << 28) | (1ULL << 37) | (1ULL << 46) | (1ULL << 55);
 
-                switch (msg->Data.SysEx.SubId1) {
+    const uint64_t SevenbitGroupMSBs = 0x0080808080808080ULL;
+    const uint64_t SevenbitGroupData = 0x007F7F7F7F7F7F7FULL;
+#endif
 
-                    case SysExRtMidiTimeCode:
-                        return packSysExRtMidiTimeCodeObj(bytes, msg);
+    size_t sevenbitizeBlock( uint8_t * dst, uint8_t * src, size_t length ){
+        ASSERT( (dst != NULL && src != NULL) || length == 0 );
 
-                    case SysExRtMidiShowControl:
-                        return packSysExRtMidiShowControlObj( bytes, msg );
+        size_t i = 0;
+        size_t len = 0;
 
-                    case SysExRtNotationInformation:
-                        return packSysExRtNotationInformationObj( bytes, msg );
+#ifdef SEVENBIT_SWAR
+        // (reads 8 bytes per group of 7)
+        for(; i + 8 <= length; i += 7, len += 8){
+            uint64_t v;
+            std::memcpy( &v, &src[i], 8 );
 
-                    case SysExRtDeviceControl:
-                        return packSysExRtDeviceControlObj( bytes, msg );
+            uint64_t msbs = ((((v & SevenbitGroupMSBs) >> 7) * SevenbitGatherMSBs) >> 56) & DataMask;
 
-                    case SysExRtMidiTimeCodeCueing:
-                        return packSysExRtMtcCueingSetupMessageObj( bytes, msg );
+            v = ((v & SevenbitGroupData) << 8) | msbs;
 
-                    case SysExRtMidiMachineControlCommand:
-                        return packSysExRtMmcCommandMessageObj( bytes, msg );
+            std::memcpy( &dst[len], &v, 8 );
+        }
+#endif
 
-                    case SysExRtMidiMachineControlResponse:
-                        return packSysExRtMmcResponseMessageObj( bytes, msg );
+        return len + sevenbitize( &dst[len], &src[i], length - i );
+    }
 
-                    case SysExRtMidiTuningStandard:
-                        //TODO
-                        return false;
+    size_t desevenbitizeBlock( uint8_t * dst, uint8_t * src, size_t length ){
+        ASSERT( (dst != NULL && src != NULL) || length == 0 );
 
-                    case SysExRtControllerDestinationSetting:
-                        return packSysExRtControllerDestinationSettingObj( bytes, msg );
+        size_t i = 0;
+        size_t len = 0;
 
-                    case SysExRtKeybasedInstrumentControl:
-                        return packSysExRtKeybasedInstrumentControlObj( bytes, msg );
+#ifdef SEVENBIT_SWAR
+        // (writes 8 bytes per group of 7, thus not for the last group)
+        for(; i + 16 <= length; i += 8, len += 7){
+            uint64_t v;
+            std::memcpy( &v, &src[i], 8 );
 
-                    case SysExRtScalablePolyphonyMidiMip:
-                        //TODO
-                        return false;
+            uint64_t msbs = ((v & DataMask) * SevenbitSpreadMSBs) & SevenbitGroupMSBs;
 
-                    case SysExRtMobilePhoneControlMessage:
-                        return packSysExRtMobilePhoneControlObj( bytes, msg );
-                }
+            v = ((v >> 8) & SevenbitGroupData) | msbs;
 
-            } // (msg->Data.SysEx.Id == SysExIdRealTime)
+            std::memcpy( &dst[len], &v, 8 );
+        }
+#endif
 
-            if (msg->Data.SysEx.Id == SysExIdNonRealTime){
+        return len + desevenbitize( &dst[len], &src[i], length - i );
+    }
 
+    /**
+     * Common streaming logic: completes the pending group first, then converts all complete groups of the chunk
+     * directly and keeps the remainder.
+     */
+    static size_t convertStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length, uint8_t groupSize, size_t (*converter)( uint8_t * dst, uint8_t * src, size_t length ) ){
+        ASSERT( state != NULL );
+        ASSERT( state->Length < groupSize );
 
-                switch (msg->Data.SysEx.SubId1) {
-                    case SysExNonRtSampleDumpHeader:
-                        return packSysExNonRtSdsHeaderObj( bytes, msg );
+        size_t len = 0;
 
-                    case SysExNonRtSampleDataPacket:
-                        return packSysExNonRtSdsDataPacketObj( bytes, msg );
+        if (state->Length > 0){
+            while (state->Length < groupSize && length > 0){
+                state->Buffer[state->Length++] = *src++;
+                length--;
+            }
 
-                    case SysExNonRtSampleDumpRequest:
-                        return packSysExNonRtSdsRequestObj( bytes, msg );
+            if (state->Length < groupSize){
+                return 0;
+            }
 
-                    case SysExNonRtMidiTimeCode:
-                        return packSysExNonRtMtcCueingSetupMessageObj( bytes, msg );
+            len += converter( dst, state->Buffer, groupSize );
+            state->Length = 0;
+        }
 
-                    case SysExNonRtSampleDumpExtension:
-                        return packSysExNonRtSdsExtObj( bytes, msg );
+        size_t complete = length - length % groupSize;
 
-                    case SysExNonRtGeneralInformation:
-                        return packSysExNonRtGeneralInformationObj( bytes, msg );
+        if (complete > 0){
+            len += converter( &dst[len], src, complete );
+        }
 
-                    case SysExNonRtFileDump:
-                        return packSysExNonRtFileDumpObj( bytes, msg);
+        for(size_t i = complete; i < length; i++){
+            state->Buffer[state->Length++] = src[i];
+        }
 
-                    case SysExNonRtMidiTuningStandard:
-                        return packSysExNonRtTuningObj( bytes, msg );
+        return len;
+    }
 
-                    case SysExNonRtGeneralMidi:
-                        return packSysExNonRtGeneralMidiObj( bytes, msg );
+    size_t sevenbitizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length ){
+        return convertStream( state, dst, src, length, 7, sevenbitizeBlock );
+    }
 
-                    case SysExNonRtDownloadableSounds:
-                        //TODO
-                        return false;
+    size_t sevenbitizeFlush( ConverterState_t * state, uint8_t * dst ){
+        ASSERT( state != NULL );
 
-                    case SysExNonRtFileReferenceMessage:
-                        //TODO
-                        return false;
+        size_t len = sevenbitize( dst, state->Buffer, state->Length );
+        state->Length = 0;
 
-                    case SysExNonRtMidiVisualControl:
-                        return packSysExNonRtMvcSetParameterObj( bytes, msg );
+        return len;
+    }
 
-                    case SysExNonRtMidiCapabilityInquiry:
-                        //TODO
-                        return false;
+    size_t desevenbitizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length ){
+        return convertStream( state, dst, src, length, 8, desevenbitizeBlock );
+    }
 
-                    case SysExNonRtEndOfFile:
-                    case SysExNonRtWait:
-                    case SysExNonRtCancel:
-                    case SysExNonRtNAK:
-                    case SysExNonRtACK:
-                        return packSysExNonRtHandshakeObj( bytes, msg );
+    size_t desevenbitizeFlush( ConverterState_t * state, uint8_t * dst ){
+        ASSERT( state != NULL );
 
-                }
+        // a single remaining (MSB) byte carries no data
+        size_t len = state->Length > 1 ? desevenbitize( dst, state->Buffer, state->Length ) : 0;
+        state->Length = 0;
 
-                return 0;
-            } // (msg->Data.SysEx.Id == SysExIdNonRealTime)
+        return len;
+    }
 
-        } // msg->Status == SystemMessageSystemExclusive
+    size_t denibblizeStream( ConverterState_t * state, uint8_t * dst, uint8_t * src, size_t length ){
+        return convertStream( state, dst, src, length, 2, denibblizeBlock );
+    }
 
+    /**
+     * Adapts packers returning a specific integer type to the common MessagePacker_t signature.
+     */
+    extern "C++" {
+        template<typename T, T (*packer)(uint8_t *, Message_t *)>
+        static size_t packAs( uint8_t * bytes, Message_t * msg ){
+            return packer( bytes, msg );
+        }
+    }
 
+    /**
+     * Placeholder for known but not (yet) supported message types.
+     */
+    static size_t packUnsupported( uint8_t *, Message_t * ){
+        return 0;
+    }
 
-        ASSERT( false ); // should never reach here. You only do, when the given parameters are invalid.
+    static bool unpackUnsupported( uint8_t *, size_t, Message_t * ){
+        return false;
+    }
 
-        return 0;
+    typedef struct {
+        MessagePacker_t Pack;
+        MessageUnpacker_t Unpack;
+    } MessageTypeHandlers_t;
+
+    /**
+     * Channel voice messages as indexed by (status >> 4) & 0x07 (system messages handled separately)
+     */
+    static const MessageTypeHandlers_t ChannelMessageHandlers[8] = {
+        /* 8* */ { packAs<uint8_t, packNoteOffObj>, unpackNoteOffObj },
+        /* 9* */ { packAs<uint8_t, packNoteOnObj>, unpackNoteOnObj },
+        /* A* */ { packAs<uint8_t, packPolyphonicKeyPressureObj>, unpackPolyphonicKeyPressureObj },
+        /* B* */ { packAs<uint8_t, packControlChangeObj>, unpackControlChangeObj },
+        /* C* */ { packAs<uint8_t, packProgramChangeObj>, unpackProgramChangeObj },
+        /* D* */ { packAs<uint8_t, packChannelPressureObj>, unpackChannelPressureObj },
+        /* E* */ { packAs<uint8_t, packPitchBendChangeObj>, unpackPitchBendChangeObj },
+        /* F* */ { NULL, NULL }
+    };
+
+    /**
+     * System messages (except SysEx) as indexed by status & 0x0F
+     */
+    static const MessageTypeHandlers_t SystemMessageHandlers[16] = {
+        /* F0 */ { NULL, NULL }, // sysex handled separately
+        /* F1 */ { packAs<uint8_t, packMtcQuarterFrameObj>, unpackMtcQuarterFrameObj },
+        /* F2 */ { packAs<uint8_t, packSongPositionPointerObj>, unpackSongPositionPointerObj },
+        /* F3 */ { packAs<uint8_t, packSongSelectObj>, unpackSongSelectObj },
+        /* F4 */ { NULL, NULL },
+        /* F5 */ { NULL, NULL },
+        /* F6 */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* F7 */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* F8 */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* F9 */ { NULL, NULL },
+        /* FA */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* FB */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* FC */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* FD */ { NULL, NULL },
+        /* FE */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj },
+        /* FF */ { packAs<uint8_t, packSystemMessageObj>, unpackSystemMessageObj }
+    };
+
+    /**
+     * Universal Real Time SysEx messages as indexed by SubId1 (see setSysExRtHandlers())
+     */
+    static MessageTypeHandlers_t SysExRtHandlers[128] = {
+        /* 0x00 */ { NULL, NULL },
+        /* 0x01 */ { packAs<uint8_t, packSysExRtMidiTimeCodeObj>, unpackSysExRtMidiTimeCodeObj },
+        /* 0x02 */ { packSysExRtMidiShowControlObj, unpackSysExRtMidiShowControlObj },
+        /* 0x03 */ { packSysExRtNotationInformationObj, unpackSysExRtNotationInformationObj },
+        /* 0x04 */ { packAs<uint8_t, packSysExRtDeviceControlObj>, unpackSysExRtDeviceControlObj },
+        /* 0x05 */ { packSysExRtMtcCueingSetupMessageObj, unpackSysExRtMtcCueingSetupMessageObj },
+        /* 0x06 */ { packSysExRtMmcCommandMessageObj, unpackSysExRtMmcCommandMessageObj },
+        /* 0x07 */ { packSysExRtMmcResponseMessageObj, unpackSysExRtMmcResponseMessageObj },
+        /* 0x08 */ { packUnsupported, unpackUnsupported },
+        /* 0x09 */ { packSysExRtControllerDestinationSettingObj, unpackSysExRtControllerDestinationSettingObj },
+        /* 0x0A */ { packSysExRtKeybasedInstrumentControlObj, unpackSysExRtKeybasedInstrumentControlObj },
+        /* 0x0B */ { packUnsupported, unpackUnsupported },
+        /* 0x0C */ { packSysExRtMobilePhoneControlObj, unpackSysExRtMobilePhoneControlObj },
+        /* 0x0D */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x10 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x18 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x20 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x28 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x30 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x38 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x40 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x48 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x50 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x58 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x60 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x68 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x70 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x78 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }
+    };
+
+    /**
+     * Universal Non-Real Time SysEx messages as indexed by SubId1 (see setSysExNonRtHandlers())
+     */
+    static MessageTypeHandlers_t SysExNonRtHandlers[128] = {
+        /* 0x00 */ { NULL, NULL },
+        /* 0x01 */ { packAs<uint8_t, packSysExNonRtSdsHeaderObj>, unpackSysExNonRtSdsHeaderObj },
+        /* 0x02 */ { packSysExNonRtSdsDataPacketObj, unpackSysExNonRtSdsDataPacketObj },
+        /* 0x03 */ { packAs<uint8_t, packSysExNonRtSdsRequestObj>, unpackSysExNonRtSdsRequestObj },
+        /* 0x04 */ { packSysExNonRtMtcCueingSetupMessageObj, unpackSysExNonRtMtcCueingSetupMessageObj },
+        /* 0x05 */ { packSysExNonRtSdsExtObj, unpackSysExNonRtSdsExtObj },
+        /* 0x06 */ { packAs<uint8_t, packSysExNonRtGeneralInformationObj>, unpackSysExNonRtGeneralInformationObj },
+        /* 0x07 */ { packSysExNonRtFileDumpObj, unpackSysExNonRtFileDumpObj },
+        /* 0x08 */ { packAs<uint8_t, packSysExNonRtTuningObj>, unpackSysExNonRtTuningObj },
+        /* 0x09 */ { packAs<uint8_t, packSysExNonRtGeneralMidiObj>, unpackSysExNonRtGeneralMidiObj },
+        /* 0x0A */ { packUnsupported, unpackUnsupported },
+        /* 0x0B */ { packUnsupported, unpackUnsupported },
+        /* 0x0C */ { packSysExNonRtMvcSetParameterObj, unpackSysExNonRtMvcSetParameterObj },
+        /* 0x0D */ { packUnsupported, unpackUnsupported },
+        /* 0x0E */ { NULL, NULL }, { NULL, NULL },
+        /* 0x10 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x18 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x20 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x28 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x30 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x38 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x40 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x48 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x50 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x58 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x60 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x68 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x70 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x78 */ { NULL, NULL }, { NULL, NULL }, { NULL, NULL },
+        /* 0x7B */ { packAs<uint8_t, packSysExNonRtHandshakeObj>, unpackSysExNonRtHandshakeObj },
+        /* 0x7C */ { packAs<uint8_t, packSysExNonRtHandshakeObj>, unpackSysExNonRtHandshakeObj },
+        /* 0x7D */ { packAs<uint8_t, packSysExNonRtHandshakeObj>, unpackSysExNonRtHandshakeObj },
+        /* 0x7E */ { packAs<uint8_t, packSysExNonRtHandshakeObj>, unpackSysExNonRtHandshakeObj },
+        /* 0x7F */ { packAs<uint8_t, packSysExNonRtHandshakeObj>, unpackSysExNonRtHandshakeObj }
+    };
+
+    void setSysExRtHandlers( uint8_t subId1, MessagePacker_t packer, MessageUnpacker_t unpacker ){
+        ASSERT( subId1 <= MaxU7 );
+
+        SysExRtHandlers[subId1].Pack = packer;
+        SysExRtHandlers[subId1].Unpack = unpacker;
     }
 
-    bool unpack( uint8_t * bytes, uint8_t length, Message_t * msg ){
+    void setSysExNonRtHandlers( uint8_t subId1, MessagePacker_t packer, MessageUnpacker_t unpacker ){
+        ASSERT( subId1 <= MaxU7 );
 
-        ASSERT( bytes != NULL);
+        SysExNonRtHandlers[subId1].Pack = packer;
+        SysExNonRtHandlers[subId1].Unpack = unpacker;
+    }
+
+    bool ShortMessagetoMessage( ShortMessage_t * shortMsg, Message_t * msg ){
+        ASSERT( shortMsg != NULL );
         ASSERT( msg != NULL );
-        ASSERT( msg->Data.SysEx.ByteData != NULL );
+
+        uint8_t bytes[3];
+        uint8_t length = packShortMessage( bytes, shortMsg );
 
         if (length == 0){
             return false;
         }
 
-        if ( ! isControlByte(bytes[0]) ){
-            return false;
-        }
+        MessageUnpacker_t unpacker;
 
-        uint8_t statusClass = getStatusClass(bytes[0]);
-        uint8_t systemMessage = bytes[0];
+        if (getStatusClass(bytes[0]) != StatusClassSystemMessage){
+            unpacker = ChannelMessageHandlers[ (bytes[0] >> 4) & 0x07 ].Unpack;
+        } else {
+            unpacker = SystemMessageHandlers[ bytes[0] & 0x0F ].Unpack;
+        }
 
-        if (isStatusClass(statusClass) && statusClass != StatusClassSystemMessage) {
+        return unpacker != NULL && unpacker( bytes, length, msg );
+    }
 
-            switch (statusClass) {
+    bool MessagetoShortMessage( Message_t * msg, ShortMessage_t * shortMsg ){
+        ASSERT( msg != NULL );
+        ASSERT( shortMsg != NULL );
 
-                case StatusClassNoteOff:
-                    return unpackNoteOffObj(bytes, length, msg);
+        MessagePacker_t packer = NULL;
 
-                case StatusClassNoteOn:
-                    return unpackNoteOnObj(bytes, length, msg);
+        if (isStatusClass(msg->StatusClass) && msg->StatusClass != StatusClassSystemMessage) {
+            packer = ChannelMessageHandlers[ (msg->StatusClass >> 4) & 0x07 ].Pack;
+        }
+        else if (msg->StatusClass == StatusClassSystemMessage && (msg->SystemMessage & 0xF0) == 0xF0) {
+            // (sysex are not in table)
+            packer = SystemMessageHandlers[ msg->SystemMessage & 0x0F ].Pack;
+        }
 
-                case StatusClassPolyphonicKeyPressure:
-                    return unpackPolyphonicKeyPressureObj(bytes, length, msg);
+        if (packer == NULL){
+            return false;
+        }
 
-                case StatusClassControlChange:
-                    return unpackControlChangeObj(bytes, length, msg);
+        uint8_t bytes[3];
+        size_t length = packer( bytes, msg );
 
-                case StatusClassProgramChange:
-                    return unpackProgramChangeObj(bytes, length, msg);
+        return unpackShortMessage( bytes, length, shortMsg );
+    }
 
-                case StatusClassChannelPressure:
-                    return unpackChannelPressureObj(bytes, length, msg);
+    size_t pack( uint8_t * bytes, Message_t * msg ){
+        ASSERT( bytes != NULL);
+        ASSERT( msg != NULL );
+        ASSERT( msg->Data.SysEx.ByteData != NULL );
 
-                case StatusClassPitchBendChange:
-                    return unpackPitchBendChangeObj(bytes, length, msg);
+        MessagePacker_t packer = NULL;
 
-                case StatusClassSystemMessage:
-                    // processed below
-                    break;
+        if (isStatusClass(msg->StatusClass) && msg->StatusClass != StatusClassSystemMessage) {
+            packer = ChannelMessageHandlers[ (msg->StatusClass >> 4) & 0x07 ].Pack;
+        }
+        else if (msg->StatusClass == StatusClassSystemMessage && msg->SystemMessage != SystemMessageSystemExclusive) {
+            if ((msg->SystemMessage & 0xF0) == 0xF0){
+                packer = SystemMessageHandlers[ msg->SystemMessage & 0x0F ].Pack;
+            }
+        }
+        else if (msg->StatusClass == StatusClassSystemMessage && msg->SystemMessage == SystemMessageSystemExclusive){
 
-                default:
-                    return false;
+            bytes[0] = msg->SystemMessage;
 
-            } // switch(msg->StatusClass)
-        } // (isStatusClass(msg->StatusClass) && msg->StatusClass != StatusClassSystemMessage)
+            if (msg->Data.SysEx.Id == SysExIdExperimental){
+                return packSysExExperimentalMessageObj( bytes, msg );
+            } // (msg->Data.SysEx.Id == SysExIdExperimental)
 
+            if (isSysExManufacturerId( msg->Data.SysEx.Id )){
+                return packSysExManufacturerMessageObj( bytes, msg );
+            } // (isSysExManufacturerId( msg->Data.SysEx.Id ))
 
-        if (statusClass == StatusClassSystemMessage && isSystemMessage(systemMessage) && systemMessage != SystemMessageSystemExclusive) {
+            if (msg->Data.SysEx.Id == SysExIdRealTime && msg->Data.SysEx.SubId1 <= MaxU7){
+                packer = SysExRtHandlers[ msg->Data.SysEx.SubId1 ].Pack;
+            } // (msg->Data.SysEx.Id == SysExIdRealTime)
 
-            switch(systemMessage){
+            if (msg->Data.SysEx.Id == SysExIdNonRealTime){
+                if (msg->Data.SysEx.SubId1 > MaxU7 || SysExNonRtHandlers[ msg->Data.SysEx.SubId1 ].Pack == NULL){
+                    return 0;
+                }
+                packer = SysExNonRtHandlers[ msg->Data.SysEx.SubId1 ].Pack;
+            } // (msg->Data.SysEx.Id == SysExIdNonRealTime)
 
-                case SystemMessageMtcQuarterFrame:
-                    return unpackMtcQuarterFrameObj( bytes, length, msg );
+        } // msg->Status == SystemMessageSystemExclusive
 
-                case SystemMessageSongPositionPointer:
-                    return unpackSongPositionPointerObj( bytes, length, msg );
+        if (packer != NULL){
+            return packer( bytes, msg );
+        }
 
-                case SystemMessageSongSelect:
-                    return unpackSongSelectObj( bytes, length, msg );
+        ASSERT( false ); // should never reach here. You only do, when the given parameters are invalid.
 
-                case SystemMessageTuneRequest:
-                case SystemMessageEndOfExclusive:
-                case SystemMessageTimingClock:
-                case SystemMessageStart:
-                case SystemMessageContinue:
-                case SystemMessageStop:
-                case SystemMessageActiveSensing:
-                case SystemMessageReset:
-                    return unpackSystemMessageObj( bytes, length, msg );
+        return 0;
+    }
 
-                case SystemMessageSystemExclusive:
-                    // processed below
-                    break;
+    bool unpack( uint8_t * bytes, size_t length, Message_t * msg ){
 
-                default:
-                    return false;
+        ASSERT( bytes != NULL);
+        ASSERT( msg != NULL );
+        ASSERT( msg->Data.SysEx.ByteData != NULL );
 
-            } // switch(msg->Status)
+        if (length == 0){
+            return false;
+        }
 
-        } // (isSystemMessage(msg->Status) && msg->Status != SystemMessageSystemExclusive)
+        if ( ! isControlByte(bytes[0]) ){
+            return false;
+        }
 
+        MessageUnpacker_t unpacker = NULL;
 
-        if (statusClass == StatusClassSystemMessage && systemMessage == SystemMessageSystemExclusive) {
+        if (getStatusClass(bytes[0]) != StatusClassSystemMessage){
+            unpacker = ChannelMessageHandlers[ (bytes[0] >> 4) & 0x07 ].Unpack;
+        }
+        else if (bytes[0] != SystemMessageSystemExclusive){
+            unpacker = SystemMessageHandlers[ bytes[0] & 0x0F ].Unpack;
+        }
+        else {
 
             // minimum of status byte and manufacturerid (assuming and optional ending)
             if (length < 2) {
@@ -433,125 +556,51 @@ namespace MidiMessage {
                 return unpackSysExManufacturerMessageObj( bytes, length, msg );
             } // isSysExManufacturerId(bytes[1])
 
-            if (bytes[1] == SysExIdRealTime_Byte) {
-                if (length < 4) {
-                    return false;
-                }
-
-                switch (bytes[3]) {
-                    case SysExRtMidiTimeCode:
-                        return unpackSysExRtMidiTimeCodeObj(bytes, length, msg);
-
-                    case SysExRtMidiShowControl:
-                        return unpackSysExRtMidiShowControlObj(bytes, length, msg);
-
-                    case SysExRtNotationInformation:
-                        return unpackSysExRtNotationInformationObj( bytes, length, msg );
-
-                    case SysExRtDeviceControl:
-                        return unpackSysExRtDeviceControlObj( bytes, length, msg );
-
-                    case SysExRtMidiTimeCodeCueing:
-                        return unpackSysExRtMtcCueingSetupMessageObj( bytes, length, msg );
-
-                    case SysExRtMidiMachineControlCommand:
-                        return unpackSysExRtMmcCommandMessageObj( bytes, length, msg);
-
-                    case SysExRtMidiMachineControlResponse:
-                        return unpackSysExRtMmcResponseMessageObj( bytes, length, msg);
-
-                    case SysExRtMidiTuningStandard:
-                        //TODO
-                        return false;
-
-                    case SysExRtControllerDestinationSetting:
-                        return unpackSysExRtControllerDestinationSettingObj(bytes, length, msg);
-
-                    case SysExRtKeybasedInstrumentControl:
-                        return unpackSysExRtKeybasedInstrumentControlObj( bytes, length, msg );
-
-                    case SysExRtScalablePolyphonyMidiMip:
-                        //TODO
-                        return false;
-
-                    case SysExRtMobilePhoneControlMessage:
-                        return unpackSysExRtMobilePhoneControlObj( bytes, length, msg);
-
-                    default:
-                        break;
-                }
-
+            if (length < 4 || ! isDataByte(bytes[3])) {
                 return false;
-            } // (bytes[1] == SysExIdRealTime)
-
-            if (bytes[1] == SysExIdNonRealTime_Byte) {
-                if (length < 4) {
-                    return false;
-                }
-
-//                msg->Data.SysEx.Id = SysExIdNonRealTime;
-//                msg->Channel = bytes[2]; // deviceId
-//                msg->Data.SysEx.SubId1 = bytes[3];
-
-                switch (bytes[3]) {
-                    case SysExNonRtSampleDumpHeader:
-                        return unpackSysExNonRtSdsHeaderObj( bytes, length, msg );
-
-                    case SysExNonRtSampleDataPacket:
-                        return unpackSysExNonRtSdsDataPacketObj( bytes, length, msg );
-
-                    case SysExNonRtSampleDumpRequest:
-                        return unpackSysExNonRtSdsRequestObj( bytes, length, msg );
-
-                    case SysExNonRtMidiTimeCode:
-                        return unpackSysExNonRtMtcCueingSetupMessageObj( bytes, length, msg );
-
-                    case SysExNonRtSampleDumpExtension:
-                        return unpackSysExNonRtSdsExtObj( bytes, length, msg);
+            }
 
-                    case SysExNonRtGeneralInformation:
-                        return unpackSysExNonRtGeneralInformationObj( bytes, length, msg );
+            // (unpackers of messages without data do not set the data length)
+            msg->Data.SysEx.Length = 0;
 
-                    case SysExNonRtFileDump:
-                        return unpackSysExNonRtFileDumpObj(bytes, length, msg);
+            if (bytes[1] == SysExIdRealTime_Byte) {
+                unpacker = SysExRtHandlers[ bytes[3] ].Unpack;
+            } // (bytes[1] == SysExIdRealTime)
 
-                    case SysExNonRtMidiTuningStandard:
-                        return unpackSysExNonRtTuningObj( bytes, length, msg );
+            else if (bytes[1] == SysExIdNonRealTime_Byte) {
+                unpacker = SysExNonRtHandlers[ bytes[3] ].Unpack;
+            } // (bytes[1] == SysExIdNonRealTime_Byte)
 
-                    case SysExNonRtGeneralMidi:
-                        return unpackSysExNonRtGeneralMidiObj( bytes, length, msg );
+        } // (msg->Status == SystemMessageSystemExclusive)
 
-                    case SysExNonRtDownloadableSounds:
-                        //TODO
-                        return false;
+        if (unpacker == NULL){
+            return false;
+        }
 
-                    case SysExNonRtFileReferenceMessage:
-                        //TODO
-                        return false;
+        return unpacker( bytes, length, msg );
+    }
 
-                    case SysExNonRtMidiVisualControl:
-                        return unpackSysExNonRtMvcSetParameterObj( bytes, length, msg );
+    bool unpackView( uint8_t * bytes, size_t length, Message_t * msg ){
 
-                    case SysExNonRtMidiCapabilityInquiry:
-                        //TODO
-                        return false;
+        ASSERT( bytes != NULL);
+        ASSERT( msg != NULL );
 
-                    case SysExNonRtEndOfFile:
-                    case SysExNonRtWait:
-                    case SysExNonRtCancel:
-                    case SysExNonRtNAK:
-                    case SysExNonRtACK:
-                        return unpackSysExNonRtHandshakeObj(bytes, length, msg);
+        if (length > 1 && bytes[0] == SystemMessageSystemExclusive){
 
-                }
-
-                return false;
+            if (bytes[1] == SysExIdExperimental_Byte){
+                return unpackSysExExperimentalMessageViewObj( bytes, length, msg );
+            }
 
-            } // (bytes[1] == SysExIdNonRealTime_Byte)
+            if (isSysExManufacturerIdByte(bytes[1])){
+                return unpackSysExManufacturerMessageViewObj( bytes, length, msg );
+            }
 
-        } // (msg->Status == SystemMessageSystemExclusive)
+            if (length > 3 && bytes[1] == SysExIdNonRealTime_Byte && bytes[3] == SysExNonRtSampleDataPacket){
+                return unpackSysExNonRtSdsDataPacketViewObj( bytes, length, msg );
+            }
+        }
 
-        return false;
+        return unpack( bytes, length, msg );
     }
 
 #ifdef __cplusplus
@@ -2,13 +2,15 @@
 #include <midimessage/parser.h>
 #include <midimessage/packers.h>
 
+#include <string.h>
+
 //#include <cstdio>
 #ifdef __cplusplus
 namespace MidiMessage {
     extern "C" {
 #endif
 
-    void parser_init(Parser_t * parser, bool runningStatusEnabled, uint8_t * buffer, uint8_t maxLength, Message_t * msg, void (*messageHandler)(Message_t * message, void * context), void (*discardingDataHandler)(uint8_t * bytes, uint8_t length, void * context), void * context) {
+    void parser_init(Parser_t * parser, bool runningStatusEnabled, uint8_t * buffer, size_t maxLength, Message_t * msg, void (*messageHandler)(Message_t * message, void * context), void (*discardingDataHandler)(uint8_t * bytes, size_t length, void * context), void * context) {
         parser->RunningStatusEnabled = runningStatusEnabled;
 
         parser->Buffer = buffer;
@@ -22,24 +24,141 @@ namespace MidiMessage {
         parser->Length = 0;
 
         parser->Context = context;
+
+        parser->SysExHandler = NULL;
+        parser->SysExStreaming = false;
+
+        parser->SysExViewsEnabled = false;
+
+        parser->ShortMessageHandler = NULL;
+
+        parser->DiscardPending = false;
     }
 
-    void parser_receivedData(Parser_t * parser, uint8_t * data, uint8_t len){
+    static inline bool parser_unpack(Parser_t * parser, Message_t * msg){
+        if (parser->SysExViewsEnabled){
+            return unpackView(parser->Buffer, parser->Length, msg);
+        }
+        return unpack(parser->Buffer, parser->Length, msg);
+    }
+
+    size_t parser_receivedDataBatch(Parser_t * parser, uint8_t * data, size_t len, Message_t * messages, size_t * offsets, size_t maxMessages, size_t * consumed){
+
+        size_t count = 0;
+
+        // start of pending sysex data chunk (len if none)
+        size_t chunk = len;
+
+        size_t i = 0;
 
-        for (uint8_t i = 0; i < len; i++){
+        if (parser->DiscardPending){
+            parser->DiscardPending = false;
+
+            if (parser->DiscardingDataHandler != NULL){
+                parser->DiscardingDataHandler( parser->Buffer, parser->Length, parser->Context );
+            }
+
+            parser->Length = 0;
+        }
+
+        for (; i < len && count < maxMessages; i++){
+
+            if (parser->SysExStreaming){
+
+                // just collect data bytes, they are passed on as a whole chunk
+                if (isDataByte(data[i])){
+                    if (chunk == len){
+                        chunk = i;
+                    }
+                    // skip whole run of data bytes
+                    i += findControlByte( &data[i], len - i ) - 1;
+                    continue;
+                }
+
+                // any control byte (including interleaved real time messages) interrupts the current chunk
+                if (chunk != len){
+                    parser->SysExHandler( ParserSysExEventData, &data[chunk], i - chunk, parser->Context );
+                    chunk = len;
+                }
+
+                // sysexes may end with status bytes other than EOX
+                if (!isSystemRealTimeMessage(data[i])){
+
+                    parser->SysExStreaming = false;
+
+                    if (data[i] == SystemMessageEndOfExclusive){
+                        parser->SysExHandler( ParserSysExEventEnd, &data[i], 1, parser->Context );
+                        continue;
+                    }
+
+                    parser->SysExHandler( ParserSysExEventEnd, NULL, 0, parser->Context );
+                }
+            }
 
             // consume real time messages straight away (may be interleaved in other messages)
             if (isSystemRealTimeMessage(data[i])){
+
+                // fast path for compact messages
+                if (parser->ShortMessageHandler != NULL){
+                    ShortMessage_t shortMsg = { data[i], 0, 0, 0 };
+                    parser->ShortMessageHandler( shortMsg, parser->Context );
+                    continue;
+                }
+
                 // parser will definitly success
-                if (unpackSystemMessageObj(&data[i], 1, parser->Message)){
+                if (unpackSystemMessageObj(&data[i], 1, &messages[count])){
                     // emit real time message
-                    parser->MessageHandler( parser->Message, parser->Context );
+                    if (offsets != NULL){
+                        offsets[count] = i;
+                    }
+                    count++;
                 }
 
                 // skip further processing
                 continue;
             }
 
+            // in streaming mode sysexes are not buffered
+            if (parser->SysExHandler != NULL && data[i] == SystemMessageSystemExclusive){
+
+                if (parser->Length > 0 && parser->DiscardingDataHandler != NULL){
+                    parser->DiscardingDataHandler( parser->Buffer, parser->Length, parser->Context );
+                }
+
+                // also cancels running status
+                parser->Buffer[0] = SystemMessageSystemExclusive;
+                parser->Length = 0;
+
+                parser->SysExStreaming = true;
+
+                parser->SysExHandler( ParserSysExEventBegin, &data[i], 1, parser->Context );
+
+                continue;
+            }
+
+            // data bytes can only complete universal sysexes of specific lengths, so bulk copy whole runs of data bytes
+            // (but never fill the buffer completely, overflows are handled below)
+            if (parser->Length > 1 && parser->Buffer[0] == SystemMessageSystemExclusive && isDataByte(data[i])){
+
+                size_t run = findControlByte( &data[i], len - i );
+
+                if (run > parser->MaxLength - 1 - parser->Length){
+                    run = parser->MaxLength - 1 - parser->Length;
+                }
+
+                size_t limit = parser_sysExDataRun( parser->Buffer, parser->Length );
+                if (run > limit){
+                    run = limit;
+                }
+
+                if (run > 0){
+                    memcpy( &parser->Buffer[parser->Length], &data[i], run );
+                    parser->Length += run;
+                    i += run - 1;
+                    continue;
+                }
+            }
+
             // discard any initial data bytes unless running status is enabled
             if (parser->Length == 0 && isDataByte(data[i])){
 
@@ -65,11 +184,14 @@ namespace MidiMessage {
                     parser->Buffer[ parser->Length++ ] = SystemMessageEndOfExclusive;
 
                     // try to parse data
-                    uint8_t consumed = unpack(parser->Buffer, parser->Length, parser->Message);
+                    bool parsed = parser_unpack(parser, &messages[count]);
 
-                    if (consumed > 0){
+                    if (parsed){
                         // emit sysex
-                        parser->MessageHandler( parser->Message, parser->Context );
+                        if (offsets != NULL){
+                            offsets[count] = i;
+                        }
+                        count++;
                     }
 
                     // if was in fact an EOX, skip parser byte
@@ -77,9 +199,16 @@ namespace MidiMessage {
                         parser->Length = 0;
                         continue;
                     }
+
+                    // the sysex is passed to the discarding data handler as well, but only once the message was passed
+                    // on, thus the current byte is processed next time
+                    if (parsed){
+                        parser->DiscardPending = true;
+                        break;
+                    }
                 }
 
-                if (parser->DiscardingDataHandler != NULL){
+                if (parser->Length > 0 && parser->DiscardingDataHandler != NULL){
                     parser->DiscardingDataHandler( parser->Buffer, parser->Length, parser->Context );
                 }
 
@@ -90,12 +219,25 @@ namespace MidiMessage {
 
             parser->Buffer[ parser->Length++ ] = data[i];
 
-            // try to parse data straight away
-            uint8_t consumed = unpack(parser->Buffer, parser->Length, parser->Message);
+            // fast path for compact channel voice messages
+            if (parser->ShortMessageHandler != NULL && getStatusClass(parser->Buffer[0]) != StatusClassSystemMessage){
+
+                ShortMessage_t shortMsg;
+
+                if (parser->Length == getMsgLen(parser->Buffer[0]) && unpackShortMessage(parser->Buffer, parser->Length, &shortMsg)){
+                    parser->ShortMessageHandler( shortMsg, parser->Context );
 
-            if (consumed > 0){
+                    parser->Length = 0;
+                }
+            }
+
+            // try to parse data as soon as the message might be complete
+            else if (parser_isCompletable(parser->Buffer, parser->Length, data[i]) && parser_unpack(parser, &messages[count])){
                 // emit event
-                parser->MessageHandler( parser->Message, parser->Context );
+                if (offsets != NULL){
+                    offsets[count] = i;
+                }
+                count++;
 
                 // reset data
                 parser->Length = 0;
@@ -112,6 +254,17 @@ namespace MidiMessage {
             }
         }
 
+        // pass on remaining data of a yet unterminated sysex
+        if (chunk != len){
+            parser->SysExHandler( ParserSysExEventData, &data[chunk], i - chunk, parser->Context );
+        }
+
+        if (consumed != NULL){
+            *consumed = i;
+        }
+
+        return count;
+
 //        printf("%d ", parser->Length);
 //        for(uint8_t i = 0; i < parser->Length; i++){
 //            printf("%02X", parser->Buffer[i]);
@@ -119,6 +272,26 @@ namespace MidiMessage {
 //        printf("\n");
     }
 
+    void parser_receivedData(Parser_t * parser, uint8_t * data, size_t len){
+
+        size_t consumed;
+
+        // views replace the message's own buffer
+        uint8_t * byteData = parser->Message->Data.SysEx.ByteData;
+
+        while (len > 0){
+
+            if (parser_receivedDataBatch(parser, data, len, parser->Message, NULL, 1, &consumed) > 0){
+                parser->MessageHandler( parser->Message, parser->Context );
+
+                parser->Message->Data.SysEx.ByteData = byteData;
+            }
+
+            data += consumed;
+            len -= consumed;
+        }
+    }
+
 
 #ifdef __cplusplus
 } // extern "C"
@@ -1,14 +1,16 @@
 #include <midimessage/simpleparser.h>
 #include <midimessage/commonccs.h>
 
+#include <string.h>
+
 #ifdef __cplusplus
 namespace MidiMessage {
     extern "C" {
 #endif
 
-    void simpleparser_receivedData(SimpleParser_t * parser, uint8_t * data, uint16_t len){
+    void simpleparser_receivedData(SimpleParser_t * parser, uint8_t * data, size_t len){
 
-        for (uint16_t i = 0; i < len; i++){
+        for (size_t i = 0; i < len; i++){
 
             // consume real time messages straight away (may be interleaved in other messages)
             if (isSystemRealTimeMessage(data[i])){
@@ -20,6 +22,28 @@ namespace MidiMessage {
                 continue;
             }
 
+            // data bytes can not complete a sysex, so bulk copy whole runs of data bytes
+            // (but never fill the buffer completely, overflows are handled below)
+            if (parser->Length > 0 && parser->Buffer[0] == SystemMessageSystemExclusive && isDataByte(data[i])){
+
+                size_t run = findControlByte( &data[i], len - i );
+                size_t room = (size_t)parser->MaxLength - 1 - parser->Length;
+
+                if (run > room){
+                    run = room;
+                }
+
+                if (run > 0){
+                    if (parser->Length == 1){
+                        parser->DataValid = true;
+                    }
+                    memcpy( &parser->Buffer[parser->Length], &data[i], run );
+                    parser->Length += run;
+                    i += run - 1;
+                    continue;
+                }
+            }
+
             // discard any initial data bytes unless running status is enabled
             if (parser->Length == 0 && isDataByte(data[i])){
 
@@ -68,10 +92,21 @@ namespace MidiMessage {
             }
 
 
+            // keep validation state up to date (instead of revalidating the whole buffer)
+            if (parser->Length == 0){
+                parser->ExpectedLength = getMsgLen(data[i]);
+                parser->DataValid = true;
+            } else if (parser->Length == 1){
+                parser->DataValid = isDataByte(data[i]);
+            } else {
+                parser->DataValid = parser->DataValid && isDataByte(data[i]);
+            }
+
             parser->Buffer[ parser->Length++ ] = data[i];
 
-            // try to parse data straight away
-            if (simpleValidate(parser->Buffer, parser->Length)){
+            // a message is complete when it has its expected length and contains data bytes only
+            // (SysEx are emitted once terminated, see above)
+            if (parser->Length == parser->ExpectedLength && parser->DataValid){
 
                 if (parser->NRpnHandler != NULL
                     && getStatusClass(parser->Buffer[0]) == StatusClassControlChange
@@ -0,0 +1,548 @@
+#include <midimessage/smf.h>
+
+#include <string.h>
+
+#ifdef SMF_MMAP
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    bool smf_readHeader( uint8_t * data, size_t length, SmfHeader_t * header ){
+        ASSERT( data != NULL );
+        ASSERT( header != NULL );
+
+        if (length < SmfHeaderChunkLength || memcmp( data, "MThd", 4 ) != 0 || unpackSmfU32( &data[4] ) < 6){
+            return false;
+        }
+
+        header->Format = (data[8] << 8) | data[9];
+        header->TrackCount = (data[10] << 8) | data[11];
+        header->Division = (data[12] << 8) | data[13];
+
+        return header->Format <= SmfFormatMultiSequence;
+    }
+
+    int smf_nextTrack( uint8_t * data, size_t length, size_t * offset, SmfTrack_t * track ){
+        ASSERT( data != NULL );
+        ASSERT( offset != NULL );
+        ASSERT( track != NULL );
+
+        // the header chunk (at offset zero) is skipped like any other non-track chunk
+        while (*offset + SmfChunkHeaderLength <= length){
+
+            uint8_t * chunk = &data[*offset];
+            uint32_t chunkLength = unpackSmfU32( &chunk[4] );
+
+            if (chunkLength > length - *offset - SmfChunkHeaderLength){
+                return SmfResultError;
+            }
+
+            *offset += SmfChunkHeaderLength + chunkLength;
+
+            if (memcmp( chunk, "MTrk", 4 ) == 0){
+                track->Data = &chunk[SmfChunkHeaderLength];
+                track->Length = chunkLength;
+                track->Position = 0;
+                track->RunningStatus = MidiMessage_RunningStatusNotSet;
+                track->Time = 0;
+
+                return SmfResultOk;
+            }
+        }
+
+        return *offset == length ? SmfResultEnd : SmfResultError;
+    }
+
+    int smf_readEvent( SmfTrack_t * track, SmfEvent_t * event ){
+        ASSERT( track != NULL );
+        ASSERT( event != NULL );
+
+        if (track->Position >= track->Length){
+            return SmfResultEnd;
+        }
+
+        uint8_t * src = &track->Data[track->Position];
+        uint32_t len = track->Length - track->Position;
+
+        uint32_t n = unpackSmfVarLen( src, len, &event->Delta );
+        if (n == 0 || n >= len){
+            return SmfResultError;
+        }
+
+        uint8_t status = src[n];
+
+        if (status == 0xFF || status == SystemMessageSystemExclusive || status == SystemMessageEndOfExclusive){
+
+            if (status == 0xFF){
+                if (++n >= len){
+                    return SmfResultError;
+                }
+                event->Type = SmfEventTypeMeta;
+                event->MetaType = src[n];
+            } else {
+                event->Type = status == SystemMessageSystemExclusive ? SmfEventTypeSysEx : SmfEventTypeEscape;
+            }
+            n++;
+
+            uint8_t m = unpackSmfVarLen( &src[n], len - n, &event->Length );
+            if (m == 0 || event->Length > len - n - m){
+                return SmfResultError;
+            }
+
+            event->Data = &src[n + m];
+
+            // meta and sysex events cancel the running status
+            track->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+            n += m + event->Length;
+        }
+        else {
+            event->Type = SmfEventTypeMidi;
+
+            uint8_t * data;
+
+            if (isDataByte(status)){
+                if ( ! isRunningStatus(track->RunningStatus) ){
+                    return SmfResultError;
+                }
+                event->Length = getMsgLen( track->RunningStatus );
+                if (event->Length - 1 > len - n){
+                    return SmfResultError;
+                }
+
+                event->Bytes[0] = track->RunningStatus;
+                memcpy( &event->Bytes[1], &src[n], event->Length - 1 );
+                event->Data = event->Bytes;
+
+                data = &src[n];
+                n += event->Length - 1;
+            } else {
+                event->Length = getMsgLen( status );
+                if (event->Length == 0 || event->Length > len - n){
+                    return SmfResultError;
+                }
+
+                // zero-copy if status is given
+                event->Data = &src[n];
+
+                updateRunningStatus( &track->RunningStatus, status );
+
+                data = &src[n+1];
+                n += event->Length;
+            }
+
+            for(uint8_t i = 0; i < event->Length - 1; i++){
+                if ( ! isDataByte(data[i]) ){
+                    return SmfResultError;
+                }
+            }
+        }
+
+        event->Time = track->Time + event->Delta;
+
+        track->Time = event->Time;
+        track->Position += n;
+
+        return SmfResultOk;
+    }
+
+    bool smf_unpackEvent( SmfEvent_t * event, Message_t * msg, uint8_t * buffer, size_t maxLength ){
+        ASSERT( event != NULL );
+        ASSERT( msg != NULL );
+
+        if (event->Type == SmfEventTypeMidi){
+            return unpack( event->Data, event->Length, msg );
+        }
+
+        // only complete sysex messages
+        if (event->Type != SmfEventTypeSysEx || event->Length == 0 || event->Data[event->Length - 1] != SystemMessageEndOfExclusive){
+            return false;
+        }
+
+        if (buffer == NULL || event->Length + 1 > maxLength){
+            return false;
+        }
+
+        buffer[0] = SystemMessageSystemExclusive;
+        memcpy( &buffer[1], event->Data, event->Length );
+
+        return unpack( buffer, event->Length + 1, msg );
+    }
+
+    void smfstatistics_reset( SmfStatistics_t * stats ){
+        ASSERT( stats != NULL );
+
+        memset( stats, 0, sizeof(SmfStatistics_t) );
+    }
+
+    void smfstatistics_merge( SmfStatistics_t * dst, SmfStatistics_t * src ){
+        ASSERT( dst != NULL );
+        ASSERT( src != NULL );
+
+        // all fields are counters
+        uint64_t * d = (uint64_t*)dst;
+        uint64_t * s = (uint64_t*)src;
+
+        for(size_t i = 0; i < sizeof(SmfStatistics_t) / sizeof(uint64_t); i++){
+            d[i] += s[i];
+        }
+    }
+
+    bool smf_scan( uint8_t * data, size_t length, SmfStatistics_t * stats ){
+        ASSERT( data != NULL || length == 0 );
+        ASSERT( stats != NULL );
+
+        stats->Files++;
+
+        SmfHeader_t header;
+
+        if (length == 0 || ! smf_readHeader( data, length, &header )){
+            stats->InvalidFiles++;
+            return false;
+        }
+
+        // SysEx data is not needed
+        uint8_t byteData[1];
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+
+        SmfTrack_t track;
+        SmfEvent_t event;
+        size_t offset = 0;
+        int result;
+
+        while( (result = smf_nextTrack( data, length, &offset, &track )) == SmfResultOk ){
+
+            stats->Tracks++;
+
+            while( (result = smf_readEvent( &track, &event )) == SmfResultOk ){
+
+                stats->Events++;
+
+                if (event.Type == SmfEventTypeMidi){
+                    if ( ! unpack( event.Data, event.Length, &msg ) ){
+                        continue;
+                    }
+                    if (msg.StatusClass == StatusClassNoteOn && msg.Data.Note.Velocity > 0){
+                        stats->Notes[msg.Data.Note.Key]++;
+                    }
+                    else if (msg.StatusClass == StatusClassControlChange){
+                        stats->Controllers[msg.Data.ControlChange.Controller]++;
+                    }
+                }
+                else if (event.Type == SmfEventTypeSysEx){
+                    stats->SysExEvents++;
+
+                    if (event.Length == 0 || ! isDataByte(event.Data[0])){
+                        continue;
+                    }
+
+                    if (event.Data[0] == SysExIdManufacturerExtension_Byte){
+                        if (event.Length < 3 || ! isDataByte(event.Data[1]) || ! isDataByte(event.Data[2])){
+                            continue;
+                        }
+
+                        uint32_t id;
+                        unpackSysExId( event.Data, &id );
+
+                        stats->SysExExtendedIds[((id >> 1) & 0x3F80) | (id & DataMask)]++;
+                    } else {
+                        stats->SysExIds[event.Data[0]]++;
+                    }
+                }
+                else if (event.Type == SmfEventTypeMeta){
+                    stats->MetaEvents++;
+                }
+            }
+
+            if (result == SmfResultError){
+                break;
+            }
+        }
+
+        if (result == SmfResultError){
+            stats->InvalidFiles++;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool smfwriter_init( SmfWriter_t * writer, uint8_t * buffer, size_t maxLength, uint16_t format, uint16_t trackCount, uint16_t division ){
+        ASSERT( writer != NULL );
+        ASSERT( buffer != NULL );
+        ASSERT( format <= SmfFormatMultiSequence );
+        ASSERT( format != SmfFormatSingleTrack || trackCount == 1 );
+
+        writer->Buffer = buffer;
+        writer->MaxLength = maxLength;
+        writer->Length = 0;
+        writer->TrackStart = 0;
+        writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+        if (maxLength < SmfHeaderChunkLength){
+            return false;
+        }
+
+        memcpy( buffer, "MThd", 4 );
+        packSmfU32( &buffer[4], 6 );
+        buffer[8] = (format >> 8) & 0xFF;
+        buffer[9] = format & 0xFF;
+        buffer[10] = (trackCount >> 8) & 0xFF;
+        buffer[11] = trackCount & 0xFF;
+        buffer[12] = (division >> 8) & 0xFF;
+        buffer[13] = division & 0xFF;
+
+        writer->Length = SmfHeaderChunkLength;
+
+        return true;
+    }
+
+    bool smfwriter_beginTrack( SmfWriter_t * writer ){
+        ASSERT( writer != NULL );
+
+        if (writer->MaxLength - writer->Length < SmfChunkHeaderLength){
+            return false;
+        }
+
+        writer->TrackStart = writer->Length;
+        writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+        // length is set when the track ends
+        memcpy( &writer->Buffer[writer->Length], "MTrk", 4 );
+        packSmfU32( &writer->Buffer[writer->Length + 4], 0 );
+
+        writer->Length += SmfChunkHeaderLength;
+
+        return true;
+    }
+
+    bool smfwriter_writeMessage( SmfWriter_t * writer, uint32_t delta, Message_t * msg ){
+        ASSERT( writer != NULL );
+        ASSERT( msg != NULL );
+
+        uint8_t * dst = &writer->Buffer[writer->Length];
+        size_t available = writer->MaxLength - writer->Length;
+
+        // room for delta and sysex length
+        const size_t reserved = 2 * SmfVarLenMaxLength;
+
+        if (available < reserved + 3){
+            return false;
+        }
+
+        bool sysex = msg->StatusClass == StatusClassSystemMessage && msg->SystemMessage == SystemMessageSystemExclusive;
+
+        // experimental and manufacturer sysex messages are written directly, ie their exact length is known
+        if (sysex && (msg->Data.SysEx.Id == SysExIdExperimental || isSysExManufacturerId( msg->Data.SysEx.Id ))){
+            ASSERT( msg->Data.SysEx.ByteData != NULL || msg->Data.SysEx.Length == 0 );
+
+            uint8_t id[3];
+            uint8_t idLength = packSysExId( id, msg->Data.SysEx.Id );
+
+            // id, data and EOX
+            size_t length = idLength + msg->Data.SysEx.Length + 1;
+
+            if (available < reserved + 1 + length){
+                return false;
+            }
+
+            writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+            size_t len = packSmfVarLen( dst, delta );
+            dst[len++] = SystemMessageSystemExclusive;
+            len += packSmfVarLen( &dst[len], length );
+
+            memcpy( &dst[len], id, idLength );
+            len += idLength;
+
+            if (msg->Data.SysEx.Length > 0){
+                memcpy( &dst[len], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
+            }
+            len += msg->Data.SysEx.Length;
+
+            dst[len++] = SystemMessageEndOfExclusive;
+
+            writer->Length += len;
+
+            return true;
+        }
+
+        // pack behind the space reserved for the varlens (then move into place) if there is room for an upper bound of
+        // the packed length, otherwise into a scratch buffer (pack() expects sufficient room)
+        uint8_t scratch[SmfWriterScratchLength];
+        uint8_t * bytes = &dst[reserved];
+
+        size_t bound = sysex ? SmfUniversalSysExMaxOverhead + msg->Data.SysEx.Length : 3;
+
+        if (available < reserved + bound){
+            if (bound > sizeof(scratch)){
+                return false;
+            }
+            bytes = scratch;
+        }
+
+        size_t length = pack( bytes, msg );
+
+        if (length == 0 || available < reserved + length){
+            return false;
+        }
+
+        size_t len = packSmfVarLen( dst, delta );
+
+        if (bytes[0] == SystemMessageSystemExclusive){
+            writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+            dst[len++] = SystemMessageSystemExclusive;
+            len += packSmfVarLen( &dst[len], length - 1 );
+            memmove( &dst[len], &bytes[1], length - 1 );
+            len += length - 1;
+        }
+        else if (updateRunningStatus( &writer->RunningStatus, bytes[0] ) && isRunningStatus(bytes[0])){
+            memmove( &dst[len], &bytes[1], length - 1 );
+            len += length - 1;
+        }
+        else {
+            memmove( &dst[len], bytes, length );
+            len += length;
+        }
+
+        writer->Length += len;
+
+        return true;
+    }
+
+    bool smfwriter_writeEvent( SmfWriter_t * writer, uint32_t delta, uint8_t status, uint8_t * data, uint32_t length ){
+        ASSERT( writer != NULL );
+        ASSERT( data != NULL || length == 0 );
+        ASSERT( isControlByte(status) );
+
+        if (writer->MaxLength - writer->Length < 2 * SmfVarLenMaxLength + 1 + (size_t)length){
+            return false;
+        }
+
+        uint8_t * dst = &writer->Buffer[writer->Length];
+
+        size_t len = packSmfVarLen( dst, delta );
+
+        if (status == SystemMessageSystemExclusive || status == SystemMessageEndOfExclusive){
+            writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+            dst[len++] = status;
+            len += packSmfVarLen( &dst[len], length );
+        }
+        else if ( ! (updateRunningStatus( &writer->RunningStatus, status ) && isRunningStatus(status)) ){
+            dst[len++] = status;
+        }
+
+        if (length > 0){
+            memcpy( &dst[len], data, length );
+        }
+        len += length;
+
+        writer->Length += len;
+
+        return true;
+    }
+
+    bool smfwriter_writeMeta( SmfWriter_t * writer, uint32_t delta, uint8_t type, uint8_t * data, uint32_t length ){
+        ASSERT( writer != NULL );
+        ASSERT( data != NULL || length == 0 );
+        ASSERT( isDataByte(type) );
+
+        if (writer->MaxLength - writer->Length < 2 * SmfVarLenMaxLength + 2 + (size_t)length){
+            return false;
+        }
+
+        uint8_t * dst = &writer->Buffer[writer->Length];
+
+        size_t len = packSmfVarLen( dst, delta );
+        dst[len++] = 0xFF;
+        dst[len++] = type;
+        len += packSmfVarLen( &dst[len], length );
+        if (length > 0){
+            memcpy( &dst[len], data, length );
+        }
+        len += length;
+
+        writer->Length += len;
+        writer->RunningStatus = MidiMessage_RunningStatusNotSet;
+
+        return true;
+    }
+
+    bool smfwriter_endTrack( SmfWriter_t * writer, uint32_t delta ){
+        ASSERT( writer != NULL );
+
+        if ( ! smfwriter_writeMeta( writer, delta, SmfMetaEndOfTrack, NULL, 0 ) ){
+            return false;
+        }
+
+        packSmfU32( &writer->Buffer[writer->TrackStart + 4], writer->Length - writer->TrackStart - SmfChunkHeaderLength );
+
+        return true;
+    }
+
+#ifdef SMF_MMAP
+
+    bool smf_mapFile( const char * path, SmfFile_t * file ){
+        ASSERT( path != NULL );
+        ASSERT( file != NULL );
+
+        file->Data = NULL;
+        file->Length = 0;
+
+        int fd = open( path, O_RDONLY );
+        if (fd == -1){
+            return false;
+        }
+
+        struct stat st;
+
+        if (fstat( fd, &st ) == -1 || ! S_ISREG(st.st_mode)){
+            close( fd );
+            return false;
+        }
+
+        // (empty files can not be mapped)
+        if (st.st_size > 0){
+            void * data = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+            if (data == MAP_FAILED){
+                close( fd );
+                return false;
+            }
+
+            file->Data = (uint8_t*)data;
+            file->Length = st.st_size;
+        }
+
+        close( fd );
+
+        return true;
+    }
+
+    void smf_unmapFile( SmfFile_t * file ){
+        ASSERT( file != NULL );
+
+        if (file->Data != NULL){
+            munmap( file->Data, file->Length );
+        }
+
+        file->Data = NULL;
+        file->Length = 0;
+    }
+
+#endif //SMF_MMAP
+
+#ifdef __cplusplus
+    } // extern "C"
+} // namespace MidiMessage
+#endif
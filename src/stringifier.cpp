@@ -11,6 +11,25 @@
 
 #define str_eq(x,y)     (strcmp((char*)x,(char*)y) == 0)
 
+// FNV-1a hash of keywords: evaluated at compile time for literals, ie keyword tables are switches whose case labels are
+// a perfect hash (any collision being a duplicate case error) and an argument is hashed once and confirmed by a single
+// comparison.
+static constexpr uint32_t str_hash( const char * str, uint32_t hash = 2166136261u ){
+    return *str == '\0' ? hash : str_hash( str + 1, (hash ^ (uint8_t)*str) * 16777619u );
+}
+
+#define keyword_case(arg, keyword, dst, value) \
+                            case str_hash(keyword): \
+                                if ( ! str_eq(arg, keyword) ) { return false; } \
+                                *dst = value; \
+                                return true;
+
+// literals are copied with their length known at compile time (not null terminated)
+#define str_write(dst, literal)     writeBytes( (dst), (uint8_t*)(literal), sizeof(literal) - 1 )
+
+// hash comparison first, such that only a matching keyword is compared
+#define keyword_eq(hash, arg, keyword)  ((hash) == str_hash(keyword) && str_eq(arg, keyword))
+
 #define assertBool(expr)    if (!(expr)) { return StringifierResultInvalidValue; }
 #define assertU4(x)     if (((x) & NibbleMask) != (x)) { return StringifierResultInvalidU4; }
 #define assertU7(x)         if (x > MaxU7) { return StringifierResultInvalidU7; }
@@ -21,7 +40,7 @@
 #define assertS7(x)         if (x < MinS7 || MaxS7 < x) { return StringifierResultInvalidValue; }
 #define assertS14(x)         if (x < MinS14 || MaxS14 < x) { return StringifierResultInvalidValue; }
 #define assertData(bytes, len)   \
-                            for(uint8_t i = 0; i < len; i++){ \
+                            for(size_t i = 0; i < len; i++){ \
                                 assertU7(bytes[i]); \
                             }
 #define assertCueString(bytes) \
@@ -35,7 +54,7 @@ namespace MidiMessage {
 #endif
 
 
-    static bool readHex( uint8_t * bytes, uint8_t * length, uint8_t *argv, uint8_t expectedLength ){
+    static bool readHex( uint8_t * bytes, size_t * length, uint8_t *argv, uint8_t expectedLength ){
         int l = strlen((char*)argv);
 
         if (l % 2 != 0){
@@ -58,9 +77,142 @@ namespace MidiMessage {
         return false;
     }
 
-    inline int sprintfHex( uint8_t * dst, uint8_t * src, uint8_t length){
-        byte_to_hex( dst, src, length );
-        dst[2*length] = '\0';
+    // destination of the writers: Bytes is NULL if only the length is computed (see MessageStringLength()), Size the
+    // number of bytes left (see MessagetoStringBounded())
+    typedef struct {
+        uint8_t * Bytes;
+        size_t Size;
+    } StrDst_t;
+
+    // destination at offset, nothing is written once the end of the destination is passed
+    static inline StrDst_t str_at( StrDst_t dst, size_t offset ){
+        if (dst.Bytes == NULL || offset > dst.Size){
+            return StrDst_t{ NULL, 0 };
+        }
+        return StrDst_t{ &dst.Bytes[offset], dst.Size - offset };
+    }
+
+    // true if length bytes are to be written to dst
+    static inline bool str_fits( StrDst_t dst, size_t length ){
+        return dst.Bytes != NULL && length <= dst.Size;
+    }
+
+    // all writers return the number of bytes (to be) written, nothing is written unless it fits into dst
+
+    static inline int writeBytes( StrDst_t dst, const uint8_t * src, size_t length ){
+        if (str_fits( dst, length )){
+            memcpy( dst.Bytes, src, length );
+        }
+        return length;
+    }
+
+    static inline int writeChar( StrDst_t dst, uint8_t chr ){
+        if (str_fits( dst, 1 )){
+            *dst.Bytes = chr;
+        }
+        return 1;
+    }
+
+    // "00".."99"
+    static const char DecimalDigitPairs[] =
+            "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+            "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+            "8081828384858687888990919293949596979899";
+
+    static const char HexDigits[] = "0123456789ABCDEF";
+
+    // decimal representation of 0..16383 (ie any u14 and below)
+    static inline int writeU14( uint8_t * dst, uint16_t value ){
+        if (value < 10){
+            dst[0] = '0' + value;
+            return 1;
+        }
+        if (value < 100){
+            memcpy( dst, &DecimalDigitPairs[2 * value], 2 );
+            return 2;
+        }
+        if (value < 1000){
+            dst[0] = '0' + value / 100;
+            memcpy( &dst[1], &DecimalDigitPairs[2 * (value % 100)], 2 );
+            return 3;
+        }
+        if (value < 10000){
+            memcpy( dst, &DecimalDigitPairs[2 * (value / 100)], 2 );
+            memcpy( &dst[2], &DecimalDigitPairs[2 * (value % 100)], 2 );
+            return 4;
+        }
+        dst[0] = '0' + value / 10000;
+        value %= 10000;
+        memcpy( &dst[1], &DecimalDigitPairs[2 * (value / 100)], 2 );
+        memcpy( &dst[3], &DecimalDigitPairs[2 * (value % 100)], 2 );
+        return 5;
+    }
+
+    // like sprintf "%d" (resp. "%u", "%llu") but not null terminated
+    static int writeDecimal( StrDst_t dst, int64_t value ){
+        if (0 <= value && value <= MaxU14 && str_fits( dst, 5 )){
+            return writeU14( dst.Bytes, value );
+        }
+
+        int length = value < 0 ? 2 : 1;
+        for(int64_t v = value / 10; v != 0; v /= 10){
+            length++;
+        }
+
+        if ( ! str_fits( dst, length ) ){
+            return length;
+        }
+
+        uint64_t v = value < 0 ? -(uint64_t)value : value;
+
+        int i = length;
+        do {
+            dst.Bytes[--i] = '0' + v % 10;
+            v /= 10;
+        } while (v > 0);
+
+        if (value < 0){
+            dst.Bytes[0] = '-';
+        }
+
+        return length;
+    }
+
+    // like sprintf "%0<width>X" but not null terminated
+    static int writeHex( StrDst_t dst, uint32_t value, uint8_t width ){
+        uint8_t length = 1;
+        while (length < 8 && (value >> (4 * length)) > 0){
+            length++;
+        }
+        if (length < width){
+            length = width;
+        }
+
+        if ( ! str_fits( dst, length ) ){
+            return length;
+        }
+
+        for(uint8_t i = 0; i < length; i++){
+            dst.Bytes[i] = HexDigits[(value >> (4 * (length - 1 - i))) & NibbleMask];
+        }
+
+        return length;
+    }
+
+    // like sprintf "%s" but not null terminated
+    static inline int writeString( StrDst_t dst, const char * str ){
+        // (as glibc does)
+        if (str == NULL){
+            return str_write( dst, "(null)" );
+        }
+
+        return writeBytes( dst, (uint8_t*)str, strlen( str ) );
+    }
+
+    inline int sprintfHex( StrDst_t dst, uint8_t * src, size_t length){
+        if (str_fits( dst, 2 * length )){
+            byte_to_hex( dst.Bytes, src, length );
+        }
         return 2 * length;
     }
 
@@ -108,7 +260,7 @@ namespace MidiMessage {
         return false;
     }
 
-    static int sprintfMtc( uint8_t * dst, MidiTimeCode_t * mtc){
+    static int sprintfMtc( StrDst_t dst, MidiTimeCode_t * mtc){
 
         uint8_t fps = 0;
         switch(mtc->Fps){
@@ -117,20 +269,27 @@ namespace MidiMessage {
             case MtcFrameRate29_97fps: fps = 29; break;
             case MtcFrameRate30fps: fps = 30; break;
         }
-        return sprintf( (char*)dst, "%d%s %d %d %d %d",
-               fps,
-               fps == 29 ? ".97" : "",
-               mtc->Hour,
-               mtc->Minute,
-               mtc->Second,
-               mtc->Frame
-        );
+        int length = writeDecimal( dst, fps );
+        if (fps == 29){
+            length += str_write( str_at( dst, length ), ".97" );
+        }
+        length += writeChar( str_at( dst, length ), ' ' );
+        length += writeDecimal( str_at( dst, length ), mtc->Hour );
+        length += writeChar( str_at( dst, length ), ' ' );
+        length += writeDecimal( str_at( dst, length ), mtc->Minute );
+        length += writeChar( str_at( dst, length ), ' ' );
+        length += writeDecimal( str_at( dst, length ), mtc->Second );
+        length += writeChar( str_at( dst, length ), ' ' );
+        length += writeDecimal( str_at( dst, length ), mtc->Frame );
+
+        return length;
     }
 
-    static int sprintfMtcLong( uint8_t * dst, MidiTimeCode_t * mtc){
+    static int sprintfMtcLong( StrDst_t dst, MidiTimeCode_t * mtc){
         int length = sprintfMtc(dst, mtc);
 
-        length += sprintf((char*)&dst[length], " %d", mtc->FractionalFrame);
+        length += str_write( str_at( dst, length ), " " );
+        length += writeDecimal( str_at( dst, length ), mtc->FractionalFrame );
 
         return length;
     }
@@ -194,110 +353,272 @@ namespace MidiMessage {
         return true;
     }
 
-    static uint8_t sprintfCueNumber( uint8_t * dst, MscCueNumber_t *cueNumber ){
-        uint8_t len = sprintf( (char*)dst, "%s", cueNumber->Number );
+    static uint8_t sprintfCueNumber( StrDst_t dst, MscCueNumber_t *cueNumber ){
+        uint8_t len = writeString( dst, (char*)cueNumber->Number );
 
         if (cueNumber->List == NULL){
             return len;
         }
 
-        len += sprintf( (char*)&dst[len], " %s", cueNumber->List );
+        len += str_write( str_at( dst, len ), " " );
+        len += writeString( str_at( dst, len ), (char*)cueNumber->List );
 
         if (cueNumber->Path == NULL){
             return len;
         }
 
-        len += sprintf( (char*)&dst[len], " %s", cueNumber->Path );
+        len += str_write( str_at( dst, len ), " " );
+        len += writeString( str_at( dst, len ), (char*)cueNumber->Path );
 
         return len;
     }
 
     static bool readSdsLoopType( uint8_t *loopType, uint8_t * argv){
-        if (str_eq(argv, "uni-forward")){
-            *loopType = SysExNonRtSdsLoopTypeForward;
-            return true;
-        }
-        if (str_eq(argv, "bi-forward")){
-            *loopType = SysExNonRtSdsLoopTypeForwardBackward;
-            return true;
-        }
-        if (str_eq(argv, "uni-forward-release")){
-            *loopType = SysExNonRtSdsLoopTypeForwardWithRelease;
-            return true;
-        }
-        if (str_eq(argv, "bi-forward-release")){
-            *loopType = SysExNonRtSdsLoopTypeForwardBackwardWithRelease;
-            return true;
-        }
-
-        if (str_eq(argv, "uni-backward")){
-            *loopType = SysExNonRtSdsLoopTypeBackward;
-            return true;
-        }
-        if (str_eq(argv, "bi-backward")){
-            *loopType = SysExNonRtSdsLoopTypeBackwardForward;
-            return true;
-        }
-        if (str_eq(argv, "uni-backward-release")){
-            *loopType = SysExNonRtSdsLoopTypeBackwardWithRelease;
-            return true;
-        }
-        if (str_eq(argv, "bi-backward-release")){
-            *loopType = SysExNonRtSdsLoopTypeBackwardForwardWithRelease;
-            return true;
-        }
-
-        if (str_eq(argv, "backward-once")){
-            *loopType = SysExNonRtSdsLoopTypeBackwardOneShot;
-            return true;
-        }
-        if (str_eq(argv, "forward-once")){
-            *loopType = SysExNonRtSdsLoopTypeForwardOneShot;
-            return true;
+        switch( str_hash( (char*)argv ) ){
+            keyword_case( argv, "uni-forward", loopType, SysExNonRtSdsLoopTypeForward )
+            keyword_case( argv, "bi-forward", loopType, SysExNonRtSdsLoopTypeForwardBackward )
+            keyword_case( argv, "uni-forward-release", loopType, SysExNonRtSdsLoopTypeForwardWithRelease )
+            keyword_case( argv, "bi-forward-release", loopType, SysExNonRtSdsLoopTypeForwardBackwardWithRelease )
+            keyword_case( argv, "uni-backward", loopType, SysExNonRtSdsLoopTypeBackward )
+            keyword_case( argv, "bi-backward", loopType, SysExNonRtSdsLoopTypeBackwardForward )
+            keyword_case( argv, "uni-backward-release", loopType, SysExNonRtSdsLoopTypeBackwardWithRelease )
+            keyword_case( argv, "bi-backward-release", loopType, SysExNonRtSdsLoopTypeBackwardForwardWithRelease )
+            keyword_case( argv, "backward-once", loopType, SysExNonRtSdsLoopTypeBackwardOneShot )
+            keyword_case( argv, "forward-once", loopType, SysExNonRtSdsLoopTypeForwardOneShot )
         }
 
         return false;
     }
 
 
-    static uint8_t sprintfSdsLoopType( uint8_t * dst, uint8_t loopType ){
+    static uint8_t sprintfSdsLoopType( StrDst_t dst, uint8_t loopType ){
 
         switch (loopType){
             case SysExNonRtSdsLoopTypeForward:
-                return sprintf( (char*)dst, "uni-forward");
+                return str_write( dst, "uni-forward" );
 
             case SysExNonRtSdsLoopTypeForwardBackward:
-                return sprintf( (char*)dst, "bi-forward");
+                return str_write( dst, "bi-forward" );
 
             case SysExNonRtSdsLoopTypeForwardWithRelease:
-                return sprintf( (char*)dst, "uni-forward-release");
+                return str_write( dst, "uni-forward-release" );
 
             case SysExNonRtSdsLoopTypeForwardBackwardWithRelease:
-                return sprintf( (char*)dst, "bi-forward-release");
+                return str_write( dst, "bi-forward-release" );
 
             case SysExNonRtSdsLoopTypeBackward:
-                return sprintf( (char*)dst, "uni-backward");
+                return str_write( dst, "uni-backward" );
 
             case SysExNonRtSdsLoopTypeBackwardForward:
-                return sprintf( (char*)dst, "bi-backward");
+                return str_write( dst, "bi-backward" );
 
             case SysExNonRtSdsLoopTypeBackwardWithRelease:
-                return sprintf( (char*)dst, "uni-backward-release");
+                return str_write( dst, "uni-backward-release" );
 
             case SysExNonRtSdsLoopTypeBackwardForwardWithRelease:
-                return sprintf( (char*)dst, "bi-backward-release");
+                return str_write( dst, "bi-backward-release" );
 
             case SysExNonRtSdsLoopTypeBackwardOneShot:
-                return sprintf( (char*)dst, "backward-once");
+                return str_write( dst, "backward-once" );
 
             case SysExNonRtSdsLoopTypeForwardOneShot:
-                return sprintf( (char*)dst, "forward-once");
+                return str_write( dst, "forward-once" );
         }
 
         return 0;
     }
 
-    inline int ArgsToMccData( uint8_t * bytes, uint8_t * length, uint8_t argc, uint8_t ** argv){
+    // (single byte) system messages
+    static bool readSystemMessage( uint8_t * systemMessage, uint8_t * arg ){
+        switch( str_hash( (char*)arg ) ){
+            keyword_case( arg, "start", systemMessage, SystemMessageStart )
+            keyword_case( arg, "stop", systemMessage, SystemMessageStop )
+            keyword_case( arg, "continue", systemMessage, SystemMessageContinue )
+            keyword_case( arg, "active-sensing", systemMessage, SystemMessageActiveSensing )
+            keyword_case( arg, "reset", systemMessage, SystemMessageReset )
+            keyword_case( arg, "timing-clock", systemMessage, SystemMessageTimingClock )
+            keyword_case( arg, "tune-request", systemMessage, SystemMessageTuneRequest )
+        }
+
+        return false;
+    }
+
+    // MMC commands
+    static bool readMmcCommand( uint8_t * command, uint8_t * arg ){
+        switch( str_hash( (char*)arg ) ){
+            keyword_case( arg, "stop", command, SysExRtMmcCommandStop )
+            keyword_case( arg, "play", command, SysExRtMmcCommandPlay )
+            keyword_case( arg, "deferred-play", command, SysExRtMmcCommandDeferredPlay )
+            keyword_case( arg, "fast-forward", command, SysExRtMmcCommandFastForward )
+            keyword_case( arg, "rewind", command, SysExRtMmcCommandRewind )
+            keyword_case( arg, "record-strobe", command, SysExRtMmcCommandRecordStrobe )
+            keyword_case( arg, "record-exit", command, SysExRtMmcCommandRecordExit )
+            keyword_case( arg, "record-pause", command, SysExRtMmcCommandRecordPause )
+            keyword_case( arg, "pause", command, SysExRtMmcCommandPause )
+            keyword_case( arg, "eject", command, SysExRtMmcCommandEject )
+            keyword_case( arg, "chase", command, SysExRtMmcCommandChase )
+            keyword_case( arg, "command-error-reset", command, SysExRtMmcCommandCommandErrorReset )
+            keyword_case( arg, "mmc-reset", command, SysExRtMmcCommandMmcReset )
+            keyword_case( arg, "wait", command, SysExRtMmcCommandWait )
+            keyword_case( arg, "resume", command, SysExRtMmcCommandResume )
+            keyword_case( arg, "variable-play", command, SysExRtMmcCommandVariablePlay )
+            keyword_case( arg, "search", command, SysExRtMmcCommandSearch )
+            keyword_case( arg, "shuttle", command, SysExRtMmcCommandShuttle )
+            keyword_case( arg, "deferred-variable-play", command, SysExRtMmcCommandDeferredVariablePlay )
+            keyword_case( arg, "record-strobe-variable", command, SysExRtMmcCommandRecordStrobeVariable )
+            keyword_case( arg, "step", command, SysExRtMmcCommandStep )
+            keyword_case( arg, "write", command, SysExRtMmcCommandWrite )
+            keyword_case( arg, "masked-write", command, SysExRtMmcCommandMaskedWrite )
+            keyword_case( arg, "read", command, SysExRtMmcCommandRead )
+            keyword_case( arg, "update", command, SysExRtMmcCommandUpdate )
+            keyword_case( arg, "locate", command, SysExRtMmcCommandLocate )
+            keyword_case( arg, "assign-system-master", command, SysExRtMmcCommandAssignSystemMaster )
+            keyword_case( arg, "generator-command", command, SysExRtMmcCommandGeneratorCommand )
+            keyword_case( arg, "mtc-command", command, SysExRtMmcCommandMtcCommand )
+            keyword_case( arg, "move", command, SysExRtMmcCommandMove )
+            keyword_case( arg, "add", command, SysExRtMmcCommandAdd )
+            keyword_case( arg, "substract", command, SysExRtMmcCommandSubstract )
+            keyword_case( arg, "drop-frame-adjust", command, SysExRtMmcCommandDropFrameAdjust )
+            keyword_case( arg, "procedure", command, SysExRtMmcCommandProcedure )
+            keyword_case( arg, "event", command, SysExRtMmcCommandEvent )
+            keyword_case( arg, "group", command, SysExRtMmcCommandGroup )
+            keyword_case( arg, "command-segment", command, SysExRtMmcCommandCommandSegment )
+        }
+
+        return false;
+    }
+
+    // MSC command formats
+    static bool readMscCommandFormat( uint8_t * commandFormat, uint8_t * arg ){
+        switch( str_hash( (char*)arg ) ){
+            keyword_case( arg, "lighting", commandFormat, SysExRtMscCmdFmtLighting )
+            keyword_case( arg, "moving-lights", commandFormat, SysExRtMscCmdFmtMovingLights )
+            keyword_case( arg, "color-changers", commandFormat, SysExRtMscCmdFmtColorChangers )
+            keyword_case( arg, "strobes", commandFormat, SysExRtMscCmdFmtStrobes )
+            keyword_case( arg, "lasers", commandFormat, SysExRtMscCmdFmtLasers )
+            keyword_case( arg, "chasers", commandFormat, SysExRtMscCmdFmtChasers )
+            keyword_case( arg, "sound", commandFormat, SysExRtMscCmdFmtSound )
+            keyword_case( arg, "music", commandFormat, SysExRtMscCmdFmtMusic )
+            keyword_case( arg, "cd-players", commandFormat, SysExRtMscCmdFmtCdPlayers )
+            keyword_case( arg, "eprom-playback", commandFormat, SysExRtMscCmdFmtEpromPlayback )
+            keyword_case( arg, "audio-tape-machines", commandFormat, SysExRtMscCmdFmtAudioTapeMachines )
+            keyword_case( arg, "intercoms", commandFormat, SysExRtMscCmdFmtIntercoms )
+            keyword_case( arg, "amplifiers", commandFormat, SysExRtMscCmdFmtAmplifiers )
+            keyword_case( arg, "audio-fx", commandFormat, SysExRtMscCmdFmtAudioEffectsDevices )
+            keyword_case( arg, "equalizers", commandFormat, SysExRtMscCmdFmtEqualizers )
+            keyword_case( arg, "machinery", commandFormat, SysExRtMscCmdFmtMachinery )
+            keyword_case( arg, "rigging", commandFormat, SysExRtMscCmdFmtRigging )
+            keyword_case( arg, "flys", commandFormat, SysExRtMscCmdFmtFlys )
+            keyword_case( arg, "lifts", commandFormat, SysExRtMscCmdFmtLifts )
+            keyword_case( arg, "turntables", commandFormat, SysExRtMscCmdFmtTurntables )
+            keyword_case( arg, "trusses", commandFormat, SysExRtMscCmdFmtTrusses )
+            keyword_case( arg, "robots", commandFormat, SysExRtMscCmdFmtRobots )
+            keyword_case( arg, "animation", commandFormat, SysExRtMscCmdFmtAnimation )
+            keyword_case( arg, "floats", commandFormat, SysExRtMscCmdFmtFloats )
+            keyword_case( arg, "breakaways", commandFormat, SysExRtMscCmdFmtBreakaways )
+            keyword_case( arg, "barges", commandFormat, SysExRtMscCmdFmtBarges )
+            keyword_case( arg, "video", commandFormat, SysExRtMscCmdFmtVideo )
+            keyword_case( arg, "video-tape-machines", commandFormat, SysExRtMscCmdFmtVideoTapeMachines )
+            keyword_case( arg, "video-cassette-machines", commandFormat, SysExRtMscCmdFmtVideoCassetteMachines )
+            keyword_case( arg, "video-disc-players", commandFormat, SysExRtMscCmdFmtVideoDiscPlayers )
+            keyword_case( arg, "video-switchers", commandFormat, SysExRtMscCmdFmtVideoSwitchers )
+            keyword_case( arg, "video-fx", commandFormat, SysExRtMscCmdFmtVideoEffects )
+            keyword_case( arg, "video-char-generators", commandFormat, SysExRtMscCmdFmtVideoCharacterGenerators )
+            keyword_case( arg, "video-still-stores", commandFormat, SysExRtMscCmdFmtVideoStillStores )
+            keyword_case( arg, "video-monitors", commandFormat, SysExRtMscCmdFmtVideoMonitors )
+            keyword_case( arg, "projection", commandFormat, SysExRtMscCmdFmtProjection )
+            keyword_case( arg, "film-projects", commandFormat, SysExRtMscCmdFmtFilmProjectors )
+            keyword_case( arg, "slide-projectors", commandFormat, SysExRtMscCmdFmtSlideProjectors )
+            keyword_case( arg, "video-projectors", commandFormat, SysExRtMscCmdFmtVideoProjectors )
+            keyword_case( arg, "dissolvers", commandFormat, SysExRtMscCmdFmtDissolvers )
+            keyword_case( arg, "shutter-controls", commandFormat, SysExRtMscCmdFmtShutterControls )
+            keyword_case( arg, "process-control", commandFormat, SysExRtMscCmdFmtProcessControl )
+            keyword_case( arg, "hydraulic-oil", commandFormat, SysExRtMscCmdFmtHydraulicOil )
+            keyword_case( arg, "h2o", commandFormat, SysExRtMscCmdFmtH2O )
+            keyword_case( arg, "co2", commandFormat, SysExRtMscCmdFmtCO2 )
+            keyword_case( arg, "compressed-air", commandFormat, SysExRtMscCmdFmtCompressedAir )
+            keyword_case( arg, "natural-gas", commandFormat, SysExRtMscCmdFmtNaturalGas )
+            keyword_case( arg, "fog", commandFormat, SysExRtMscCmdFmtFog )
+            keyword_case( arg, "smoke", commandFormat, SysExRtMscCmdFmtSmoke )
+            keyword_case( arg, "cracked-haze", commandFormat, SysExRtMscCmdFmtCrackedHaze )
+            keyword_case( arg, "pyro", commandFormat, SysExRtMscCmdFmtPyro )
+            keyword_case( arg, "fireworks", commandFormat, SysExRtMscCmdFmtFireworks )
+            keyword_case( arg, "explosions", commandFormat, SysExRtMscCmdFmtExplosions )
+            keyword_case( arg, "flame", commandFormat, SysExRtMscCmdFmtFlame )
+            keyword_case( arg, "smoke-pots", commandFormat, SysExRtMscCmdFmtSmokePots )
+            keyword_case( arg, "all", commandFormat, SysExRtMscCmdFmtAllTypes )
+        }
+
+        return false;
+    }
+
+    // MSC commands
+    static bool readMscCommand( uint8_t * command, uint8_t * arg ){
+        switch( str_hash( (char*)arg ) ){
+            keyword_case( arg, "go", command, SysExRtMscCmdGo )
+            keyword_case( arg, "stop", command, SysExRtMscCmdStop )
+            keyword_case( arg, "resume", command, SysExRtMscCmdResume )
+            keyword_case( arg, "load", command, SysExRtMscCmdLoad )
+            keyword_case( arg, "go-off", command, SysExRtMscCmdGoOff )
+            keyword_case( arg, "go-jam-lock", command, SysExRtMscCmdGo_JamLock )
+            keyword_case( arg, "timed-go", command, SysExRtMscCmdTimedGo )
+            keyword_case( arg, "set", command, SysExRtMscCmdSet )
+            keyword_case( arg, "fire", command, SysExRtMscCmdFire )
+            keyword_case( arg, "standby+", command, SysExRtMscCmdStandbyPlus )
+            keyword_case( arg, "standby-", command, SysExRtMscCmdStandbyMinus )
+            keyword_case( arg, "sequence+", command, SysExRtMscCmdSequencePlus )
+            keyword_case( arg, "sequence-", command, SysExRtMscCmdSequenceMinus )
+            keyword_case( arg, "start-clock", command, SysExRtMscCmdStartClock )
+            keyword_case( arg, "stop-clock", command, SysExRtMscCmdStopClock )
+            keyword_case( arg, "zero-clock", command, SysExRtMscCmdZeroClock )
+            keyword_case( arg, "mtc-chase-on", command, SysExRtMscCmdMtcChaseOn )
+            keyword_case( arg, "mtc-chase-off", command, SysExRtMscCmdMtcChaseOff )
+            keyword_case( arg, "open-cue-list", command, SysExRtMscCmdOpenCueList )
+            keyword_case( arg, "close-cue-list", command, SysExRtMscCmdCloseCueList )
+            keyword_case( arg, "open-cue-path", command, SysExRtMscCmdOpenCuePath )
+            keyword_case( arg, "close-cue-path", command, SysExRtMscCmdCloseCuePath )
+            keyword_case( arg, "set-clock", command, SysExRtMscCmdSetClock )
+            keyword_case( arg, "standby", command, SysExRtMscCmdStandby )
+            keyword_case( arg, "go-2-pc", command, SysExRtMscCmdGo2Pc )
+            keyword_case( arg, "standing-by", command, SysExRtMscCmdStandingBy )
+            keyword_case( arg, "complete", command, SysExRtMscCmdComplete )
+            keyword_case( arg, "cancel", command, SysExRtMscCmdCancel )
+            keyword_case( arg, "cancelled", command, SysExRtMscCmdCancelled )
+            keyword_case( arg, "abort", command, SysExRtMscCmdAbort )
+            keyword_case( arg, "all-off", command, SysExRtMscCmdAllOff )
+            keyword_case( arg, "restore", command, SysExRtMscCmdRestore )
+            keyword_case( arg, "reset", command, SysExRtMscCmdReset )
+        }
+
+        return false;
+    }
+
+    // MVC parameter addresses
+    static bool readMvcParameterAddress( uint32_t * address, uint8_t * arg ){
+        switch( str_hash( (char*)arg ) ){
+            keyword_case( arg, "on-off", address, SysExNonRtMvcAddressMidiVisualControlOnOff )
+            keyword_case( arg, "clip-control-channel", address, SysExNonRtMvcAddressClipControlRxChannel )
+            keyword_case( arg, "fx-control-channel", address, SysExNonRtMvcAddressEffectControlRxChannel )
+            keyword_case( arg, "note-msg-enabled", address, SysExNonRtMvcAddressNoteMessageEnabled )
+            keyword_case( arg, "playback-assign-msn", address, SysExNonRtMvcAddressPlaybackSpeedCtrlAssignMsn )
+            keyword_case( arg, "playback-assign-lsn", address, SysExNonRtMvcAddressPlaybackSpeedCtrlAssignLsn )
+            keyword_case( arg, "dissolve-assign-msn", address, SysExNonRtMvcAddressDissolveTimeCtrlAssignMsn )
+            keyword_case( arg, "dissolve-assign-lsn", address, SysExNonRtMvcAddressDissolveTimeCtrlAssignLsn )
+            keyword_case( arg, "fx1-assign-msn", address, SysExNonRtMvcAddressEffectControl1AssignMsn )
+            keyword_case( arg, "fx1-assign-lsn", address, SysExNonRtMvcAddressEffectControl1AssignLsn )
+            keyword_case( arg, "fx2-assign-msn", address, SysExNonRtMvcAddressEffectControl2AssignMsn )
+            keyword_case( arg, "fx2-assign-lsn", address, SysExNonRtMvcAddressEffectControl2AssignLsn )
+            keyword_case( arg, "fx3-assign-msn", address, SysExNonRtMvcAddressEffectControl3AssignMsn )
+            keyword_case( arg, "fx3-assign-lsn", address, SysExNonRtMvcAddressEffectControl3AssignLsn )
+            keyword_case( arg, "playback-speed-range", address, SysExNonRtMvcAddressPlaybackSpeedCtrlRange )
+            keyword_case( arg, "keyboard-range-lower", address, SysExNonRtMvcAddressKeyboardRangeLower )
+            keyword_case( arg, "keyboard-range-upper", address, SysExNonRtMvcAddressKeyboardRangeUpper )
+        }
+
+        return false;
+    }
+
+    inline int ArgsToMccData( uint8_t * bytes, size_t * length, uint8_t argc, uint8_t ** argv){
 
 
         if (argc == 0){
@@ -312,118 +633,7 @@ namespace MidiMessage {
 
             cmd.Command.Value = 0;
 
-            if (str_eq(argv[0], "stop")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandStop;
-            }
-            else if (str_eq(argv[0], "play")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandPlay;
-            }
-            else if (str_eq(argv[0], "deferred-play")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandDeferredPlay;
-            }
-            else if (str_eq(argv[0], "fast-forward")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandFastForward;
-            }
-            else if (str_eq(argv[0], "rewind")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRewind;
-            }
-            else if (str_eq(argv[0], "record-strobe")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRecordStrobe;
-            }
-            else if (str_eq(argv[0], "record-exit")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRecordExit;
-            }
-            else if (str_eq(argv[0], "record-pause")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRecordPause;
-            }
-            else if (str_eq(argv[0], "pause")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandPause;
-            }
-            else if (str_eq(argv[0], "eject")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandEject;
-            }
-            else if (str_eq(argv[0], "chase")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandChase;
-            }
-            else if (str_eq(argv[0], "command-error-reset")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandCommandErrorReset;
-            }
-            else if (str_eq(argv[0], "mmc-reset")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandMmcReset;
-            }
-            else if (str_eq(argv[0], "wait")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandWait;
-            }
-            else if (str_eq(argv[0], "resume")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandResume;
-            }
-            else if (str_eq(argv[0], "variable-play")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandVariablePlay;
-            }
-            else if (str_eq(argv[0], "search")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandSearch;
-            }
-            else if (str_eq(argv[0], "shuttle")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandShuttle;
-            }
-            else if (str_eq(argv[0], "deferred-variable-play")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandDeferredVariablePlay;
-            }
-            else if (str_eq(argv[0], "record-strobe-variable")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRecordStrobeVariable;
-            }
-            else if (str_eq(argv[0], "step")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandStep;
-            }
-            else if (str_eq(argv[0], "write")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandWrite;
-            }
-            else if (str_eq(argv[0], "masked-write")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandMaskedWrite;
-            }
-            else if (str_eq(argv[0], "read")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandRead;
-            }
-            else if (str_eq(argv[0], "update")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandUpdate;
-            }
-            else if (str_eq(argv[0], "locate")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandLocate;
-            }
-            else if (str_eq(argv[0], "assign-system-master")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandAssignSystemMaster;
-            }
-            else if (str_eq(argv[0], "generator-command")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandGeneratorCommand;
-            }
-            else if (str_eq(argv[0], "mtc-command")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandMtcCommand;
-            }
-            else if (str_eq(argv[0], "move")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandMove;
-            }
-            else if (str_eq(argv[0], "add")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandAdd;
-            }
-            else if (str_eq(argv[0], "substract")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandSubstract;
-            }
-            else if (str_eq(argv[0], "drop-frame-adjust")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandDropFrameAdjust;
-            }
-            else if (str_eq(argv[0], "procedure")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandProcedure;
-            }
-            else if (str_eq(argv[0], "event")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandEvent;
-            }
-            else if (str_eq(argv[0], "group")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandGroup;
-            }
-            else if (str_eq(argv[0], "command-segment")) {
-                cmd.Command.Bytes[0] = SysExRtMmcCommandCommandSegment;
-            }
-            else {
+            if ( ! readMmcCommand( &cmd.Command.Bytes[0], argv[0] ) ){
                 return StringifierResultInvalidValue;
             }
 
@@ -566,7 +776,7 @@ namespace MidiMessage {
         return StringifierResultOk;
     }
 
-    inline int MccDataToString( uint8_t * bytes, uint8_t * data, uint8_t length){
+    inline int MccDataToString( StrDst_t bytes, uint8_t * data, size_t length){
 
         int strLength = 0;
 
@@ -581,53 +791,52 @@ namespace MidiMessage {
 
             // prepend next command with space
             if (strLength > 0){
-                bytes[strLength++] = ' ';
-                bytes[strLength] = '\0'; // safety
+                strLength += writeChar( str_at( bytes, strLength ), ' ' );
             }
 
             switch (cmd.Command.Bytes[0]) {
 
-                case SysExRtMmcCommandStop:                     strLength += sprintf( (char*)&bytes[strLength], "stop"); break;
-                case SysExRtMmcCommandPlay:                     strLength += sprintf( (char*)&bytes[strLength], "play"); break;
-                case SysExRtMmcCommandDeferredPlay:             strLength += sprintf( (char*)&bytes[strLength], "deferred-play"); break;
-                case SysExRtMmcCommandFastForward:              strLength += sprintf( (char*)&bytes[strLength], "fast-forward"); break;
-                case SysExRtMmcCommandRewind:                   strLength += sprintf( (char*)&bytes[strLength], "rewind"); break;
-                case SysExRtMmcCommandRecordStrobe:             strLength += sprintf( (char*)&bytes[strLength], "record-strobe"); break;
-                case SysExRtMmcCommandRecordExit:               strLength += sprintf( (char*)&bytes[strLength], "record-exit"); break;
-                case SysExRtMmcCommandRecordPause:              strLength += sprintf( (char*)&bytes[strLength], "record-pause"); break;
-                case SysExRtMmcCommandPause:                    strLength += sprintf( (char*)&bytes[strLength], "pause"); break;
-                case SysExRtMmcCommandEject:                    strLength += sprintf( (char*)&bytes[strLength], "eject"); break;
-                case SysExRtMmcCommandChase:                    strLength += sprintf( (char*)&bytes[strLength], "chase"); break;
-                case SysExRtMmcCommandCommandErrorReset:        strLength += sprintf( (char*)&bytes[strLength], "command-error-reset"); break;
-                case SysExRtMmcCommandMmcReset:                 strLength += sprintf( (char*)&bytes[strLength], "mmc-reset"); break;
-                case SysExRtMmcCommandWait:                     strLength += sprintf( (char*)&bytes[strLength], "wait"); break;
-                case SysExRtMmcCommandResume:                   strLength += sprintf( (char*)&bytes[strLength], "resume"); break;
-
-                case SysExRtMmcCommandVariablePlay:             strLength += sprintf( (char*)&bytes[strLength], "variable-play "); break;
-                case SysExRtMmcCommandSearch:                   strLength += sprintf( (char*)&bytes[strLength], "search "); break;
-                case SysExRtMmcCommandShuttle:                  strLength += sprintf( (char*)&bytes[strLength], "shuttle "); break;
-                case SysExRtMmcCommandDeferredVariablePlay:     strLength += sprintf( (char*)&bytes[strLength], "deferred-variable-play "); break;
-                case SysExRtMmcCommandRecordStrobeVariable:     strLength += sprintf( (char*)&bytes[strLength], "record-strobe-variable "); break;
-
-                case SysExRtMmcCommandStep:                     strLength += sprintf( (char*)&bytes[strLength], "step "); break;
-
-                case SysExRtMmcCommandWrite:                    strLength += sprintf( (char*)&bytes[strLength], "write "); break;
-
-                case SysExRtMmcCommandMaskedWrite:              strLength += sprintf( (char*)&bytes[strLength], "masked-write "); break;
-                case SysExRtMmcCommandRead:                     strLength += sprintf( (char*)&bytes[strLength], "read "); break;
-                case SysExRtMmcCommandUpdate:                   strLength += sprintf( (char*)&bytes[strLength], "update "); break;
-                case SysExRtMmcCommandLocate:                   strLength += sprintf( (char*)&bytes[strLength], "locate "); break;
-                case SysExRtMmcCommandAssignSystemMaster:       strLength += sprintf( (char*)&bytes[strLength], "assign-system-master "); break;
-                case SysExRtMmcCommandGeneratorCommand:         strLength += sprintf( (char*)&bytes[strLength], "generator-command "); break;
-                case SysExRtMmcCommandMtcCommand:               strLength += sprintf( (char*)&bytes[strLength], "mtc-command "); break;
-                case SysExRtMmcCommandMove:                     strLength += sprintf( (char*)&bytes[strLength], "move "); break;
-                case SysExRtMmcCommandAdd:                      strLength += sprintf( (char*)&bytes[strLength], "add "); break;
-                case SysExRtMmcCommandSubstract:                strLength += sprintf( (char*)&bytes[strLength], "substract "); break;
-                case SysExRtMmcCommandDropFrameAdjust:          strLength += sprintf( (char*)&bytes[strLength], "drop-frame-adjust "); break;
-                case SysExRtMmcCommandProcedure:                strLength += sprintf( (char*)&bytes[strLength], "procedure "); break;
-                case SysExRtMmcCommandEvent:                    strLength += sprintf( (char*)&bytes[strLength], "event "); break;
-                case SysExRtMmcCommandGroup:                    strLength += sprintf( (char*)&bytes[strLength], "group "); break;
-                case SysExRtMmcCommandCommandSegment:           strLength += sprintf( (char*)&bytes[strLength], "command-segment "); break;
+                case SysExRtMmcCommandStop:                     strLength += str_write( str_at( bytes, strLength ), "stop" ); break;
+                case SysExRtMmcCommandPlay:                     strLength += str_write( str_at( bytes, strLength ), "play" ); break;
+                case SysExRtMmcCommandDeferredPlay:             strLength += str_write( str_at( bytes, strLength ), "deferred-play" ); break;
+                case SysExRtMmcCommandFastForward:              strLength += str_write( str_at( bytes, strLength ), "fast-forward" ); break;
+                case SysExRtMmcCommandRewind:                   strLength += str_write( str_at( bytes, strLength ), "rewind" ); break;
+                case SysExRtMmcCommandRecordStrobe:             strLength += str_write( str_at( bytes, strLength ), "record-strobe" ); break;
+                case SysExRtMmcCommandRecordExit:               strLength += str_write( str_at( bytes, strLength ), "record-exit" ); break;
+                case SysExRtMmcCommandRecordPause:              strLength += str_write( str_at( bytes, strLength ), "record-pause" ); break;
+                case SysExRtMmcCommandPause:                    strLength += str_write( str_at( bytes, strLength ), "pause" ); break;
+                case SysExRtMmcCommandEject:                    strLength += str_write( str_at( bytes, strLength ), "eject" ); break;
+                case SysExRtMmcCommandChase:                    strLength += str_write( str_at( bytes, strLength ), "chase" ); break;
+                case SysExRtMmcCommandCommandErrorReset:        strLength += str_write( str_at( bytes, strLength ), "command-error-reset" ); break;
+                case SysExRtMmcCommandMmcReset:                 strLength += str_write( str_at( bytes, strLength ), "mmc-reset" ); break;
+                case SysExRtMmcCommandWait:                     strLength += str_write( str_at( bytes, strLength ), "wait" ); break;
+                case SysExRtMmcCommandResume:                   strLength += str_write( str_at( bytes, strLength ), "resume" ); break;
+
+                case SysExRtMmcCommandVariablePlay:             strLength += str_write( str_at( bytes, strLength ), "variable-play " ); break;
+                case SysExRtMmcCommandSearch:                   strLength += str_write( str_at( bytes, strLength ), "search " ); break;
+                case SysExRtMmcCommandShuttle:                  strLength += str_write( str_at( bytes, strLength ), "shuttle " ); break;
+                case SysExRtMmcCommandDeferredVariablePlay:     strLength += str_write( str_at( bytes, strLength ), "deferred-variable-play " ); break;
+                case SysExRtMmcCommandRecordStrobeVariable:     strLength += str_write( str_at( bytes, strLength ), "record-strobe-variable " ); break;
+
+                case SysExRtMmcCommandStep:                     strLength += str_write( str_at( bytes, strLength ), "step " ); break;
+
+                case SysExRtMmcCommandWrite:                    strLength += str_write( str_at( bytes, strLength ), "write " ); break;
+
+                case SysExRtMmcCommandMaskedWrite:              strLength += str_write( str_at( bytes, strLength ), "masked-write " ); break;
+                case SysExRtMmcCommandRead:                     strLength += str_write( str_at( bytes, strLength ), "read " ); break;
+                case SysExRtMmcCommandUpdate:                   strLength += str_write( str_at( bytes, strLength ), "update " ); break;
+                case SysExRtMmcCommandLocate:                   strLength += str_write( str_at( bytes, strLength ), "locate " ); break;
+                case SysExRtMmcCommandAssignSystemMaster:       strLength += str_write( str_at( bytes, strLength ), "assign-system-master " ); break;
+                case SysExRtMmcCommandGeneratorCommand:         strLength += str_write( str_at( bytes, strLength ), "generator-command " ); break;
+                case SysExRtMmcCommandMtcCommand:               strLength += str_write( str_at( bytes, strLength ), "mtc-command " ); break;
+                case SysExRtMmcCommandMove:                     strLength += str_write( str_at( bytes, strLength ), "move " ); break;
+                case SysExRtMmcCommandAdd:                      strLength += str_write( str_at( bytes, strLength ), "add " ); break;
+                case SysExRtMmcCommandSubstract:                strLength += str_write( str_at( bytes, strLength ), "substract " ); break;
+                case SysExRtMmcCommandDropFrameAdjust:          strLength += str_write( str_at( bytes, strLength ), "drop-frame-adjust " ); break;
+                case SysExRtMmcCommandProcedure:                strLength += str_write( str_at( bytes, strLength ), "procedure " ); break;
+                case SysExRtMmcCommandEvent:                    strLength += str_write( str_at( bytes, strLength ), "event " ); break;
+                case SysExRtMmcCommandGroup:                    strLength += str_write( str_at( bytes, strLength ), "group " ); break;
+                case SysExRtMmcCommandCommandSegment:           strLength += str_write( str_at( bytes, strLength ), "command-segment " ); break;
 
                 default:
                     return 0;
@@ -665,26 +874,31 @@ namespace MidiMessage {
 
                     speed = SysExRtMmcStandardSpeedToFloatObj( &cmd.Data.StandardSpeed );
 
-                    strLength += sprintf( (char*)&bytes[strLength], "%f", speed );
+                    {
+                        char str[64];
+                        int l = snprintf( str, sizeof(str), "%f", speed );
+                        strLength += writeBytes( str_at( bytes, strLength ), (uint8_t*)str, l );
+                    }
 
                     break;
 
                 case SysExRtMmcCommandStep:
-                    strLength += sprintf( (char*)&bytes[strLength], "%d", cmd.Data.S7 );
+                    strLength += writeDecimal( str_at( bytes, strLength ), cmd.Data.S7 );
                     break;
 
                 case SysExRtMmcCommandLocate:
                     if (cmd.Data.Locate.SubCommand == SysExRtMmcCommandLocateSubCommandInformationField)  {
-                        strLength += sprintf( (char*)&bytes[strLength], "field %d", cmd.Data.Locate.InformationField);
+                        strLength += str_write( str_at( bytes, strLength ), "field " );
+                        strLength += writeDecimal( str_at( bytes, strLength ), cmd.Data.Locate.InformationField );
                     } else if (cmd.Data.Locate.SubCommand == SysExRtMmcCommandLocateSubCommandTarget)  {
-                        strLength += sprintf( (char*)&bytes[strLength], "mtc ");
-                        strLength += sprintfMtcLong(&bytes[strLength], &cmd.Data.Locate.MidiTimeCode);
+                        strLength += str_write( str_at( bytes, strLength ), "mtc " );
+                        strLength += sprintfMtcLong(str_at( bytes, strLength ), &cmd.Data.Locate.MidiTimeCode);
                     }
 
                     break;
 
                 case SysExRtMmcCommandAssignSystemMaster:
-                    strLength += sprintf( (char*)&bytes[strLength], "%d", cmd.Data.U7);
+                    strLength += writeDecimal( str_at( bytes, strLength ), cmd.Data.U7 );
                     break;
 
                 case SysExRtMmcCommandWrite: ////////
@@ -794,43 +1008,19 @@ namespace MidiMessage {
             return StringifierResultNoInput;
         }
 
+        uint32_t command = str_hash( (char*)argv[0] );
+
         if (argc == 1){
-            if (str_eq(argv[0], "start")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageStart;
-            }
-            else if (str_eq(argv[0], "stop")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageStop;
-            }
-            else if (str_eq(argv[0], "continue")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageContinue;
-            }
-            else if (str_eq(argv[0], "active-sensing")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageActiveSensing;
-            }
-            else if (str_eq(argv[0], "reset")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageReset;
-            }
-            else if (str_eq(argv[0], "timing-clock")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageTimingClock;
-            }
-            else if (str_eq(argv[0], "tune-request")) {
-                msg->StatusClass = StatusClassSystemMessage;
-                msg->SystemMessage = SystemMessageTuneRequest;
-            }
-            else {
+            if ( ! readSystemMessage( &msg->SystemMessage, argv[0] ) ){
                 return StringifierResultInvalidValue;
             }
 
+            msg->StatusClass = StatusClassSystemMessage;
+
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "note")) {
+        else if (keyword_eq(command, argv[0], "note")) {
             if (argc != 5) {
                 return StringifierResultWrongArgCount;
             }
@@ -854,7 +1044,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "cc")) {
+        else if (keyword_eq(command, argv[0], "cc")) {
             if (argc != 4) {
                 return StringifierResultWrongArgCount;
             }
@@ -870,7 +1060,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "pc")) {
+        else if (keyword_eq(command, argv[0], "pc")) {
             if (argc != 3) {
                 return StringifierResultWrongArgCount;
             }
@@ -884,7 +1074,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "pressure")) {
+        else if (keyword_eq(command, argv[0], "pressure")) {
             if (argc != 3) {
                 return StringifierResultWrongArgCount;
             }
@@ -898,7 +1088,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "pitch")) {
+        else if (keyword_eq(command, argv[0], "pitch")) {
             if (argc != 3) {
                 return StringifierResultWrongArgCount;
             }
@@ -912,7 +1102,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "poly")) {
+        else if (keyword_eq(command, argv[0], "poly")) {
             if (argc != 4) {
                 return StringifierResultWrongArgCount;
             }
@@ -928,7 +1118,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
 
-        else if (str_eq(argv[0], "quarter-frame")) {
+        else if (keyword_eq(command, argv[0], "quarter-frame")) {
             if (argc != 3) {
                 return StringifierResultWrongArgCount;
             }
@@ -942,7 +1132,7 @@ namespace MidiMessage {
 
             return StringifierResultOk;
         }
-        else if (str_eq(argv[0], "song-position")) {
+        else if (keyword_eq(command, argv[0], "song-position")) {
             if (argc != 2) {
                 return StringifierResultWrongArgCount;
             }
@@ -954,7 +1144,7 @@ namespace MidiMessage {
 
             return StringifierResultOk;
         }
-        else if (str_eq(argv[0], "song-select")) {
+        else if (keyword_eq(command, argv[0], "song-select")) {
             if (argc != 2) {
                 return StringifierResultWrongArgCount;
             }
@@ -967,7 +1157,7 @@ namespace MidiMessage {
             return StringifierResultOk;
         }
         
-        else if (str_eq(argv[0], "sysex")) {
+        else if (keyword_eq(command, argv[0], "sysex")) {
             if (argc < 2) {
                 return StringifierResultWrongArgCount;
             }
@@ -975,8 +1165,12 @@ namespace MidiMessage {
             msg->StatusClass = StatusClassSystemMessage;
             msg->SystemMessage = SystemMessageSystemExclusive;
 
+            // (zero for messages without data)
+            msg->Data.SysEx.Length = 0;
+
+            uint32_t type = str_hash( (char*)argv[1] );
 
-            if (str_eq(argv[1], "experimental")) {
+            if (keyword_eq(type, argv[1], "experimental")) {
                 if (argc < 2 || argc > 3) {
                     return StringifierResultWrongArgCount;
                 }
@@ -995,7 +1189,7 @@ namespace MidiMessage {
 
                 return StringifierResultOk;
             }
-            else if (str_eq(argv[1], "manufacturer")) {
+            else if (keyword_eq(type, argv[1], "manufacturer")) {
                 if (argc < 3 || argc > 4) {
                     return StringifierResultWrongArgCount;
                 }
@@ -1014,14 +1208,16 @@ namespace MidiMessage {
 
                 return StringifierResultOk;
             }
-            else if (str_eq(argv[1], "rt")) {
+            else if (keyword_eq(type, argv[1], "rt")) {
                 if (argc < 4) {
                     return StringifierResultWrongArgCount;
                 }
                 msg->Channel = atoi((char*)argv[2]);
                 msg->Data.SysEx.Id = SysExIdRealTime;
 
-                if (str_eq(argv[3], "mtc")) {
+                uint32_t subId = str_hash( (char*)argv[3] );
+
+                if (keyword_eq(subId, argv[3], "mtc")) {
                     if (argc < 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -1053,7 +1249,7 @@ namespace MidiMessage {
                         return StringifierResultOk;
                     }
                 }
-                else if (str_eq(argv[3], "cueing")) {
+                else if (keyword_eq(subId, argv[3], "cueing")) {
                     if (argc < 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -1137,7 +1333,7 @@ namespace MidiMessage {
 
                     }
                 }
-                else if (str_eq(argv[3],"msc")){
+                else if (keyword_eq(subId, argv[3], "msc")){
                     if (argc < 6) {
                         return StringifierResultWrongArgCount;
                     }
@@ -1149,278 +1345,11 @@ namespace MidiMessage {
 
 
 
-                    if (str_eq(argv[4], "lighting")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtLighting;
-                    }
-                    else if (str_eq(argv[4], "moving-lights")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtMovingLights;
-                    }
-                    else if (str_eq(argv[4], "color-changers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtColorChangers;
-                    }
-                    else if (str_eq(argv[4], "strobes")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtStrobes;
-                    }
-                    else if (str_eq(argv[4], "lasers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtLasers;
-                    }
-                    else if (str_eq(argv[4], "chasers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtChasers;
-                    }
-                    else if (str_eq(argv[4], "sound")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtSound;
-                    }
-                    else if (str_eq(argv[4], "music")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtMusic;
-                    }
-                    else if (str_eq(argv[4], "cd-players")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtCdPlayers;
-                    }
-                    else if (str_eq(argv[4], "eprom-playback")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtEpromPlayback;
-                    }
-                    else if (str_eq(argv[4], "audio-tape-machines")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtAudioTapeMachines;
-                    }
-                    else if (str_eq(argv[4], "intercoms")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtIntercoms;
-                    }
-                    else if (str_eq(argv[4], "amplifiers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtAmplifiers;
-                    }
-                    else if (str_eq(argv[4], "audio-fx")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtAudioEffectsDevices;
-                    }
-                    else if (str_eq(argv[4], "equalizers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtEqualizers;
-                    }
-                    else if (str_eq(argv[4], "machinery")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtMachinery;
-                    }
-                    else if (str_eq(argv[4], "rigging")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtRigging;
-                    }
-                    else if (str_eq(argv[4], "flys")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFlys;
-                    }
-                    else if (str_eq(argv[4], "lifts")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtLifts;
-                    }
-                    else if (str_eq(argv[4], "turntables")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtTurntables;
-                    }
-                    else if (str_eq(argv[4], "trusses")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtTrusses;
-                    }
-                    else if (str_eq(argv[4], "robots")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtRobots;
-                    }
-                    else if (str_eq(argv[4], "animation")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtAnimation;
-                    }
-                    else if (str_eq(argv[4], "floats")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFloats;
-                    }
-                    else if (str_eq(argv[4], "breakaways")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtBreakaways;
-                    }
-                    else if (str_eq(argv[4], "barges")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtBarges;
-                    }
-                    else if (str_eq(argv[4], "video")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideo;
-                    }
-                    else if (str_eq(argv[4], "video-tape-machines")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoTapeMachines;
-                    }
-                    else if (str_eq(argv[4], "video-cassette-machines")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoCassetteMachines;
-                    }
-                    else if (str_eq(argv[4], "video-disc-players")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoDiscPlayers;
-                    }
-                    else if (str_eq(argv[4], "video-switchers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoSwitchers;
-                    }
-                    else if (str_eq(argv[4], "video-fx")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoEffects;
-                    }
-                    else if (str_eq(argv[4], "video-char-generators")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoCharacterGenerators;
-                    }
-                    else if (str_eq(argv[4], "video-still-stores")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoStillStores;
-                    }
-                    else if (str_eq(argv[4], "video-monitors")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoMonitors;
-                    }
-                    else if (str_eq(argv[4], "projection")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtProjection;
-                    }
-                    else if (str_eq(argv[4], "film-projects")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFilmProjectors;
-                    }
-                    else if (str_eq(argv[4], "slide-projectors")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtSlideProjectors;
-                    }
-                    else if (str_eq(argv[4], "video-projectors")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtVideoProjectors;
-                    }
-                    else if (str_eq(argv[4], "dissolvers")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtDissolvers;
-                    }
-                    else if (str_eq(argv[4], "shutter-controls")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtShutterControls;
-                    }
-                    else if (str_eq(argv[4], "process-control")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtProcessControl;
-                    }
-                    else if (str_eq(argv[4], "hydraulic-oil")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtHydraulicOil;
-                    }
-                    else if (str_eq(argv[4], "h2o")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtH2O;
-                    }
-                    else if (str_eq(argv[4], "co2")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtCO2;
-                    }
-                    else if (str_eq(argv[4], "compressed-air")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtCompressedAir;
-                    }
-                    else if (str_eq(argv[4], "natural-gas")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtNaturalGas;
-                    }
-                    else if (str_eq(argv[4], "fog")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFog;
-                    }
-                    else if (str_eq(argv[4], "smoke")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtSmoke;
-                    }
-                    else if (str_eq(argv[4], "cracked-haze")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtCrackedHaze;
-                    }
-                    else if (str_eq(argv[4], "pyro")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtPyro;
-                    }
-                    else if (str_eq(argv[4], "fireworks")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFireworks;
-                    }
-                    else if (str_eq(argv[4], "explosions")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtExplosions;
-                    }
-                    else if (str_eq(argv[4], "flame")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtFlame;
-                    }
-                    else if (str_eq(argv[4], "smoke-pots")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtSmokePots;
-                    }
-                    else if (str_eq(argv[4], "all")) {
-                        msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0] = SysExRtMscCmdFmtAllTypes;
-                    }
-                    else {
+                    if ( ! readMscCommandFormat( &msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0], argv[4] ) ){
                         return StringifierResultInvalidValue;
                     }
 
-                    if (str_eq(argv[5], "go")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdGo;
-                    }
-                    else if (str_eq(argv[5], "stop")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStop;
-                    }
-                    else if (str_eq(argv[5], "resume")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdResume;
-                    }
-                    else if (str_eq(argv[5], "load")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdLoad;
-                    }
-                    else if (str_eq(argv[5], "go-off")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdGoOff;
-                    }
-                    else if (str_eq(argv[5], "go-jam-lock")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdGo_JamLock;
-                    }
-                    else if (str_eq(argv[5], "timed-go")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdTimedGo;
-                    }
-                    else if (str_eq(argv[5], "set")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdSet;
-                    }
-                    else if (str_eq(argv[5], "fire")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdFire;
-                    }
-                    else if (str_eq(argv[5], "standby+")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStandbyPlus;
-                    }
-                    else if (str_eq(argv[5], "standby-")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStandbyMinus;
-                    }
-                    else if (str_eq(argv[5], "sequence+")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdSequencePlus;
-                    }
-                    else if (str_eq(argv[5], "sequence-")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdSequenceMinus;
-                    }
-                    else if (str_eq(argv[5], "start-clock")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStartClock;
-                    }
-                    else if (str_eq(argv[5], "stop-clock")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStopClock;
-                    }
-                    else if (str_eq(argv[5], "zero-clock")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdZeroClock;
-                    }
-                    else if (str_eq(argv[5], "mtc-chase-on")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdMtcChaseOn;
-                    }
-                    else if (str_eq(argv[5], "mtc-chase-off")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdMtcChaseOff;
-                    }
-                    else if (str_eq(argv[5], "open-cue-list")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdOpenCueList;
-                    }
-                    else if (str_eq(argv[5], "close-cue-list")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdCloseCueList;
-                    }
-                    else if (str_eq(argv[5], "open-cue-path")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdOpenCuePath;
-                    }
-                    else if (str_eq(argv[5], "close-cue-path")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdCloseCuePath;
-                    }
-                    else if (str_eq(argv[5], "set-clock")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdSetClock;
-                    }
-                    else if (str_eq(argv[5], "standby")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStandby;
-                    }
-                    else if (str_eq(argv[5], "go-2-pc")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdGo2Pc;
-                    }
-                    else if (str_eq(argv[5], "standing-by")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdStandingBy;
-                    }
-                    else if (str_eq(argv[5], "complete")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdComplete;
-                    }
-                    else if (str_eq(argv[5], "cancel")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdCancel;
-                    }
-                    else if (str_eq(argv[5], "cancelled")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdCancelled;
-                    }
-                    else if (str_eq(argv[5], "abort")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdAbort;
-                    }
-                    else if (str_eq(argv[5], "all-off")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdAllOff;
-                    }
-                    else if (str_eq(argv[5], "restore")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdRestore;
-                    }
-                    else if (str_eq(argv[5], "reset")) {
-                        msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0] = SysExRtMscCmdReset;
-                    }
-                    else {
+                    if ( ! readMscCommand( &msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0], argv[5] ) ){
                         return StringifierResultInvalidValue;
                     }
 
@@ -1620,7 +1549,7 @@ namespace MidiMessage {
                     }
 
                 }
-                else if (str_eq(argv[3], "dc")){
+                else if (keyword_eq(subId, argv[3], "dc")){
                     msg->Data.SysEx.SubId1 = SysExRtDeviceControl;
 
                     if (argc == 6){
@@ -1688,7 +1617,7 @@ namespace MidiMessage {
                         uint8_t * id = getIthGpcParameterIdAddr( &msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i );
                         uint8_t * value = getIthGpcParameterValueAddr( &msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i );
 
-                        uint8_t tmp;
+                        size_t tmp;
 
                         if (!readHex(id, &tmp, argv[ai++], pw)) {
                             return StringifierResultInvalidHex;
@@ -1702,7 +1631,7 @@ namespace MidiMessage {
                     return StringifierResultOk;
 
                 }
-                else if (str_eq(argv[3],"cds")) {
+                else if (keyword_eq(subId, argv[3], "cds")) {
                     if (argc < 7){
                         return StringifierResultWrongArgCount;
                     }
@@ -1745,7 +1674,7 @@ namespace MidiMessage {
                     return StringifierResultOk;
                 }
 
-                else if (str_eq(argv[3],"keys")) {
+                else if (keyword_eq(subId, argv[3], "keys")) {
                     if (argc < 6){
                         return StringifierResultWrongArgCount;
                     }
@@ -1773,7 +1702,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "mpc")){
+                else if (keyword_eq(subId, argv[3], "mpc")){
                     if (argc < 7){
                         return StringifierResultWrongArgCount;
                     }
@@ -1882,7 +1811,7 @@ namespace MidiMessage {
                     return StringifierResultOk;
 
                 }
-                else if (str_eq(argv[3],"mcc")) {
+                else if (keyword_eq(subId, argv[3], "mcc")) {
                     if (argc < 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -1895,7 +1824,7 @@ namespace MidiMessage {
                     return ArgsToMccData( msg->Data.SysEx.ByteData, &msg->Data.SysEx.Length, argc - 4, &argv[4] );
 
                 }
-                else if (str_eq(argv[3], "notation")){
+                else if (keyword_eq(subId, argv[3], "notation")){
                     if (argc < 5){
                         return StringifierResultWrongArgCount;
                     }
@@ -1967,7 +1896,7 @@ namespace MidiMessage {
                 }
 
             }
-            else if (str_eq(argv[1], "nonrt")) {
+            else if (keyword_eq(type, argv[1], "nonrt")) {
                 if (argc < 4) {
                     return StringifierResultWrongArgCount;
                 }
@@ -1975,8 +1904,10 @@ namespace MidiMessage {
                 msg->Channel = atoi((char*)argv[2]);
                 msg->Data.SysEx.Id = SysExIdNonRealTime;
 
+                uint32_t subId = str_hash( (char*)argv[3] );
+
                 if (argc == 5) {
-                    if (str_eq(argv[3], "eof")) {
+                    if (keyword_eq(subId, argv[3], "eof")) {
                         msg->Data.SysEx.SubId1 = SysExNonRtEndOfFile;
                         msg->Data.SysEx.Data.PacketNumber = atoi((char*)argv[4]);
 
@@ -1984,7 +1915,7 @@ namespace MidiMessage {
 
                         return StringifierResultOk;
                     }
-                    else if (str_eq(argv[3], "wait")) {
+                    else if (keyword_eq(subId, argv[3], "wait")) {
                         msg->Data.SysEx.SubId1 = SysExNonRtWait;
                         msg->Data.SysEx.Data.PacketNumber = atoi((char*)argv[4]);
 
@@ -1992,7 +1923,7 @@ namespace MidiMessage {
 
                         return StringifierResultOk;
                     }
-                    else if (str_eq(argv[3], "cancel")) {
+                    else if (keyword_eq(subId, argv[3], "cancel")) {
                         msg->Data.SysEx.SubId1 = SysExNonRtCancel;
                         msg->Data.SysEx.Data.PacketNumber = atoi((char*)argv[4]);
 
@@ -2000,7 +1931,7 @@ namespace MidiMessage {
 
                         return StringifierResultOk;
                     }
-                    else if (str_eq(argv[3], "nak")) {
+                    else if (keyword_eq(subId, argv[3], "nak")) {
                         msg->Data.SysEx.SubId1 = SysExNonRtNAK;
                         msg->Data.SysEx.Data.PacketNumber = atoi((char*)argv[4]);
 
@@ -2008,7 +1939,7 @@ namespace MidiMessage {
 
                         return StringifierResultOk;
                     }
-                    else if (str_eq(argv[3], "ack")) {
+                    else if (keyword_eq(subId, argv[3], "ack")) {
                         msg->Data.SysEx.SubId1 = SysExNonRtACK;
                         msg->Data.SysEx.Data.PacketNumber = atoi((char*)argv[4]);
 
@@ -2018,7 +1949,7 @@ namespace MidiMessage {
                     }
                 }
 
-                if (str_eq(argv[3], "info")) {
+                if (keyword_eq(subId, argv[3], "info")) {
                     if (argc < 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2027,7 +1958,7 @@ namespace MidiMessage {
                     if (str_eq(argv[4], "request")) {
                         msg->Data.SysEx.SubId2 = SysExNonRtGenInfoIdentityRequest;
 
-                    } else if (str_eq(argv[3], "reply")) {
+                    } else if (keyword_eq(subId, argv[3], "reply")) {
                         if (argc != 8) {
                             return StringifierResultWrongArgCount;
                         }
@@ -2051,7 +1982,7 @@ namespace MidiMessage {
                     return StringifierResultOk;
 
                 }
-                else if (str_eq(argv[3], "gm")) {
+                else if (keyword_eq(subId, argv[3], "gm")) {
                     if (argc != 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2071,7 +2002,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "cueing")) {
+                else if (keyword_eq(subId, argv[3], "cueing")) {
                     if (argc < 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2212,7 +2143,7 @@ namespace MidiMessage {
                         return StringifierResultOk;
                     }
                 }
-                else if (str_eq(argv[3], "sds-header")) {
+                else if (keyword_eq(subId, argv[3], "sds-header")) {
                     if (argc != 11) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2240,7 +2171,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "sds-request")) {
+                else if (keyword_eq(subId, argv[3], "sds-request")) {
                     if (argc != 5) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2252,7 +2183,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "sds-data")) {
+                else if (keyword_eq(subId, argv[3], "sds-data")) {
                     if (argc < 6 || 8 < argc) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2278,7 +2209,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "sds-ext")) {
+                else if (keyword_eq(subId, argv[3], "sds-ext")) {
                     if (argc < 6) {
                         return StringifierResultWrongArgCount;
                     }
@@ -2458,7 +2389,7 @@ namespace MidiMessage {
                         return StringifierResultInvalidValue;
                     }
                 }
-                else if (str_eq(argv[3], "mvc")){
+                else if (keyword_eq(subId, argv[3], "mvc")){
                     if (argc != 6){
                         return StringifierResultWrongArgCount;
                     }
@@ -2466,58 +2397,7 @@ namespace MidiMessage {
                     msg->Data.SysEx.SubId1 = SysExNonRtMidiVisualControl;
                     msg->Data.SysEx.SubId2 = SysExNonRtMvcVersion1;
 
-                    if (str_eq(argv[4], "on-off")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressMidiVisualControlOnOff;
-                    }
-                    else if (str_eq(argv[4], "clip-control-channel")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressClipControlRxChannel;
-                    }
-                    else if (str_eq(argv[4], "fx-control-channel")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControlRxChannel;
-                    }
-                    else if (str_eq(argv[4], "note-msg-enabled")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressNoteMessageEnabled;
-                    }
-                    else if (str_eq(argv[4], "playback-assign-msn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressPlaybackSpeedCtrlAssignMsn;
-                    }
-                    else if (str_eq(argv[4], "playback-assign-lsn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressPlaybackSpeedCtrlAssignLsn;
-                    }
-                    else if (str_eq(argv[4], "dissolve-assign-msn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressDissolveTimeCtrlAssignMsn;
-                    }
-                    else if (str_eq(argv[4], "dissolve-assign-lsn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressDissolveTimeCtrlAssignLsn;
-                    }
-                    else if (str_eq(argv[4], "fx1-assign-msn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl1AssignMsn;
-                    }
-                    else if (str_eq(argv[4], "fx1-assign-lsn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl1AssignLsn;
-                    }
-                    else if (str_eq(argv[4], "fx2-assign-msn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl2AssignMsn;
-                    }
-                    else if (str_eq(argv[4], "fx2-assign-lsn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl2AssignLsn;
-                    }
-                    else if (str_eq(argv[4], "fx3-assign-msn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl3AssignMsn;
-                    }
-                    else if (str_eq(argv[4], "fx3-assign-lsn")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressEffectControl3AssignLsn;
-                    }
-                    else if (str_eq(argv[4], "playback-speed-range")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressPlaybackSpeedCtrlRange;
-                    }
-                    else if (str_eq(argv[4], "keyboard-range-lower")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressKeyboardRangeLower;
-                    }
-                    else if (str_eq(argv[4], "keyboard-range-upper")) {
-                        msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = SysExNonRtMvcAddressKeyboardRangeUpper;
-                    }
-                    else {
+                    if ( ! readMvcParameterAddress( &msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress, argv[4] ) ){
                         msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress = strtol((char*)argv[5], NULL, 16);
                     }
 
@@ -2527,7 +2407,7 @@ namespace MidiMessage {
 
                     return StringifierResultOk;
                 }
-                else if (str_eq(argv[3], "file-dump")) {
+                else if (keyword_eq(subId, argv[3], "file-dump")) {
                     if (argc < 1){
                         return StringifierResultWrongArgCount;
                     }
@@ -2661,245 +2541,282 @@ namespace MidiMessage {
     }
 
 
-    int MessagetoString(uint8_t * bytes, Message_t * msg) {
+    // if bytes is NULL, only the length is computed
+    static int messageToString( StrDst_t bytes, Message_t * msg ){
 
         int length = 0;
 
         if (msg->StatusClass == StatusClassNoteOn){
-            length += sprintf( (char*)&bytes[length], "note on %d %d %d", msg->Channel, msg->Data.Note.Key, msg->Data.Note.Velocity);
+            length += str_write( str_at( bytes, length ), "note on " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.Note.Key );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.Note.Velocity );
         }
         if (msg->StatusClass == StatusClassNoteOff){
-            length += sprintf( (char*)&bytes[length], "note off %d %d %d", msg->Channel, msg->Data.Note.Key, msg->Data.Note.Velocity);
+            length += str_write( str_at( bytes, length ), "note off " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.Note.Key );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.Note.Velocity );
         }
         if (msg->StatusClass == StatusClassControlChange){
-            length += sprintf( (char*)&bytes[length], "cc %d %d %d", msg->Channel, msg->Data.ControlChange.Controller, msg->Data.ControlChange.Value);
+            length += str_write( str_at( bytes, length ), "cc " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.ControlChange.Controller );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.ControlChange.Value );
         }
         if (msg->StatusClass == StatusClassProgramChange){
-            length += sprintf( (char*)&bytes[length], "pc %d %d", msg->Channel, msg->Data.ProgramChange.Program);
+            length += str_write( str_at( bytes, length ), "pc " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.ProgramChange.Program );
         }
         if (msg->StatusClass == StatusClassChannelPressure){
-            length += sprintf( (char*)&bytes[length], "pressure %d %d", msg->Channel, msg->Data.ChannelPressure.Pressure);
+            length += str_write( str_at( bytes, length ), "pressure " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.ChannelPressure.Pressure );
         }
         if (msg->StatusClass == StatusClassPitchBendChange){
-            length += sprintf( (char*)&bytes[length], "pitch %d %d", msg->Channel, msg->Data.PitchBendChange.Pitch);
+            length += str_write( str_at( bytes, length ), "pitch " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.PitchBendChange.Pitch );
         }
         if (msg->StatusClass == StatusClassPolyphonicKeyPressure){
-            length += sprintf( (char*)&bytes[length], "poly %d %d %d", msg->Channel, msg->Data.PolyphonicKeyPressure.Key, msg->Data.PolyphonicKeyPressure.Pressure);
+            length += str_write( str_at( bytes, length ), "poly " );
+            length += writeDecimal( str_at( bytes, length ), msg->Channel );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.PolyphonicKeyPressure.Key );
+            length += str_write( str_at( bytes, length ), " " );
+            length += writeDecimal( str_at( bytes, length ), msg->Data.PolyphonicKeyPressure.Pressure );
         }
 
         if (msg->StatusClass == StatusClassSystemMessage){
 
             if (msg->SystemMessage == SystemMessageMtcQuarterFrame){
-                length += sprintf( (char*)&bytes[length], "quarter-frame %d %d", msg->Data.MtcQuarterFrame.MessageType, msg->Data.MtcQuarterFrame.Nibble);
+                length += str_write( str_at( bytes, length ), "quarter-frame " );
+                length += writeDecimal( str_at( bytes, length ), msg->Data.MtcQuarterFrame.MessageType );
+                length += str_write( str_at( bytes, length ), " " );
+                length += writeDecimal( str_at( bytes, length ), msg->Data.MtcQuarterFrame.Nibble );
             }
             if (msg->SystemMessage == SystemMessageSongPositionPointer){
-                length += sprintf( (char*)&bytes[length], "song-position %d", msg->Data.SongPositionPointer.Position);
+                length += str_write( str_at( bytes, length ), "song-position " );
+                length += writeDecimal( str_at( bytes, length ), msg->Data.SongPositionPointer.Position );
             }
             if (msg->SystemMessage == SystemMessageSongSelect){
-                length += sprintf( (char*)&bytes[length], "song-select %d", msg->Data.SongSelect.Song);
+                length += str_write( str_at( bytes, length ), "song-select " );
+                length += writeDecimal( str_at( bytes, length ), msg->Data.SongSelect.Song );
             }
             if (msg->SystemMessage == SystemMessageStart){
-                length += sprintf( (char*)&bytes[length], "start");
+                length += str_write( str_at( bytes, length ), "start" );
             }
             if (msg->SystemMessage == SystemMessageStop){
-                length += sprintf( (char*)&bytes[length], "stop");
+                length += str_write( str_at( bytes, length ), "stop" );
             }
             if (msg->SystemMessage == SystemMessageContinue){
-                length += sprintf( (char*)&bytes[length], "continue");
+                length += str_write( str_at( bytes, length ), "continue" );
             }
             if (msg->SystemMessage == SystemMessageActiveSensing){
-                length += sprintf( (char*)&bytes[length], "active-sensing");
+                length += str_write( str_at( bytes, length ), "active-sensing" );
             }
             if (msg->SystemMessage == SystemMessageReset){
-                length += sprintf( (char*)&bytes[length], "reset");
+                length += str_write( str_at( bytes, length ), "reset" );
             }
             if (msg->SystemMessage == SystemMessageTimingClock){
-                length += sprintf( (char*)&bytes[length], "timing-clock");
+                length += str_write( str_at( bytes, length ), "timing-clock" );
             }
             if (msg->SystemMessage == SystemMessageTuneRequest){
-                length += sprintf( (char*)&bytes[length], "tune-request");
+                length += str_write( str_at( bytes, length ), "tune-request" );
             }
             if (msg->SystemMessage == SystemMessageSystemExclusive){
-                length += sprintf( (char*)&bytes[length], "sysex ");
+                length += str_write( str_at( bytes, length ), "sysex " );
 
 //                printf("sysex ");
 
                 if (msg->Data.SysEx.Id == SysExIdExperimental){
-                    length += sprintf( (char*)&bytes[length], "experimental ");
+                    length += str_write( str_at( bytes, length ), "experimental " );
 
-                    length += sprintfHex( &bytes[length],  msg->Data.SysEx.ByteData,  msg->Data.SysEx.Length);
+                    length += sprintfHex( str_at( bytes, length ),  msg->Data.SysEx.ByteData,  msg->Data.SysEx.Length);
                 }
 
                 if (isSysExManufacturerId(msg->Data.SysEx.Id)){
-                    length += sprintf( (char*)&bytes[length], "manufacturer %06X ", msg->Data.SysEx.Id);
+                    length += str_write( str_at( bytes, length ), "manufacturer " );
+                    length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Id, 6 );
+                    length += str_write( str_at( bytes, length ), " " );
 
-                    length += sprintfHex( &bytes[length],  msg->Data.SysEx.ByteData,  msg->Data.SysEx.Length);
+                    length += sprintfHex( str_at( bytes, length ),  msg->Data.SysEx.ByteData,  msg->Data.SysEx.Length);
                 }
 
                 if (msg->Data.SysEx.Id == SysExIdRealTime){
-                    length += sprintf( (char*)&bytes[length], "rt %d ", msg->Channel);
+                    length += str_write( str_at( bytes, length ), "rt " );
+                    length += writeDecimal( str_at( bytes, length ), msg->Channel );
+                    length += str_write( str_at( bytes, length ), " " );
 
 //                    printf("rt %d ", msg->Channel);
 
                     if (msg->Data.SysEx.SubId1 == SysExRtMidiTimeCode){
-                        length += sprintf( (char*)&bytes[length], "mtc ");
+                        length += str_write( str_at( bytes, length ), "mtc " );
 
                         if (msg->Data.SysEx.SubId2 == SysExRtMtcFullMessage){
 
-                            length += sprintf( (char*)&bytes[length], "full-message ");
+                            length += str_write( str_at( bytes, length ), "full-message " );
 
-                            length += sprintfMtc( &bytes[length], &msg->Data.SysEx.Data.MidiTimeCode );
+                            length += sprintfMtc( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiTimeCode );
 
                         } else if (msg->Data.SysEx.SubId2 == SysExRtMtcUserBits){
-                            length += sprintf( (char*)&bytes[length], "user-bits %02X%02X%02X%02X%02X",
-                                   msg->Data.SysEx.ByteData[0],
-                                   msg->Data.SysEx.ByteData[1],
-                                   msg->Data.SysEx.ByteData[2],
-                                   msg->Data.SysEx.ByteData[3],
-                                   msg->Data.SysEx.ByteData[4]
-                            );
+                            length += str_write( str_at( bytes, length ), "user-bits " );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.ByteData[0], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.ByteData[1], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.ByteData[2], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.ByteData[3], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.ByteData[4], 2 );
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtMidiTimeCodeCueing){
-                        length += sprintf( (char*)&bytes[length], "cueing ");
+                        length += str_write( str_at( bytes, length ), "cueing " );
                         if (msg->Data.SysEx.SubId2 == SysExRtMtcCueingSpecial){
-                            length += sprintf( (char*)&bytes[length], "special ");
+                            length += str_write( str_at( bytes, length ), "special " );
                             if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExRtMtcCueingSpecialSystemStop){
-                                length += sprintf( (char*)&bytes[length], "system-stop");
+                                length += str_write( str_at( bytes, length ), "system-stop" );
                             }
                             else {
-                                length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.Data.Cueing.EventNumber);
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.EventNumber );
                             }
                         }
                         else {
 
                             switch (msg->Data.SysEx.SubId2){
-                                case SysExRtMtcCueingPunchInPoint:                 length += sprintf( (char*)&bytes[length], "punch-in "); break;
-                                case SysExRtMtcCueingPunchOutPoint:                length += sprintf( (char*)&bytes[length], "punch-out "); break;
+                                case SysExRtMtcCueingPunchInPoint:                 length += str_write( str_at( bytes, length ), "punch-in " ); break;
+                                case SysExRtMtcCueingPunchOutPoint:                length += str_write( str_at( bytes, length ), "punch-out " ); break;
                                 case SysExRtMtcCueingEventStartPoint:
-                                case SysExRtMtcCueingEventStartPointWithInfo:     length += sprintf( (char*)&bytes[length], "event-start "); break;
+                                case SysExRtMtcCueingEventStartPointWithInfo:     length += str_write( str_at( bytes, length ), "event-start " ); break;
                                 case SysExRtMtcCueingEventStopPoint:
-                                case SysExRtMtcCueingEventStopPointWithInfo:      length += sprintf( (char*)&bytes[length], "event-stop "); break;
+                                case SysExRtMtcCueingEventStopPointWithInfo:      length += str_write( str_at( bytes, length ), "event-stop " ); break;
                                 case SysExRtMtcCueingCuePoint:
-                                case SysExRtMtcCueingCuePointWithInfo:            length += sprintf( (char*)&bytes[length], "cue-point "); break;
-                                case SysExRtMtcCueingEventName:                    length += sprintf( (char*)&bytes[length], "event-name "); break;
+                                case SysExRtMtcCueingCuePointWithInfo:            length += str_write( str_at( bytes, length ), "cue-point " ); break;
+                                case SysExRtMtcCueingEventName:                    length += str_write( str_at( bytes, length ), "event-name " ); break;
                                 default:
                                     return 0;
                             }
 
-                            length += sprintf( (char*)&bytes[length], "%d",msg->Data.SysEx.Data.Cueing.EventNumber);
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.EventNumber );
 
                             if (msg->Data.SysEx.Length > 0){
-                                length += sprintf( (char*)&bytes[length], " %s", msg->Data.SysEx.ByteData);
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeString( str_at( bytes, length ), (char*)msg->Data.SysEx.ByteData );
                             }
 
-                            length += sprintf( (char*)&bytes[length], "");
-
-//                        length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.SubId2);
+//                        length += sprintf( (char*)str_at( bytes, length ), "%d", msg->Data.SysEx.SubId2);
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtMidiShowControl){
-                        length += sprintf( (char*)&bytes[length], "msc ");
+                        length += str_write( str_at( bytes, length ), "msc " );
 
 
 
                         switch(msg->Data.SysEx.Data.MidiShowControl.CommandFormat.Bytes[0]) {
 
-                            case SysExRtMscCmdFmtLighting:                  length += sprintf((char *) &bytes[length], "lighting "); break;
-                            case SysExRtMscCmdFmtMovingLights:              length += sprintf((char *) &bytes[length], "moving-lights "); break;
-                            case SysExRtMscCmdFmtColorChangers:             length += sprintf((char *) &bytes[length], "color-changers "); break;
-                            case SysExRtMscCmdFmtStrobes:                   length += sprintf((char *) &bytes[length], "strobes "); break;
-                            case SysExRtMscCmdFmtLasers:                    length += sprintf((char *) &bytes[length], "lasers "); break;
-                            case SysExRtMscCmdFmtChasers:                   length += sprintf((char *) &bytes[length], "chasers "); break;
-                            case SysExRtMscCmdFmtSound:                     length += sprintf((char *) &bytes[length], "sound "); break;
-                            case SysExRtMscCmdFmtMusic:                     length += sprintf((char *) &bytes[length], "music "); break;
-                            case SysExRtMscCmdFmtCdPlayers:                 length += sprintf((char *) &bytes[length], "cd-players "); break;
-                            case SysExRtMscCmdFmtEpromPlayback:             length += sprintf((char *) &bytes[length], "eprom-playback "); break;
-                            case SysExRtMscCmdFmtAudioTapeMachines:         length += sprintf((char *) &bytes[length], "audio-tape-machines "); break;
-                            case SysExRtMscCmdFmtIntercoms:                 length += sprintf((char *) &bytes[length], "intercoms "); break;
-                            case SysExRtMscCmdFmtAmplifiers:                length += sprintf((char *) &bytes[length], "amplifiers "); break;
-                            case SysExRtMscCmdFmtAudioEffectsDevices:       length += sprintf((char *) &bytes[length], "audio-fx "); break;
-                            case SysExRtMscCmdFmtEqualizers:                length += sprintf((char *) &bytes[length], "equalizers "); break;
-                            case SysExRtMscCmdFmtMachinery:                 length += sprintf((char *) &bytes[length], "machinery "); break;
-                            case SysExRtMscCmdFmtRigging:                   length += sprintf((char *) &bytes[length], "rigging "); break;
-                            case SysExRtMscCmdFmtFlys:                      length += sprintf((char *) &bytes[length], "flys "); break;
-                            case SysExRtMscCmdFmtLifts:                     length += sprintf((char *) &bytes[length], "lifts "); break;
-                            case SysExRtMscCmdFmtTurntables:                length += sprintf((char *) &bytes[length], "turntables "); break;
-                            case SysExRtMscCmdFmtTrusses:                   length += sprintf((char *) &bytes[length], "trusses "); break;
-                            case SysExRtMscCmdFmtRobots:                    length += sprintf((char *) &bytes[length], "robots "); break;
-                            case SysExRtMscCmdFmtAnimation:                 length += sprintf((char *) &bytes[length], "animation "); break;
-                            case SysExRtMscCmdFmtFloats:                    length += sprintf((char *) &bytes[length], "floats "); break;
-                            case SysExRtMscCmdFmtBreakaways:                length += sprintf((char *) &bytes[length], "breakaways "); break;
-                            case SysExRtMscCmdFmtBarges:                    length += sprintf((char *) &bytes[length], "barges "); break;
-                            case SysExRtMscCmdFmtVideo:                     length += sprintf((char *) &bytes[length], "video "); break;
-                            case SysExRtMscCmdFmtVideoTapeMachines:         length += sprintf((char *) &bytes[length], "video-tape-machines "); break;
-                            case SysExRtMscCmdFmtVideoCassetteMachines:     length += sprintf((char *) &bytes[length], "video-cassette-machines "); break;
-                            case SysExRtMscCmdFmtVideoDiscPlayers:          length += sprintf((char *) &bytes[length], "video-disc-players "); break;
-                            case SysExRtMscCmdFmtVideoSwitchers:            length += sprintf((char *) &bytes[length], "video-switchers "); break;
-                            case SysExRtMscCmdFmtVideoEffects:              length += sprintf((char *) &bytes[length], "video-fx "); break;
-                            case SysExRtMscCmdFmtVideoCharacterGenerators:  length += sprintf((char *) &bytes[length], "video-char-generators "); break;
-                            case SysExRtMscCmdFmtVideoStillStores:          length += sprintf((char *) &bytes[length], "video-still-stores "); break;
-                            case SysExRtMscCmdFmtVideoMonitors:             length += sprintf((char *) &bytes[length], "video-monitors "); break;
-                            case SysExRtMscCmdFmtProjection:                length += sprintf((char *) &bytes[length], "projection "); break;
-                            case SysExRtMscCmdFmtFilmProjectors:            length += sprintf((char *) &bytes[length], "film-projects "); break;
-                            case SysExRtMscCmdFmtSlideProjectors:           length += sprintf((char *) &bytes[length], "slide-projectors "); break;
-                            case SysExRtMscCmdFmtVideoProjectors:           length += sprintf((char *) &bytes[length], "video-projectors "); break;
-                            case SysExRtMscCmdFmtDissolvers:                length += sprintf((char *) &bytes[length], "dissolvers "); break;
-                            case SysExRtMscCmdFmtShutterControls:           length += sprintf((char *) &bytes[length], "shutter-controls "); break;
-                            case SysExRtMscCmdFmtProcessControl:            length += sprintf((char *) &bytes[length], "process-control "); break;
-                            case SysExRtMscCmdFmtHydraulicOil:              length += sprintf((char *) &bytes[length], "hydraulic-oil "); break;
-                            case SysExRtMscCmdFmtH2O:                       length += sprintf((char *) &bytes[length], "h2o "); break;
-                            case SysExRtMscCmdFmtCO2:                       length += sprintf((char *) &bytes[length], "co2 "); break;
-                            case SysExRtMscCmdFmtCompressedAir:             length += sprintf((char *) &bytes[length], "compressed-air "); break;
-                            case SysExRtMscCmdFmtNaturalGas:                length += sprintf((char *) &bytes[length], "natural-gas "); break;
-                            case SysExRtMscCmdFmtFog:                       length += sprintf((char *) &bytes[length], "fog "); break;
-                            case SysExRtMscCmdFmtSmoke:                     length += sprintf((char *) &bytes[length], "smoke "); break;
-                            case SysExRtMscCmdFmtCrackedHaze:               length += sprintf((char *) &bytes[length], "cracked-haze "); break;
-                            case SysExRtMscCmdFmtPyro:                      length += sprintf((char *) &bytes[length], "pyro "); break;
-                            case SysExRtMscCmdFmtFireworks:                 length += sprintf((char *) &bytes[length], "fireworks "); break;
-                            case SysExRtMscCmdFmtExplosions:                length += sprintf((char *) &bytes[length], "explosions "); break;
-                            case SysExRtMscCmdFmtFlame:                     length += sprintf((char *) &bytes[length], "flame "); break;
-                            case SysExRtMscCmdFmtSmokePots:                 length += sprintf((char *) &bytes[length], "smoke-pots "); break;
-                            case SysExRtMscCmdFmtAllTypes:                  length += sprintf((char *) &bytes[length], "all "); break;
+                            case SysExRtMscCmdFmtLighting:                  length += str_write( str_at( bytes, length ), "lighting " ); break;
+                            case SysExRtMscCmdFmtMovingLights:              length += str_write( str_at( bytes, length ), "moving-lights " ); break;
+                            case SysExRtMscCmdFmtColorChangers:             length += str_write( str_at( bytes, length ), "color-changers " ); break;
+                            case SysExRtMscCmdFmtStrobes:                   length += str_write( str_at( bytes, length ), "strobes " ); break;
+                            case SysExRtMscCmdFmtLasers:                    length += str_write( str_at( bytes, length ), "lasers " ); break;
+                            case SysExRtMscCmdFmtChasers:                   length += str_write( str_at( bytes, length ), "chasers " ); break;
+                            case SysExRtMscCmdFmtSound:                     length += str_write( str_at( bytes, length ), "sound " ); break;
+                            case SysExRtMscCmdFmtMusic:                     length += str_write( str_at( bytes, length ), "music " ); break;
+                            case SysExRtMscCmdFmtCdPlayers:                 length += str_write( str_at( bytes, length ), "cd-players " ); break;
+                            case SysExRtMscCmdFmtEpromPlayback:             length += str_write( str_at( bytes, length ), "eprom-playback " ); break;
+                            case SysExRtMscCmdFmtAudioTapeMachines:         length += str_write( str_at( bytes, length ), "audio-tape-machines " ); break;
+                            case SysExRtMscCmdFmtIntercoms:                 length += str_write( str_at( bytes, length ), "intercoms " ); break;
+                            case SysExRtMscCmdFmtAmplifiers:                length += str_write( str_at( bytes, length ), "amplifiers " ); break;
+                            case SysExRtMscCmdFmtAudioEffectsDevices:       length += str_write( str_at( bytes, length ), "audio-fx " ); break;
+                            case SysExRtMscCmdFmtEqualizers:                length += str_write( str_at( bytes, length ), "equalizers " ); break;
+                            case SysExRtMscCmdFmtMachinery:                 length += str_write( str_at( bytes, length ), "machinery " ); break;
+                            case SysExRtMscCmdFmtRigging:                   length += str_write( str_at( bytes, length ), "rigging " ); break;
+                            case SysExRtMscCmdFmtFlys:                      length += str_write( str_at( bytes, length ), "flys " ); break;
+                            case SysExRtMscCmdFmtLifts:                     length += str_write( str_at( bytes, length ), "lifts " ); break;
+                            case SysExRtMscCmdFmtTurntables:                length += str_write( str_at( bytes, length ), "turntables " ); break;
+                            case SysExRtMscCmdFmtTrusses:                   length += str_write( str_at( bytes, length ), "trusses " ); break;
+                            case SysExRtMscCmdFmtRobots:                    length += str_write( str_at( bytes, length ), "robots " ); break;
+                            case SysExRtMscCmdFmtAnimation:                 length += str_write( str_at( bytes, length ), "animation " ); break;
+                            case SysExRtMscCmdFmtFloats:                    length += str_write( str_at( bytes, length ), "floats " ); break;
+                            case SysExRtMscCmdFmtBreakaways:                length += str_write( str_at( bytes, length ), "breakaways " ); break;
+                            case SysExRtMscCmdFmtBarges:                    length += str_write( str_at( bytes, length ), "barges " ); break;
+                            case SysExRtMscCmdFmtVideo:                     length += str_write( str_at( bytes, length ), "video " ); break;
+                            case SysExRtMscCmdFmtVideoTapeMachines:         length += str_write( str_at( bytes, length ), "video-tape-machines " ); break;
+                            case SysExRtMscCmdFmtVideoCassetteMachines:     length += str_write( str_at( bytes, length ), "video-cassette-machines " ); break;
+                            case SysExRtMscCmdFmtVideoDiscPlayers:          length += str_write( str_at( bytes, length ), "video-disc-players " ); break;
+                            case SysExRtMscCmdFmtVideoSwitchers:            length += str_write( str_at( bytes, length ), "video-switchers " ); break;
+                            case SysExRtMscCmdFmtVideoEffects:              length += str_write( str_at( bytes, length ), "video-fx " ); break;
+                            case SysExRtMscCmdFmtVideoCharacterGenerators:  length += str_write( str_at( bytes, length ), "video-char-generators " ); break;
+                            case SysExRtMscCmdFmtVideoStillStores:          length += str_write( str_at( bytes, length ), "video-still-stores " ); break;
+                            case SysExRtMscCmdFmtVideoMonitors:             length += str_write( str_at( bytes, length ), "video-monitors " ); break;
+                            case SysExRtMscCmdFmtProjection:                length += str_write( str_at( bytes, length ), "projection " ); break;
+                            case SysExRtMscCmdFmtFilmProjectors:            length += str_write( str_at( bytes, length ), "film-projects " ); break;
+                            case SysExRtMscCmdFmtSlideProjectors:           length += str_write( str_at( bytes, length ), "slide-projectors " ); break;
+                            case SysExRtMscCmdFmtVideoProjectors:           length += str_write( str_at( bytes, length ), "video-projectors " ); break;
+                            case SysExRtMscCmdFmtDissolvers:                length += str_write( str_at( bytes, length ), "dissolvers " ); break;
+                            case SysExRtMscCmdFmtShutterControls:           length += str_write( str_at( bytes, length ), "shutter-controls " ); break;
+                            case SysExRtMscCmdFmtProcessControl:            length += str_write( str_at( bytes, length ), "process-control " ); break;
+                            case SysExRtMscCmdFmtHydraulicOil:              length += str_write( str_at( bytes, length ), "hydraulic-oil " ); break;
+                            case SysExRtMscCmdFmtH2O:                       length += str_write( str_at( bytes, length ), "h2o " ); break;
+                            case SysExRtMscCmdFmtCO2:                       length += str_write( str_at( bytes, length ), "co2 " ); break;
+                            case SysExRtMscCmdFmtCompressedAir:             length += str_write( str_at( bytes, length ), "compressed-air " ); break;
+                            case SysExRtMscCmdFmtNaturalGas:                length += str_write( str_at( bytes, length ), "natural-gas " ); break;
+                            case SysExRtMscCmdFmtFog:                       length += str_write( str_at( bytes, length ), "fog " ); break;
+                            case SysExRtMscCmdFmtSmoke:                     length += str_write( str_at( bytes, length ), "smoke " ); break;
+                            case SysExRtMscCmdFmtCrackedHaze:               length += str_write( str_at( bytes, length ), "cracked-haze " ); break;
+                            case SysExRtMscCmdFmtPyro:                      length += str_write( str_at( bytes, length ), "pyro " ); break;
+                            case SysExRtMscCmdFmtFireworks:                 length += str_write( str_at( bytes, length ), "fireworks " ); break;
+                            case SysExRtMscCmdFmtExplosions:                length += str_write( str_at( bytes, length ), "explosions " ); break;
+                            case SysExRtMscCmdFmtFlame:                     length += str_write( str_at( bytes, length ), "flame " ); break;
+                            case SysExRtMscCmdFmtSmokePots:                 length += str_write( str_at( bytes, length ), "smoke-pots " ); break;
+                            case SysExRtMscCmdFmtAllTypes:                  length += str_write( str_at( bytes, length ), "all " ); break;
                         }
 
 
 
                         switch(msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0]){
 
-                            case SysExRtMscCmdGo:               length += sprintf( (char*)&bytes[length], "go "); break;
-                            case SysExRtMscCmdStop:             length += sprintf( (char*)&bytes[length], "stop "); break;
-                            case SysExRtMscCmdResume:           length += sprintf( (char*)&bytes[length], "resume "); break;
-                            case SysExRtMscCmdLoad:             length += sprintf( (char*)&bytes[length], "load "); break;
-                            case SysExRtMscCmdGoOff:            length += sprintf( (char*)&bytes[length], "go-off "); break;
-                            case SysExRtMscCmdGo_JamLock:       length += sprintf( (char*)&bytes[length], "go-jam-lock "); break;
-                            case SysExRtMscCmdTimedGo:          length += sprintf( (char*)&bytes[length], "timed-go "); break;
-                            case SysExRtMscCmdSet:              length += sprintf( (char*)&bytes[length], "set "); break;
-                            case SysExRtMscCmdFire:             length += sprintf( (char*)&bytes[length], "fire "); break;
-                            case SysExRtMscCmdStandbyPlus:      length += sprintf( (char*)&bytes[length], "standby+ "); break;
-                            case SysExRtMscCmdStandbyMinus:     length += sprintf( (char*)&bytes[length], "standby- "); break;
-                            case SysExRtMscCmdSequencePlus:     length += sprintf( (char*)&bytes[length], "sequence+ "); break;
-                            case SysExRtMscCmdSequenceMinus:    length += sprintf( (char*)&bytes[length], "sequence- "); break;
-                            case SysExRtMscCmdStartClock:       length += sprintf( (char*)&bytes[length], "start-clock "); break;
-                            case SysExRtMscCmdStopClock:        length += sprintf( (char*)&bytes[length], "stop-clock "); break;
-                            case SysExRtMscCmdZeroClock:        length += sprintf( (char*)&bytes[length], "zero-clock "); break;
-                            case SysExRtMscCmdMtcChaseOn:       length += sprintf( (char*)&bytes[length], "mtc-chase-on "); break;
-                            case SysExRtMscCmdMtcChaseOff:      length += sprintf( (char*)&bytes[length], "mtc-chase-off "); break;
-                            case SysExRtMscCmdOpenCueList:      length += sprintf( (char*)&bytes[length], "open-cue-list "); break;
-                            case SysExRtMscCmdCloseCueList:     length += sprintf( (char*)&bytes[length], "close-cue-list "); break;
-                            case SysExRtMscCmdOpenCuePath:      length += sprintf( (char*)&bytes[length], "open-cue-path "); break;
-                            case SysExRtMscCmdCloseCuePath:     length += sprintf( (char*)&bytes[length], "close-cue-path "); break;
-                            case SysExRtMscCmdSetClock:         length += sprintf( (char*)&bytes[length], "set-clock "); break;
-                            case SysExRtMscCmdStandby:          length += sprintf( (char*)&bytes[length], "standby "); break;
-                            case SysExRtMscCmdGo2Pc:            length += sprintf( (char*)&bytes[length], "go-2-pc "); break;
-                            case SysExRtMscCmdStandingBy:       length += sprintf( (char*)&bytes[length], "standing-by "); break;
-                            case SysExRtMscCmdComplete:         length += sprintf( (char*)&bytes[length], "complete "); break;
-                            case SysExRtMscCmdCancel:           length += sprintf( (char*)&bytes[length], "cancel "); break;
-                            case SysExRtMscCmdCancelled:        length += sprintf( (char*)&bytes[length], "cancelled "); break;
-                            case SysExRtMscCmdAbort:            length += sprintf( (char*)&bytes[length], "abort "); break;
-                            case SysExRtMscCmdAllOff:           length += sprintf( (char*)&bytes[length], "all-off"); break;
-                            case SysExRtMscCmdRestore:          length += sprintf( (char*)&bytes[length], "restore"); break;
-                            case SysExRtMscCmdReset:            length += sprintf( (char*)&bytes[length], "reset"); break;
+                            case SysExRtMscCmdGo:               length += str_write( str_at( bytes, length ), "go " ); break;
+                            case SysExRtMscCmdStop:             length += str_write( str_at( bytes, length ), "stop " ); break;
+                            case SysExRtMscCmdResume:           length += str_write( str_at( bytes, length ), "resume " ); break;
+                            case SysExRtMscCmdLoad:             length += str_write( str_at( bytes, length ), "load " ); break;
+                            case SysExRtMscCmdGoOff:            length += str_write( str_at( bytes, length ), "go-off " ); break;
+                            case SysExRtMscCmdGo_JamLock:       length += str_write( str_at( bytes, length ), "go-jam-lock " ); break;
+                            case SysExRtMscCmdTimedGo:          length += str_write( str_at( bytes, length ), "timed-go " ); break;
+                            case SysExRtMscCmdSet:              length += str_write( str_at( bytes, length ), "set " ); break;
+                            case SysExRtMscCmdFire:             length += str_write( str_at( bytes, length ), "fire " ); break;
+                            case SysExRtMscCmdStandbyPlus:      length += str_write( str_at( bytes, length ), "standby+ " ); break;
+                            case SysExRtMscCmdStandbyMinus:     length += str_write( str_at( bytes, length ), "standby- " ); break;
+                            case SysExRtMscCmdSequencePlus:     length += str_write( str_at( bytes, length ), "sequence+ " ); break;
+                            case SysExRtMscCmdSequenceMinus:    length += str_write( str_at( bytes, length ), "sequence- " ); break;
+                            case SysExRtMscCmdStartClock:       length += str_write( str_at( bytes, length ), "start-clock " ); break;
+                            case SysExRtMscCmdStopClock:        length += str_write( str_at( bytes, length ), "stop-clock " ); break;
+                            case SysExRtMscCmdZeroClock:        length += str_write( str_at( bytes, length ), "zero-clock " ); break;
+                            case SysExRtMscCmdMtcChaseOn:       length += str_write( str_at( bytes, length ), "mtc-chase-on " ); break;
+                            case SysExRtMscCmdMtcChaseOff:      length += str_write( str_at( bytes, length ), "mtc-chase-off " ); break;
+                            case SysExRtMscCmdOpenCueList:      length += str_write( str_at( bytes, length ), "open-cue-list " ); break;
+                            case SysExRtMscCmdCloseCueList:     length += str_write( str_at( bytes, length ), "close-cue-list " ); break;
+                            case SysExRtMscCmdOpenCuePath:      length += str_write( str_at( bytes, length ), "open-cue-path " ); break;
+                            case SysExRtMscCmdCloseCuePath:     length += str_write( str_at( bytes, length ), "close-cue-path " ); break;
+                            case SysExRtMscCmdSetClock:         length += str_write( str_at( bytes, length ), "set-clock " ); break;
+                            case SysExRtMscCmdStandby:          length += str_write( str_at( bytes, length ), "standby " ); break;
+                            case SysExRtMscCmdGo2Pc:            length += str_write( str_at( bytes, length ), "go-2-pc " ); break;
+                            case SysExRtMscCmdStandingBy:       length += str_write( str_at( bytes, length ), "standing-by " ); break;
+                            case SysExRtMscCmdComplete:         length += str_write( str_at( bytes, length ), "complete " ); break;
+                            case SysExRtMscCmdCancel:           length += str_write( str_at( bytes, length ), "cancel " ); break;
+                            case SysExRtMscCmdCancelled:        length += str_write( str_at( bytes, length ), "cancelled " ); break;
+                            case SysExRtMscCmdAbort:            length += str_write( str_at( bytes, length ), "abort " ); break;
+                            case SysExRtMscCmdAllOff:           length += str_write( str_at( bytes, length ), "all-off" ); break;
+                            case SysExRtMscCmdRestore:          length += str_write( str_at( bytes, length ), "restore" ); break;
+                            case SysExRtMscCmdReset:            length += str_write( str_at( bytes, length ), "reset" ); break;
                         }
 
                         switch(msg->Data.SysEx.Data.MidiShowControl.Command.Bytes[0]){
@@ -2911,22 +2828,25 @@ namespace MidiMessage {
 
                             case SysExRtMscCmdGoOff:
                             case SysExRtMscCmdGo_JamLock:
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
                             case SysExRtMscCmdTimedGo:
-                                length += sprintfMtcLong( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
-                                length += sprintf( (char*)&bytes[length], " " );
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += sprintfMtcLong( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
                             case SysExRtMscCmdSet:
-                                length += sprintf( (char*)&bytes[length], "%d %d ", msg->Data.SysEx.Data.MidiShowControl.Controller, msg->Data.SysEx.Data.MidiShowControl.Value);
-                                length += sprintfMtcLong(&bytes[length], &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Controller );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Value );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfMtcLong(str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
                                 break;
 
                             case SysExRtMscCmdFire:
-                                length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.Data.MidiShowControl.MacroNumber);
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.MacroNumber );
                                 break;
 
                             case SysExRtMscCmdStandbyPlus:
@@ -2940,49 +2860,62 @@ namespace MidiMessage {
                             case SysExRtMscCmdMtcChaseOff:
                             case SysExRtMscCmdOpenCueList:
                             case SysExRtMscCmdCloseCueList:
-                                length += sprintf( (char*)&bytes[length], "%s", msg->Data.SysEx.Data.MidiShowControl.CueNumber.List);
+                                length += writeString( str_at( bytes, length ), (char*)msg->Data.SysEx.Data.MidiShowControl.CueNumber.List );
                                 break;
 
                             case SysExRtMscCmdOpenCuePath:
                             case SysExRtMscCmdCloseCuePath:
-                                length += sprintf( (char*)&bytes[length], "%s", msg->Data.SysEx.Data.MidiShowControl.CueNumber.Path);
+                                length += writeString( str_at( bytes, length ), (char*)msg->Data.SysEx.Data.MidiShowControl.CueNumber.Path );
                                 break;
 
                             case SysExRtMscCmdSetClock:
-                                length += sprintfMtcLong( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
-                                length += sprintf( (char*)&bytes[length], " %s", msg->Data.SysEx.Data.MidiShowControl.CueNumber.List);
+                                length += sprintfMtcLong( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeString( str_at( bytes, length ), (char*)msg->Data.SysEx.Data.MidiShowControl.CueNumber.List );
                                 break;
 
                             case SysExRtMscCmdStandby:
                             case SysExRtMscCmdGo2Pc:
-                                length += sprintf( (char*)&bytes[length], "%d %d %02X%02X%02X%02X ",
-                                                         msg->Data.SysEx.Data.MidiShowControl.Checksum,
-                                                         msg->Data.SysEx.Data.MidiShowControl.SequenceNumber,
-                                                         msg->Data.SysEx.Data.MidiShowControl.Data[0],
-                                                         msg->Data.SysEx.Data.MidiShowControl.Data[1],
-                                                         msg->Data.SysEx.Data.MidiShowControl.Data[2],
-                                                         msg->Data.SysEx.Data.MidiShowControl.Data[3]
-                                );
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Checksum );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.SequenceNumber );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Data[0], 2 );
+                                length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Data[1], 2 );
+                                length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Data[2], 2 );
+                                length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Data[3], 2 );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
                             case SysExRtMscCmdStandingBy:
-                                length += sprintf( (char*)&bytes[length], "%d %d ", msg->Data.SysEx.Data.MidiShowControl.Checksum, msg->Data.SysEx.Data.MidiShowControl.SequenceNumber);
-                                length += sprintfMtcLong( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
-                                length += sprintf( (char*)&bytes[length], " " );
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Checksum );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.SequenceNumber );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfMtcLong( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.MidiTimeCode);
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
                             case SysExRtMscCmdComplete:
                             case SysExRtMscCmdCancel:
-                                length += sprintf( (char*)&bytes[length], "%d %d ", msg->Data.SysEx.Data.MidiShowControl.Checksum, msg->Data.SysEx.Data.MidiShowControl.SequenceNumber);
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Checksum );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.SequenceNumber );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
                             case SysExRtMscCmdCancelled:
                             case SysExRtMscCmdAbort:
-                                length += sprintf( (char*)&bytes[length], "%d %d %d ", msg->Data.SysEx.Data.MidiShowControl.Checksum, msg->Data.SysEx.Data.MidiShowControl.Status, msg->Data.SysEx.Data.MidiShowControl.SequenceNumber);
-                                length += sprintfCueNumber( &bytes[length], &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Checksum );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.Status );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiShowControl.SequenceNumber );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += sprintfCueNumber( str_at( bytes, length ), &msg->Data.SysEx.Data.MidiShowControl.CueNumber );
                                 break;
 
 
@@ -2996,16 +2929,20 @@ namespace MidiMessage {
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtDeviceControl){
                         if (msg->Data.SysEx.SubId2 == SysExRtDcMasterVolume){
-                            length += sprintf( (char*)&bytes[length], "master-volume %d", msg->Data.SysEx.Data.DeviceControl.Value);
+                            length += str_write( str_at( bytes, length ), "master-volume " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.DeviceControl.Value );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExRtDcMasterBalance){
-                            length += sprintf( (char*)&bytes[length], "master-balance %d", msg->Data.SysEx.Data.DeviceControl.Value);
+                            length += str_write( str_at( bytes, length ), "master-balance " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.DeviceControl.Value );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExRtDcMasterCoarseTuning){
-                            length += sprintf( (char*)&bytes[length], "coarse-tuning %d", msg->Data.SysEx.Data.DeviceControl.Value);
+                            length += str_write( str_at( bytes, length ), "coarse-tuning " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.DeviceControl.Value );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExRtDcMasterFineTuning){
-                            length += sprintf( (char*)&bytes[length], "fine-tuning %d", msg->Data.SysEx.Data.DeviceControl.Value);
+                            length += str_write( str_at( bytes, length ), "fine-tuning " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.DeviceControl.Value );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExRtDcGlobalParameterControl){
 
@@ -3014,7 +2951,12 @@ namespace MidiMessage {
                             uint8_t pw = msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl.ParameterIdWidth;
                             uint8_t vw = msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl.ValueWidth;
 
-                            length += sprintf( (char*)&bytes[length], "global-parameter-control %d %d %d", sw, pw, vw);
+                            length += str_write( str_at( bytes, length ), "global-parameter-control " );
+                            length += writeDecimal( str_at( bytes, length ), sw );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), pw );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), vw );
 
 //                            printf("%s :: datalength = %d",
 //                                   bytes,
@@ -3023,7 +2965,8 @@ namespace MidiMessage {
 //                            fflush(stdout);
 
                             for(uint8_t i = 0; i < sw; i++){
-                                length += sprintf( (char*)&bytes[length], " %d", getIthGpcSlot(&msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i) );
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), getIthGpcSlot(&msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i) );
                             }
 
                             uint8_t pc = (pw + vw) == 0 ? 0 : ((msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl.DataLength - 2*sw) / (pw + vw));
@@ -3032,95 +2975,114 @@ namespace MidiMessage {
                                 uint8_t * id = getIthGpcParameterIdAddr(&msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i);
                                 uint8_t * value = getIthGpcParameterValueAddr(&msg->Data.SysEx.Data.DeviceControl.GlobalParameterControl, i);
 
-                                bytes[length++] = ' ';
-                                length += sprintfHex( &bytes[length], id, pw );
-                                bytes[length++] = ' ';
-                                length += sprintfHex( &bytes[length], value, vw );
+                                length += writeChar( str_at( bytes, length ), ' ' );
+                                length += sprintfHex( str_at( bytes, length ), id, pw );
+                                length += writeChar( str_at( bytes, length ), ' ' );
+                                length += sprintfHex( str_at( bytes, length ), value, vw );
                             }
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtControllerDestinationSetting){
 
-                        length += sprintf( (char*)&bytes[length], "cds %d ", msg->Data.SysEx.Data.ControllerDestinationSetting.Channel);
+                        length += str_write( str_at( bytes, length ), "cds " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.ControllerDestinationSetting.Channel );
+                        length += str_write( str_at( bytes, length ), " " );
 
                         if (msg->Data.SysEx.SubId2 == SysExRtCdsController){
-                            length += sprintf( (char*)&bytes[length], "cc %d", msg->Data.SysEx.Data.ControllerDestinationSetting.Controller);
+                            length += str_write( str_at( bytes, length ), "cc " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.ControllerDestinationSetting.Controller );
                         } else if (msg->Data.SysEx.SubId2 == SysExRtCdsChannelPressure) {
-                            length += sprintf( (char*)&bytes[length], "channel-pressure" );
+                            length += str_write( str_at( bytes, length ), "channel-pressure" );
                         } else if (msg->Data.SysEx.SubId2 == SysExRtCdsPolyphonicKeyPressure) {
-                            length += sprintf( (char*)&bytes[length], "key-pressure" );
+                            length += str_write( str_at( bytes, length ), "key-pressure" );
                         } else {
                             return 0;
                         }
 
-                        for(uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                            length += sprintf( (char*)&bytes[length], " %d", msg->Data.SysEx.ByteData[i]);
+                        for(size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtKeybasedInstrumentControl){
 
-                        length += sprintf( (char*)&bytes[length], "keys %d %d", msg->Data.SysEx.Data.KeybasedInstrumentControl.Channel, msg->Data.SysEx.Data.KeybasedInstrumentControl.Key);
+                        length += str_write( str_at( bytes, length ), "keys " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.KeybasedInstrumentControl.Channel );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.KeybasedInstrumentControl.Key );
 
-                        for(uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                            length += sprintf( (char*)&bytes[length], " %d", msg->Data.SysEx.ByteData[i]);
+                        for(size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                         }
 
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtMobilePhoneControlMessage){
-                        length += sprintf( (char*)&bytes[length], "mpc ");
+                        length += str_write( str_at( bytes, length ), "mpc " );
 
                         if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassVibrator){
-                            length += sprintf( (char*)&bytes[length], "vibrator ");
+                            length += str_write( str_at( bytes, length ), "vibrator " );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassDisplay){
-                            length += sprintf( (char*)&bytes[length], "display ");
+                            length += str_write( str_at( bytes, length ), "display " );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassKeypad){
-                            length += sprintf( (char*)&bytes[length], "keypad ");
+                            length += str_write( str_at( bytes, length ), "keypad " );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassLed){
-                            length += sprintf( (char*)&bytes[length], "led ");
+                            length += str_write( str_at( bytes, length ), "led " );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassAll){
-                            length += sprintf( (char*)&bytes[length], "all ");
+                            length += str_write( str_at( bytes, length ), "all " );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.Id == SysExRtMobileDeviceClassManufacturer){
-                            length += sprintf( (char*)&bytes[length], "%06X %d ", msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.ManufacturerId, msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.SubId);
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.ManufacturerId, 6 );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.DeviceClass.SubId );
+                            length += str_write( str_at( bytes, length ), " " );
                         }
                         else {
                             return 0;
                         }
 
-                        length += sprintf( (char*)&bytes[length], "%d ", msg->Data.SysEx.Data.MobilePhoneControl.DeviceIndex);
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.DeviceIndex );
+                        length += str_write( str_at( bytes, length ), " " );
 
                         if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdOn){
-                            length += sprintf( (char*)&bytes[length], "on");
+                            length += str_write( str_at( bytes, length ), "on" );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdOff){
-                            length += sprintf( (char*)&bytes[length], "off");
+                            length += str_write( str_at( bytes, length ), "off" );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdReset){
-                            length += sprintf( (char*)&bytes[length], "reset");
+                            length += str_write( str_at( bytes, length ), "reset" );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdSetLevel){
-                            length += sprintf( (char*)&bytes[length], "set-level %d", msg->Data.SysEx.Data.MobilePhoneControl.Level);
+                            length += str_write( str_at( bytes, length ), "set-level " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.Level );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdSetColorRgb){
-                            length += sprintf( (char*)&bytes[length], "set-color %d %d %d", msg->Data.SysEx.Data.MobilePhoneControl.Rgb[0], msg->Data.SysEx.Data.MobilePhoneControl.Rgb[1], msg->Data.SysEx.Data.MobilePhoneControl.Rgb[2]);
+                            length += str_write( str_at( bytes, length ), "set-color " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.Rgb[0] );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.Rgb[1] );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.Rgb[2] );
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdFollowMidiChannels){
-                            length += sprintf( (char*)&bytes[length], "follow-midi-channels");
-                            for (uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                                length += sprintf( (char*)&bytes[length], " %d", msg->Data.SysEx.ByteData[i]);
+                            length += str_write( str_at( bytes, length ), "follow-midi-channels" );
+                            for (size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                             }
                         }
                         else if (msg->Data.SysEx.Data.MobilePhoneControl.Command.Id == SysExRtMobileCmdIdManufacturer){
-                            length += sprintf( (char*)&bytes[length], "%06X", msg->Data.SysEx.Data.MobilePhoneControl.Command.ManufacturerId);
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MobilePhoneControl.Command.ManufacturerId, 6 );
 
                             if (msg->Data.SysEx.Length > 0){
-                                length += sprintf( (char*)&bytes[length], " ");
+                                length += str_write( str_at( bytes, length ), " " );
 
-                                length += sprintfHex( &bytes[length], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
+                                length += sprintfHex( str_at( bytes, length ), msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
                             }
                         }
                         else {
@@ -3131,9 +3093,9 @@ namespace MidiMessage {
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtMidiMachineControlCommand){
 
-                        length += sprintf( (char*)&bytes[length], "mcc ");
+                        length += str_write( str_at( bytes, length ), "mcc " );
 
-                        int l = MccDataToString( &bytes[length], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
+                        int l = MccDataToString( str_at( bytes, length ), msg->Data.SysEx.ByteData, msg->Data.SysEx.Length );
 
                         if (l <= 0){
                             return 0;
@@ -3142,36 +3104,40 @@ namespace MidiMessage {
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtMidiMachineControlResponse){
-                        length += sprintf( (char*)&bytes[length], "mcr ");
+                        length += str_write( str_at( bytes, length ), "mcr " );
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExRtNotationInformation){
-                        length += sprintf( (char*)&bytes[length], "notation ");
+                        length += str_write( str_at( bytes, length ), "notation " );
 
                         if (msg->Data.SysEx.SubId2 == SysExRtNiBarNumber){
 
                             if (msg->Data.SysEx.Data.NotationInformation.BarNumber == SysExRtNiBarNumberNotRunning){
-                                length += sprintf( (char*)&bytes[length], "not-running");
+                                length += str_write( str_at( bytes, length ), "not-running" );
                             }
                             else if (msg->Data.SysEx.Data.NotationInformation.BarNumber == SysExRtNiBarNumberRunningUnknown){
-                                length += sprintf( (char*)&bytes[length], "running-unknown");
+                                length += str_write( str_at( bytes, length ), "running-unknown" );
                             }
                             else {
-                                length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.Data.NotationInformation.BarNumber);
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.NotationInformation.BarNumber );
                             }
 
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExRtNiTimeSignatureDelayed || msg->Data.SysEx.SubId2 == SysExRtNiTimeSignatureImmediate){
 
-                            length += sprintf( (char*)&bytes[length], "time-signature %s %u %u %u %u",
-                                               msg->Data.SysEx.SubId2 == SysExRtNiTimeSignatureDelayed ? "delayed" : "immediate",
-                                               msg->Data.SysEx.Data.NotationInformation.MidiClocksInMetronomeClick,
-                                               msg->Data.SysEx.Data.NotationInformation.Notes32sInMidiQuarterNote,
-                                               msg->Data.SysEx.Data.NotationInformation.TimeSignatureNumerator,
-                                               msg->Data.SysEx.Data.NotationInformation.TimeSignatureDenominator
-                            );
+                            length += str_write( str_at( bytes, length ), "time-signature " );
+                            length += writeString( str_at( bytes, length ), msg->Data.SysEx.SubId2 == SysExRtNiTimeSignatureDelayed ? "delayed" : "immediate" );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.NotationInformation.MidiClocksInMetronomeClick );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.NotationInformation.Notes32sInMidiQuarterNote );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.NotationInformation.TimeSignatureNumerator );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.NotationInformation.TimeSignatureDenominator );
 
-                            for(uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                                length += sprintf( (char*)&bytes[length], " %u", msg->Data.SysEx.ByteData[i] );
+                            for(size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                             }
                         }
                     }
@@ -3181,75 +3147,82 @@ namespace MidiMessage {
 
 
                 if (msg->Data.SysEx.Id == SysExIdNonRealTime){
-                    length += sprintf( (char*)&bytes[length], "nonrt %d ", msg->Channel);
+                    length += str_write( str_at( bytes, length ), "nonrt " );
+                    length += writeDecimal( str_at( bytes, length ), msg->Channel );
+                    length += str_write( str_at( bytes, length ), " " );
 
 
                     if (msg->Data.SysEx.SubId1 == SysExNonRtEndOfFile){
-                        length += sprintf( (char*)&bytes[length], "eof %d", msg->Data.SysEx.Data.PacketNumber);
+                        length += str_write( str_at( bytes, length ), "eof " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.PacketNumber );
                     } else if (msg->Data.SysEx.SubId1 == SysExNonRtWait){
-                        length += sprintf( (char*)&bytes[length], "wait %d", msg->Data.SysEx.Data.PacketNumber);
+                        length += str_write( str_at( bytes, length ), "wait " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.PacketNumber );
                     } else if (msg->Data.SysEx.SubId1 == SysExNonRtCancel){
-                        length += sprintf( (char*)&bytes[length], "cancel %d", msg->Data.SysEx.Data.PacketNumber);
+                        length += str_write( str_at( bytes, length ), "cancel " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.PacketNumber );
                     } else if (msg->Data.SysEx.SubId1 == SysExNonRtNAK){
-                        length += sprintf( (char*)&bytes[length], "nak %d", msg->Data.SysEx.Data.PacketNumber);
+                        length += str_write( str_at( bytes, length ), "nak " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.PacketNumber );
                     } else if (msg->Data.SysEx.SubId1 == SysExNonRtACK){
-                        length += sprintf( (char*)&bytes[length], "ack %d", msg->Data.SysEx.Data.PacketNumber);
+                        length += str_write( str_at( bytes, length ), "ack " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.PacketNumber );
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtGeneralMidi){
-                        length += sprintf( (char*)&bytes[length], "gm ");
+                        length += str_write( str_at( bytes, length ), "gm " );
                         if (msg->Data.SysEx.SubId2 == SysExNonRtGmSystemOn1){
-                            length += sprintf( (char*)&bytes[length], "system-on1");
+                            length += str_write( str_at( bytes, length ), "system-on1" );
                         }
                         if (msg->Data.SysEx.SubId2 == SysExNonRtGmSystemOff){
-                            length += sprintf( (char*)&bytes[length], "system-off");
+                            length += str_write( str_at( bytes, length ), "system-off" );
                         }
                         if (msg->Data.SysEx.SubId2 == SysExNonRtGmSystemOn2){
-                            length += sprintf( (char*)&bytes[length], "system-on2");
+                            length += str_write( str_at( bytes, length ), "system-on2" );
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtMidiTimeCode){
-                        length += sprintf( (char*)&bytes[length], "cueing ");
+                        length += str_write( str_at( bytes, length ), "cueing " );
                         if (msg->Data.SysEx.SubId2 == SysExNonRtMtcSpecial){
-                            length += sprintf( (char*)&bytes[length], "special ");
+                            length += str_write( str_at( bytes, length ), "special " );
                             if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialTimeCodeOffset){
-                                length += sprintf( (char*)&bytes[length], "time-code-offset");
+                                length += str_write( str_at( bytes, length ), "time-code-offset" );
                             }
                             else if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialEnableEventList){
-                                length += sprintf( (char*)&bytes[length], "enable-event-list");
+                                length += str_write( str_at( bytes, length ), "enable-event-list" );
                             }
                             else if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialDisableEventList){
-                                length += sprintf( (char*)&bytes[length], "disable-event-list");
+                                length += str_write( str_at( bytes, length ), "disable-event-list" );
                             }
                             else if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialClearEventList){
-                                length += sprintf( (char*)&bytes[length], "clear-event-list");
+                                length += str_write( str_at( bytes, length ), "clear-event-list" );
                             }
                             else if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialSystemStop){
-                                length += sprintf( (char*)&bytes[length], "system-stop");
+                                length += str_write( str_at( bytes, length ), "system-stop" );
                             }
                             else if (msg->Data.SysEx.Data.Cueing.EventNumber == SysExNonRtMtcSpecialEventListRequest){
-                                length += sprintf( (char*)&bytes[length], "event-list-request");
+                                length += str_write( str_at( bytes, length ), "event-list-request" );
                             }
                             else {
-                                length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.Data.Cueing.EventNumber);
+                                length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.EventNumber );
                             }
                         }
                         else {
 
                             switch (msg->Data.SysEx.SubId2){
-                                case SysExNonRtMtcPunchInPoint:                 length += sprintf( (char*)&bytes[length], "punch-in add "); break;
-                                case SysExNonRtMtcDeletePunchInPoint:           length += sprintf( (char*)&bytes[length], "punch-in rm "); break;
-                                case SysExNonRtMtcPunchOutPoint:                length += sprintf( (char*)&bytes[length], "punch-out add "); break;
-                                case SysExNonRtMtcDeletePunchOutPoint:          length += sprintf( (char*)&bytes[length], "punch-out rm "); break;
+                                case SysExNonRtMtcPunchInPoint:                 length += str_write( str_at( bytes, length ), "punch-in add " ); break;
+                                case SysExNonRtMtcDeletePunchInPoint:           length += str_write( str_at( bytes, length ), "punch-in rm " ); break;
+                                case SysExNonRtMtcPunchOutPoint:                length += str_write( str_at( bytes, length ), "punch-out add " ); break;
+                                case SysExNonRtMtcDeletePunchOutPoint:          length += str_write( str_at( bytes, length ), "punch-out rm " ); break;
                                 case SysExNonRtMtcEventStartPoint:
-                                case SysExNonRtMtcEventStartPointWithInfo:     length += sprintf( (char*)&bytes[length], "event-start add "); break;
-                                case SysExNonRtMtcDeleteEventStartPoint:        length += sprintf( (char*)&bytes[length], "event-start rm "); break;
+                                case SysExNonRtMtcEventStartPointWithInfo:     length += str_write( str_at( bytes, length ), "event-start add " ); break;
+                                case SysExNonRtMtcDeleteEventStartPoint:        length += str_write( str_at( bytes, length ), "event-start rm " ); break;
                                 case SysExNonRtMtcEventStopPoint:
-                                case SysExNonRtMtcEventStopPointWithInfo:      length += sprintf( (char*)&bytes[length], "event-stop add "); break;
-                                case SysExNonRtMtcDeleteEventStopPoint:         length += sprintf( (char*)&bytes[length], "event-stop rm "); break;
+                                case SysExNonRtMtcEventStopPointWithInfo:      length += str_write( str_at( bytes, length ), "event-stop add " ); break;
+                                case SysExNonRtMtcDeleteEventStopPoint:         length += str_write( str_at( bytes, length ), "event-stop rm " ); break;
                                 case SysExNonRtMtcCuePoint:
-                                case SysExNonRtMtcCuePointWithInfo:            length += sprintf( (char*)&bytes[length], "cue-point add "); break;
-                                case SysExNonRtMtcDeleteCuePoint:               length += sprintf( (char*)&bytes[length], "cue-point rm "); break;
-                                case SysExNonRtMtcEventName:                    length += sprintf( (char*)&bytes[length], "event-name "); break;
+                                case SysExNonRtMtcCuePointWithInfo:            length += str_write( str_at( bytes, length ), "cue-point add " ); break;
+                                case SysExNonRtMtcDeleteCuePoint:               length += str_write( str_at( bytes, length ), "cue-point rm " ); break;
+                                case SysExNonRtMtcEventName:                    length += str_write( str_at( bytes, length ), "event-name " ); break;
                                 default:
                                     return 0;
                             }
@@ -3261,141 +3234,160 @@ namespace MidiMessage {
                                 case MtcFrameRate29_97fps: fps = 29; break;
                                 case MtcFrameRate30fps: fps = 30; break;
                             }
-                            length += sprintf( (char*)&bytes[length], "%d%s %d %d %d %d %d %d",
-                                   fps,
-                                   fps == 29 ? ".97" : "",
-                                   msg->Data.SysEx.Data.MidiTimeCode.Hour,
-                                   msg->Data.SysEx.Data.Cueing.MidiTimeCode.Minute,
-                                   msg->Data.SysEx.Data.Cueing.MidiTimeCode.Second,
-                                   msg->Data.SysEx.Data.Cueing.MidiTimeCode.Frame,
-                                   msg->Data.SysEx.Data.Cueing.MidiTimeCode.FractionalFrame,
-                                   msg->Data.SysEx.Data.Cueing.EventNumber
-                            );
+                            length += writeDecimal( str_at( bytes, length ), fps );
+                            length += writeString( str_at( bytes, length ), fps == 29 ? ".97" : "" );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.MidiTimeCode.Hour );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.MidiTimeCode.Minute );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.MidiTimeCode.Second );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.MidiTimeCode.Frame );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.MidiTimeCode.FractionalFrame );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.Cueing.EventNumber );
 
                             if (msg->Data.SysEx.Length > 0){
-                                length += sprintf( (char*)&bytes[length], " %s", msg->Data.SysEx.ByteData);
+                                length += str_write( str_at( bytes, length ), " " );
+                                length += writeString( str_at( bytes, length ), (char*)msg->Data.SysEx.ByteData );
                             }
 
-                            length += sprintf( (char*)&bytes[length], "");
-
-//                        length += sprintf( (char*)&bytes[length], "%d", msg->Data.SysEx.SubId2);
+//                        length += sprintf( (char*)str_at( bytes, length ), "%d", msg->Data.SysEx.SubId2);
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtGeneralInformation){
-                        length += sprintf( (char*)&bytes[length], "info ");
+                        length += str_write( str_at( bytes, length ), "info " );
 
                         if (msg->Data.SysEx.SubId2 == SysExNonRtGenInfoIdentityRequest){
-                            length += sprintf( (char*)&bytes[length], "request"
-                            );
+                            length += str_write( str_at( bytes, length ), "request" );
                         } else if (msg->Data.SysEx.SubId2 == SysExNonRtGenInfoIdentityReply) {
-                            length += sprintf( (char*)&bytes[length], "reply %06X %d %d %02X%02X%02X%02X",
-                                   msg->Data.SysEx.Data.GeneralInfo.ManufacturerId,
-                                   msg->Data.SysEx.Data.GeneralInfo.DeviceFamily,
-                                   msg->Data.SysEx.Data.GeneralInfo.DeviceFamilyMember,
-                                   msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[0],
-                                   msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[1],
-                                   msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[2],
-                                   msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[3]
-                            );
+                            length += str_write( str_at( bytes, length ), "reply " );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.ManufacturerId, 6 );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.DeviceFamily );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.DeviceFamilyMember );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[0], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[1], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[2], 2 );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.GeneralInfo.SoftwareRevision[3], 2 );
                         }
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtSampleDumpHeader){
-                        length += sprintf( (char*)&bytes[length], "sds-header %d %d %d %d %d %d ",
-                                           msg->Data.SysEx.Data.SampleDump.Header.SampleNumber,
-                                           msg->Data.SysEx.Data.SampleDump.Header.SampleFormat,
-                                           msg->Data.SysEx.Data.SampleDump.Header.SamplePeriod,
-                                           msg->Data.SysEx.Data.SampleDump.Header.SampleLength,
-                                           msg->Data.SysEx.Data.SampleDump.Header.LoopStartPoint,
-                                           msg->Data.SysEx.Data.SampleDump.Header.LoopEndPoint
-                        );
-                        length += sprintfSdsLoopType(&bytes[length], msg->Data.SysEx.Data.SampleDump.Header.LoopType);
+                        length += str_write( str_at( bytes, length ), "sds-header " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.SampleNumber );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.SampleFormat );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.SamplePeriod );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.SampleLength );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.LoopStartPoint );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.LoopEndPoint );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += sprintfSdsLoopType(str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Header.LoopType);
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtSampleDumpRequest){
-                        length += sprintf( (char*)&bytes[length], "sds-request %d",
-                                           msg->Data.SysEx.Data.SampleDump.Request.SampleNumber
-                        );
+                        length += str_write( str_at( bytes, length ), "sds-request " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.Request.SampleNumber );
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtSampleDataPacket){
-                        length += sprintf( (char*)&bytes[length], "sds-data %d ",
-                                           msg->Data.SysEx.Data.SampleDump.DataPacket.RunningPacketCount
-                        );
-                        length += sprintfHex( &bytes[length], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
-                        length += sprintf( (char*)&bytes[length], " %02X %02X", msg->Data.SysEx.Data.SampleDump.DataPacket.Checksum, msg->Data.SysEx.Data.SampleDump.DataPacket.ChecksumVerification);
+                        length += str_write( str_at( bytes, length ), "sds-data " );
+                        length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.DataPacket.RunningPacketCount );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += sprintfHex( str_at( bytes, length ), msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.DataPacket.Checksum, 2 );
+                        length += str_write( str_at( bytes, length ), " " );
+                        length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.DataPacket.ChecksumVerification, 2 );
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtSampleDumpExtension){
 
-                        length += sprintf( (char*)&bytes[length], "sds-ext ");
+                        length += str_write( str_at( bytes, length ), "sds-ext " );
 
                         if (msg->Data.SysEx.SubId2 == SysExNonRtSdsLoopPointsTransmission){
-                            length += sprintf( (char*)&bytes[length], "loop-point-tx %u %u ",
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.SampleNumber,
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopNumber
-                            );
-                            length += sprintfSdsLoopType(&bytes[length], msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopType);
-                            length += sprintf( (char*)&bytes[length], " %u %u",
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopStartAddress,
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopEndAddress
-                            );
+                            length += str_write( str_at( bytes, length ), "loop-point-tx " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += sprintfSdsLoopType(str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopType);
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopStartAddress );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopEndAddress );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsLoopPointsRequest){
-                            length += sprintf( (char*)&bytes[length], "loop-point-request %u %u",
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointRequest.SampleNumber,
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointRequest.LoopNumber
-                            );
+                            length += str_write( str_at( bytes, length ), "loop-point-request " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointRequest.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointRequest.LoopNumber );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsSampleNameTransmission){
-                            length += sprintf( (char*)&bytes[length], "name-tx %d ",
-                                               msg->Data.SysEx.Data.SampleDump.NameTransmission.SampleNumber
-                            );
+                            length += str_write( str_at( bytes, length ), "name-tx " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.NameTransmission.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
 
                             if (msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength == 0){
-                                length += sprintf( (char*)&bytes[length], "- ");
+                                length += str_write( str_at( bytes, length ), "- " );
                             } else {
                                 for(uint8_t i = 0; i < msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength; i++){
-                                    bytes[length++] = msg->Data.SysEx.ByteData[i];
+                                    length += writeChar( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                                 }
-                                bytes[length++] = ' ';
+                                length += writeChar( str_at( bytes, length ), ' ' );
                             }
 
 //                            printf("%u %u\n", msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength, msg->Data.SysEx.Data.SampleDump.NameTransmission.NameLength);
 
                             for(uint8_t i = 0, j = msg->Data.SysEx.Data.SampleDump.NameTransmission.LanguageTagLength; i < msg->Data.SysEx.Data.SampleDump.NameTransmission.NameLength; i++, j++){
-                                bytes[length++] = msg->Data.SysEx.ByteData[j];
+                                length += writeChar( str_at( bytes, length ), msg->Data.SysEx.ByteData[j] );
                             }
 
-                            bytes[length] = '\0';
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsSampleNameRequest){
-                            length += sprintf( (char*)&bytes[length], "name-request %u", msg->Data.SysEx.Data.SampleDump.NameRequest.SampleNumber);
+                            length += str_write( str_at( bytes, length ), "name-request " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.NameRequest.SampleNumber );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsExtendedDumpHeader){
-                            length += sprintf( (char*)&bytes[length], "ext-header %u %u %u %u %llu %llu %llu ",
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleNumber,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleFormat,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleRateIntegerPortion,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleRateFractionalPortion,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleLength,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SustainLoopStart,
-                                               msg->Data.SysEx.Data.SampleDump.ExtHeader.SustainLoopEnd
-                            );
-                            length += sprintfSdsLoopType(&bytes[length], msg->Data.SysEx.Data.SampleDump.ExtHeader.LoopType);
+                            length += str_write( str_at( bytes, length ), "ext-header " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleFormat );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleRateIntegerPortion );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleRateFractionalPortion );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SampleLength );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SustainLoopStart );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.SustainLoopEnd );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += sprintfSdsLoopType(str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtHeader.LoopType);
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsExtendedLoopPointsTransmission){
-                            length += sprintf( (char*)&bytes[length], "ext-loop-point-tx %u %u ",
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.SampleNumber,
-                                               msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopNumber
-                            );
-                            length += sprintfSdsLoopType(&bytes[length], msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopType);
-                            length += sprintf( (char*)&bytes[length], " %llu %llu",
-                                               msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopStartAddress,
-                                               msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopEndAddress
-                            );
+                            length += str_write( str_at( bytes, length ), "ext-loop-point-tx " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.LoopPointTransmission.LoopNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += sprintfSdsLoopType(str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopType);
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopStartAddress );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtLoopPointTransmission.LoopEndAddress );
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtSdsExtendedLoopPointsRequest){
-                            length += sprintf( (char*)&bytes[length], "ext-loop-point-request %u %u",
-                                               msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.SampleNumber,
-                                               msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.LoopNumber
-                            );
+                            length += str_write( str_at( bytes, length ), "ext-loop-point-request " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.SampleNumber );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.SampleDump.ExtLoopPointRequest.LoopNumber );
                         }
                         else {
                             return 0;
@@ -3403,82 +3395,83 @@ namespace MidiMessage {
                     }
 
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtMidiVisualControl){
-                        length += sprintf( (char*)&bytes[length], "mvc ");
+                        length += str_write( str_at( bytes, length ), "mvc " );
 
                         switch(msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress){
 
-                            case SysExNonRtMvcAddressMidiVisualControlOnOff:        length += sprintf( (char*)&bytes[length], "on-off " ); break;
-                            case SysExNonRtMvcAddressClipControlRxChannel:          length += sprintf( (char*)&bytes[length], "clip-control-channel " ); break;
-                            case SysExNonRtMvcAddressEffectControlRxChannel:        length += sprintf( (char*)&bytes[length], "fx-control-channel " ); break;
-                            case SysExNonRtMvcAddressNoteMessageEnabled:            length += sprintf( (char*)&bytes[length], "note-msg-enabled " ); break;
-                            case SysExNonRtMvcAddressPlaybackSpeedCtrlAssignMsn:    length += sprintf( (char*)&bytes[length], "playback-assign-msn " ); break;
-                            case SysExNonRtMvcAddressPlaybackSpeedCtrlAssignLsn:    length += sprintf( (char*)&bytes[length], "playback-assign-lsn " ); break;
-                            case SysExNonRtMvcAddressDissolveTimeCtrlAssignMsn:     length += sprintf( (char*)&bytes[length], "dissolve-assign-msn " ); break;
-                            case SysExNonRtMvcAddressDissolveTimeCtrlAssignLsn:     length += sprintf( (char*)&bytes[length], "dissolve-assign-lsn " ); break;
-                            case SysExNonRtMvcAddressEffectControl1AssignMsn:       length += sprintf( (char*)&bytes[length], "fx1-assign-msn " ); break;
-                            case SysExNonRtMvcAddressEffectControl1AssignLsn:       length += sprintf( (char*)&bytes[length], "fx1-assign-lsn " ); break;
-                            case SysExNonRtMvcAddressEffectControl2AssignMsn:       length += sprintf( (char*)&bytes[length], "fx2-assign-msn " ); break;
-                            case SysExNonRtMvcAddressEffectControl2AssignLsn:       length += sprintf( (char*)&bytes[length], "fx2-assign-lsn " ); break;
-                            case SysExNonRtMvcAddressEffectControl3AssignMsn:       length += sprintf( (char*)&bytes[length], "fx3-assign-msn " ); break;
-                            case SysExNonRtMvcAddressEffectControl3AssignLsn:       length += sprintf( (char*)&bytes[length], "fx3-assign-lsn " ); break;
-                            case SysExNonRtMvcAddressPlaybackSpeedCtrlRange:        length += sprintf( (char*)&bytes[length], "playback-speed-range " ); break;
-                            case SysExNonRtMvcAddressKeyboardRangeLower:            length += sprintf( (char*)&bytes[length], "keyboard-range-lower " ); break;
-                            case SysExNonRtMvcAddressKeyboardRangeUpper:            length += sprintf( (char*)&bytes[length], "keyboard-range-upper " ); break;
+                            case SysExNonRtMvcAddressMidiVisualControlOnOff:        length += str_write( str_at( bytes, length ), "on-off " ); break;
+                            case SysExNonRtMvcAddressClipControlRxChannel:          length += str_write( str_at( bytes, length ), "clip-control-channel " ); break;
+                            case SysExNonRtMvcAddressEffectControlRxChannel:        length += str_write( str_at( bytes, length ), "fx-control-channel " ); break;
+                            case SysExNonRtMvcAddressNoteMessageEnabled:            length += str_write( str_at( bytes, length ), "note-msg-enabled " ); break;
+                            case SysExNonRtMvcAddressPlaybackSpeedCtrlAssignMsn:    length += str_write( str_at( bytes, length ), "playback-assign-msn " ); break;
+                            case SysExNonRtMvcAddressPlaybackSpeedCtrlAssignLsn:    length += str_write( str_at( bytes, length ), "playback-assign-lsn " ); break;
+                            case SysExNonRtMvcAddressDissolveTimeCtrlAssignMsn:     length += str_write( str_at( bytes, length ), "dissolve-assign-msn " ); break;
+                            case SysExNonRtMvcAddressDissolveTimeCtrlAssignLsn:     length += str_write( str_at( bytes, length ), "dissolve-assign-lsn " ); break;
+                            case SysExNonRtMvcAddressEffectControl1AssignMsn:       length += str_write( str_at( bytes, length ), "fx1-assign-msn " ); break;
+                            case SysExNonRtMvcAddressEffectControl1AssignLsn:       length += str_write( str_at( bytes, length ), "fx1-assign-lsn " ); break;
+                            case SysExNonRtMvcAddressEffectControl2AssignMsn:       length += str_write( str_at( bytes, length ), "fx2-assign-msn " ); break;
+                            case SysExNonRtMvcAddressEffectControl2AssignLsn:       length += str_write( str_at( bytes, length ), "fx2-assign-lsn " ); break;
+                            case SysExNonRtMvcAddressEffectControl3AssignMsn:       length += str_write( str_at( bytes, length ), "fx3-assign-msn " ); break;
+                            case SysExNonRtMvcAddressEffectControl3AssignLsn:       length += str_write( str_at( bytes, length ), "fx3-assign-lsn " ); break;
+                            case SysExNonRtMvcAddressPlaybackSpeedCtrlRange:        length += str_write( str_at( bytes, length ), "playback-speed-range " ); break;
+                            case SysExNonRtMvcAddressKeyboardRangeLower:            length += str_write( str_at( bytes, length ), "keyboard-range-lower " ); break;
+                            case SysExNonRtMvcAddressKeyboardRangeUpper:            length += str_write( str_at( bytes, length ), "keyboard-range-upper " ); break;
 
                             default:
-                                length += sprintf( (char*)&bytes[length], "%06X ", msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress);
+                                length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.MidiVisualControl.ParameterAddress, 6 );
+                                length += str_write( str_at( bytes, length ), " " );
                         }
 
-                        length += sprintfHex( &bytes[length], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
+                        length += sprintfHex( str_at( bytes, length ), msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
 
-                        bytes[length] = '\0';
                     }
                     else if (msg->Data.SysEx.SubId1 == SysExNonRtFileDump){
-                        length += sprintf( (char*)&bytes[length], "file-dump " );
+                        length += str_write( str_at( bytes, length ), "file-dump " );
 
                         if (msg->Data.SysEx.SubId2 == SysExNonRtFileDumpRequest){
-                            length += sprintf( (char*)&bytes[length], "request %u %c%c%c%c ",
-                                               msg->Data.SysEx.Data.FileDump.SourceDeviceId,
-                                               msg->Data.SysEx.Data.FileDump.Type[0],
-                                               msg->Data.SysEx.Data.FileDump.Type[1],
-                                               msg->Data.SysEx.Data.FileDump.Type[2],
-                                               msg->Data.SysEx.Data.FileDump.Type[3]
-                            );
+                            length += str_write( str_at( bytes, length ), "request " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.SourceDeviceId );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[0] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[1] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[2] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[3] );
+                            length += str_write( str_at( bytes, length ), " " );
 
 //                            fprintf(stderr, "%d\n");
 //                            fprintf(stderr, "%02X%02X%02X%02X\n", msg->Data.SysEx.ByteData[0], msg->Data.SysEx.ByteData[1], msg->Data.SysEx.ByteData[2], msg->Data.SysEx.ByteData[3]);
 
-                            for(uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                                bytes[length++] = msg->Data.SysEx.ByteData[i];
+                            for(size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                                length += writeChar( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                             }
-                            bytes[length] = '\0';
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtFileDumpHeader){
-                            length += sprintf( (char*)&bytes[length], "header %u %c%c%c%c %u ",
-                                               msg->Data.SysEx.Data.FileDump.SourceDeviceId,
-                                               msg->Data.SysEx.Data.FileDump.Type[0],
-                                               msg->Data.SysEx.Data.FileDump.Type[1],
-                                               msg->Data.SysEx.Data.FileDump.Type[2],
-                                               msg->Data.SysEx.Data.FileDump.Type[3],
-                                               msg->Data.SysEx.Data.FileDump.FileLength
-                            );
+                            length += str_write( str_at( bytes, length ), "header " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.SourceDeviceId );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[0] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[1] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[2] );
+                            length += writeChar( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Type[3] );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.FileLength );
+                            length += str_write( str_at( bytes, length ), " " );
 
-                            for(uint8_t i = 0; i < msg->Data.SysEx.Length; i++){
-                                bytes[length++] = msg->Data.SysEx.ByteData[i];
+                            for(size_t i = 0; i < msg->Data.SysEx.Length; i++){
+                                length += writeChar( str_at( bytes, length ), msg->Data.SysEx.ByteData[i] );
                             }
-                            bytes[length] = '\0';
                         }
                         else if (msg->Data.SysEx.SubId2 == SysExNonRtFileDumpDataPacket){
-                            length += sprintf( (char*)&bytes[length], "data %u ",
-                                               msg->Data.SysEx.Data.FileDump.PacketNumber
-                            );
+                            length += str_write( str_at( bytes, length ), "data " );
+                            length += writeDecimal( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.PacketNumber );
+                            length += str_write( str_at( bytes, length ), " " );
 
-                            length += sprintfHex( &bytes[length], msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
+                            length += sprintfHex( str_at( bytes, length ), msg->Data.SysEx.ByteData, msg->Data.SysEx.Length);
 
-                            length += sprintf( (char*)&bytes[length], " %02X %02X",
-                                               msg->Data.SysEx.Data.FileDump.Checksum,
-                                               msg->Data.SysEx.Data.FileDump.ChecksumVerification
-                            );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.Checksum, 2 );
+                            length += str_write( str_at( bytes, length ), " " );
+                            length += writeHex( str_at( bytes, length ), msg->Data.SysEx.Data.FileDump.ChecksumVerification, 2 );
                         }
 
                     }
@@ -3493,6 +3486,40 @@ namespace MidiMessage {
         return length;
     }
 
+    int MessagetoString(uint8_t * bytes, Message_t * msg) {
+        ASSERT( bytes != NULL );
+
+        int length = messageToString( StrDst_t{ bytes, SIZE_MAX }, msg );
+
+        // (as with sprintf)
+        bytes[length] = '\0';
+
+        return length;
+    }
+
+    int MessagetoStringBounded(uint8_t * bytes, size_t size, Message_t * msg) {
+        ASSERT( bytes != NULL );
+
+        if (size == 0){
+            return 0;
+        }
+
+        // (leaving room for the terminating null)
+        int length = messageToString( StrDst_t{ bytes, size - 1 }, msg );
+
+        if (length <= 0 || (size_t)length >= size){
+            return 0;
+        }
+
+        bytes[length] = '\0';
+
+        return length;
+    }
+
+    int MessageStringLength(Message_t * msg) {
+        return messageToString( StrDst_t{ NULL, 0 }, msg );
+    }
+
 #ifdef __cplusplus
     } // extern "C"
 } // namespace MidiMessage
@@ -0,0 +1,170 @@
+#include <midimessage/ump.h>
+
+#include <string.h>
+
+#ifdef __cplusplus
+namespace MidiMessage {
+    extern "C" {
+#endif
+
+    static void umpencoder_shortMessageHandler( ShortMessage_t message, void * context ){
+        UmpEncoder_t * encoder = (UmpEncoder_t*)context;
+
+        encoder->Count += packUmpShortMessage( &encoder->Words[encoder->Count], encoder->Group, &message );
+    }
+
+    // any remaining (system common) messages
+    static void umpencoder_messageHandler( Message_t * message, void * context ){
+        UmpEncoder_t * encoder = (UmpEncoder_t*)context;
+
+        ShortMessage_t shortMsg;
+
+        if (MessagetoShortMessage( message, &shortMsg )){
+            encoder->Count += packUmpShortMessage( &encoder->Words[encoder->Count], encoder->Group, &shortMsg );
+        }
+    }
+
+    static void umpencoder_sysExHandler( ParserSysExEvent_t event, uint8_t * bytes, size_t length, void * context ){
+        UmpEncoder_t * encoder = (UmpEncoder_t*)context;
+
+        if (event == ParserSysExEventBegin){
+            encoder->SysExLength = 0;
+            encoder->SysExStarted = false;
+            return;
+        }
+
+        if (event == ParserSysExEventData){
+
+            while (length > 0){
+
+                // only emit full packets once more data follows, the last packet must be marked as such
+                if (encoder->SysExLength == UmpSysEx7MaxLength){
+                    encoder->Count += packUmpSysEx7( &encoder->Words[encoder->Count], encoder->Group, encoder->SysExStarted ? UmpSysEx7Continue : UmpSysEx7Start, encoder->SysEx, encoder->SysExLength );
+                    encoder->SysExLength = 0;
+                    encoder->SysExStarted = true;
+                }
+
+                size_t n = UmpSysEx7MaxLength - encoder->SysExLength;
+                if (n > length){
+                    n = length;
+                }
+
+                memcpy( &encoder->SysEx[encoder->SysExLength], bytes, n );
+                encoder->SysExLength += n;
+
+                bytes += n;
+                length -= n;
+            }
+            return;
+        }
+
+        // ParserSysExEventEnd (a sysex terminated by another status byte is still passed on as complete)
+        encoder->Count += packUmpSysEx7( &encoder->Words[encoder->Count], encoder->Group, encoder->SysExStarted ? UmpSysEx7End : UmpSysEx7Complete, encoder->SysEx, encoder->SysExLength );
+        encoder->SysExLength = 0;
+        encoder->SysExStarted = false;
+    }
+
+    void umpencoder_init( UmpEncoder_t * encoder, bool runningStatusEnabled, uint8_t group ){
+        ASSERT( encoder != NULL );
+        ASSERT( (group & UmpGroupMask) == group );
+
+        // sysex messages are never unpacked, but unpack() requires a data buffer
+        encoder->Message.Data.SysEx.ByteData = encoder->SysEx;
+
+        parser_init( &encoder->Parser, runningStatusEnabled, encoder->Buffer, sizeof(encoder->Buffer), &encoder->Message, umpencoder_messageHandler, NULL, encoder );
+        parser_setSysExHandler( &encoder->Parser, umpencoder_sysExHandler );
+        parser_setShortMessageHandler( &encoder->Parser, umpencoder_shortMessageHandler );
+
+        encoder->Group = group;
+        encoder->SysExLength = 0;
+        encoder->SysExStarted = false;
+        encoder->Words = NULL;
+        encoder->Count = 0;
+    }
+
+    size_t umpencoder_receivedData( UmpEncoder_t * encoder, uint8_t * data, size_t len, uint32_t * words ){
+        ASSERT( encoder != NULL );
+        ASSERT( words != NULL );
+
+        encoder->Words = words;
+        encoder->Count = 0;
+
+        parser_receivedData( &encoder->Parser, data, len );
+
+        encoder->Words = NULL;
+
+        return encoder->Count;
+    }
+
+    size_t umpToBytes( uint32_t * words, size_t count, uint8_t * bytes ){
+        ASSERT( words != NULL );
+        ASSERT( bytes != NULL );
+
+        size_t length = 0;
+
+        for(size_t i = 0; i < count; ){
+
+            uint32_t word = words[i];
+            uint8_t type = getUmpMessageType(word);
+
+            // fast path for channel voice packets with valid status and data bytes: always write three bytes
+            // (there is room for four bytes per word) and only advance by the actual message length
+            if (type == UmpMessageTypeMidi1ChannelVoice && (word & 0x00808080) == 0x00800000 && (word & 0x00F00000) != 0x00F00000){
+                uint8_t status = (word >> 16) & 0xFF;
+
+                bytes[length] = status;
+                bytes[length+1] = (word >> 8) & 0xFF;
+                bytes[length+2] = word & 0xFF;
+
+                length += getMsgLen(status);
+                i++;
+                continue;
+            }
+
+            uint8_t wordCount = getUmpWordCount(word);
+
+            // incomplete packet
+            if (i + wordCount > count){
+                break;
+            }
+
+            if (type == UmpMessageTypeSystem || type == UmpMessageTypeMidi1ChannelVoice){
+
+                ShortMessage_t shortMsg;
+
+                if (unpackUmpShortMessage( &words[i], NULL, &shortMsg )){
+                    length += packShortMessage( &bytes[length], &shortMsg );
+                }
+            }
+            else if (type == UmpMessageTypeData64){
+
+                uint8_t status;
+                uint8_t n;
+
+                if (unpackUmpSysEx7( &words[i], NULL, &status, &bytes[length+1], &n )){
+
+                    if (status == UmpSysEx7Complete || status == UmpSysEx7Start){
+                        bytes[length++] = SystemMessageSystemExclusive;
+                    } else {
+                        // no initial byte, move data into place
+                        memmove( &bytes[length], &bytes[length+1], n );
+                    }
+
+                    length += n;
+
+                    if (status == UmpSysEx7Complete || status == UmpSysEx7End){
+                        bytes[length++] = SystemMessageEndOfExclusive;
+                    }
+                }
+            }
+
+            i += wordCount;
+        }
+
+        return length;
+    }
+
+#ifdef __cplusplus
+} // extern "C"
+} // namespace MidiMessage
+#endif
@@ -0,0 +1,108 @@
+#include "test.h"
+
+#include <midimessage/builders.h>
+#include <midimessage/packers.h>
+
+#include <cstring>
+
+using namespace MidiMessage;
+
+// evaluated at compile time (element access of std::array is not constexpr in C++11, thus checked at runtime)
+static constexpr std::array<uint8_t,3> noteOn = make<NoteOn>(0, 60, 100);
+static constexpr std::array<uint8_t,3> pitchBend = make<PitchBendChange>(15, 0x2001);
+static constexpr std::array<uint8_t,2> quarterFrame = make<MtcQuarterFrame>(7, 15);
+static constexpr std::array<uint8_t,6> gmSystemOn = make<GeneralMidi>(SysExDeviceIdBroadcast, SysExNonRtGmSystemOn1);
+
+template<size_t N>
+static bool equals( const std::array<uint8_t,N> & built, uint8_t * packed, size_t length ){
+    return length == N && memcmp( built.data(), packed, N ) == 0;
+}
+
+static void testConstants(void){
+    CHECK( noteOn == (std::array<uint8_t,3>{{ 0x90, 60, 100 }}) );
+    CHECK( pitchBend == (std::array<uint8_t,3>{{ 0xEF, 0x01, 0x40 }}) );
+    CHECK( quarterFrame == (std::array<uint8_t,2>{{ 0xF1, 0x7F }}) );
+    CHECK( gmSystemOn == (std::array<uint8_t,6>{{ 0xF0, 0x7E, 0x7F, 0x09, 0x01, 0xF7 }}) );
+}
+
+/**
+ * Builders must produce the same bytes as the packers for any valid arguments.
+ */
+static void testChannelMessages(void){
+    uint8_t bytes[16];
+
+    for(unsigned channel = 0; channel <= ChannelMask; channel++){
+        for(unsigned data1 = 0; data1 <= MaxU7; data1++){
+            for(unsigned data2 = 0; data2 <= MaxU7; data2 += 7){
+                CHECK( equals( make<NoteOff>(channel, data1, data2), bytes, packNoteOff( bytes, channel, data1, data2 ) ) );
+                CHECK( equals( make<NoteOn>(channel, data1, data2), bytes, packNoteOn( bytes, channel, data1, data2 ) ) );
+                CHECK( equals( make<PolyphonicKeyPressure>(channel, data1, data2), bytes, packPolyphonicKeyPressure( bytes, channel, data1, data2 ) ) );
+                CHECK( equals( make<ControlChange>(channel, data1, data2), bytes, packControlChange( bytes, channel, data1, data2 ) ) );
+            }
+
+            CHECK( equals( make<ProgramChange>(channel, data1), bytes, packProgramChange( bytes, channel, data1 ) ) );
+            CHECK( equals( make<ChannelPressure>(channel, data1), bytes, packChannelPressure( bytes, channel, data1 ) ) );
+        }
+
+        for(unsigned pitch = 0; pitch <= MaxU14; pitch += 13){
+            CHECK( equals( make<PitchBendChange>(channel, pitch), bytes, packPitchBendChange( bytes, channel, pitch ) ) );
+        }
+    }
+}
+
+static void testSystemMessages(void){
+    uint8_t bytes[16];
+
+    for(unsigned messageType = 0; messageType <= 7; messageType++){
+        for(unsigned nibble = 0; nibble <= NibbleMask; nibble++){
+            CHECK( equals( make<MtcQuarterFrame>(messageType, nibble), bytes, packMtcQuarterFrame( bytes, messageType, nibble ) ) );
+        }
+    }
+
+    for(unsigned position = 0; position <= MaxU14; position++){
+        CHECK( equals( make<SongPositionPointer>(position), bytes, packSongPositionPointer( bytes, position ) ) );
+    }
+
+    for(unsigned song = 0; song <= MaxU7; song++){
+        CHECK( equals( make<SongSelect>(song), bytes, packSongSelect( bytes, song ) ) );
+    }
+
+    const uint8_t systemMessages[] = { SystemMessageTuneRequest, SystemMessageTimingClock, SystemMessageStart, SystemMessageContinue, SystemMessageStop, SystemMessageActiveSensing, SystemMessageReset };
+
+    for(size_t i = 0; i < sizeof(systemMessages); i++){
+        CHECK( equals( make<SystemMessage>(systemMessages[i]), bytes, packSystemMessage( bytes, systemMessages[i] ) ) );
+    }
+}
+
+static void testSysExMessages(void){
+    uint8_t bytes[32];
+
+    for(unsigned deviceId = 0; deviceId <= MaxU7; deviceId++){
+
+        for(unsigned fps = 0; fps <= MtcFrameRate30fps; fps++){
+            for(unsigned hour = 0; hour <= MtcMaxHour; hour += 5){
+                CHECK( equals( make<MtcFullMessage>(deviceId, fps, hour, 59, 30, MtcMaxFps[fps]), bytes, packSysExRtMtcFullMessage( bytes, deviceId, fps, hour, 59, 30, MtcMaxFps[fps] ) ) );
+            }
+        }
+
+        const uint8_t gm[] = { SysExNonRtGmSystemOn1, SysExNonRtGmSystemOff, SysExNonRtGmSystemOn2 };
+
+        for(size_t i = 0; i < sizeof(gm); i++){
+            CHECK( equals( make<GeneralMidi>(deviceId, gm[i]), bytes, packSysExNonRtGeneralMidi( bytes, deviceId, gm[i] ) ) );
+        }
+
+        for(uint8_t command = SysExRtMmcCommandStop; command <= SysExRtMmcCommandMmcReset; command++){
+            CHECK( equals( make<MmcCommand>(deviceId, command), bytes, packSysExRtMmcCommandMessage( bytes, deviceId, &command, 1 ) ) );
+        }
+    }
+}
+
+int main(){
+
+    testConstants();
+    testChannelMessages();
+    testSystemMessages();
+    testSysExMessages();
+
+    return testResult();
+}
@@ -0,0 +1,213 @@
+#include "test.h"
+
+#include <midimessage/capture.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace MidiMessage;
+
+typedef struct {
+    uint64_t Time;
+    std::vector<uint8_t> Bytes;
+} Record_t;
+
+static std::vector<CaptureIndexEntry_t> captureIndex;
+
+static void indexAdd( CaptureIndexEntry_t * entry, void * ){
+    captureIndex.push_back(*entry);
+}
+
+/**
+ * Note on/offs (running status), (N)RPN selections with data entries, clocks, SysEx messages of growing length and a
+ * stray EOX.
+ */
+static std::vector<Record_t> generate(void){
+    std::vector<Record_t> records;
+
+    uint64_t time = 0;
+
+    for(uint8_t i = 0; i < 200; i++){
+        Record_t record;
+
+        // a few messages share their time
+        time += (i % 5 == 0) ? 0 : 1000000 + i;
+        record.Time = time;
+
+        switch(i % 8){
+            case 0:
+            case 1:
+                record.Bytes = { (uint8_t)(0x90 | ((i / 8) % 3)), (uint8_t)(i & DataMask), 100 };
+                break;
+            case 2:
+                record.Bytes = { (uint8_t)(0xB0 | (i % 16)), CcNonRegisteredParameterMSB, (uint8_t)(i & DataMask) };
+                break;
+            case 3:
+                record.Bytes = { (uint8_t)(0xB0 | (i % 16)), CcRegisteredParameterLSB, (uint8_t)((i >> 1) & DataMask) };
+                break;
+            case 4:
+                record.Bytes = { (uint8_t)(0xB0 | (i % 16)), CcDataEntryMSB, 64 };
+                break;
+            case 5:
+                record.Bytes = { SystemMessageTimingClock };
+                break;
+            case 6:
+                record.Bytes = { SystemMessageSystemExclusive, 0x7D };
+                for(uint8_t j = 0; j < i; j++){
+                    record.Bytes.push_back(j & DataMask);
+                }
+                record.Bytes.push_back(SystemMessageEndOfExclusive);
+                break;
+            default:
+                if (i == 7){
+                    // stray EOX, eg the end of a SysEx that did not fit the parser buffer
+                    record.Bytes = { SystemMessageEndOfExclusive };
+                    break;
+                }
+                record.Bytes = { (uint8_t)(0x80 | (i % 3)), (uint8_t)(i & DataMask), 0 };
+                break;
+        }
+
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+static std::vector<uint8_t> encode( std::vector<Record_t> & records ){
+    std::vector<uint8_t> capture(CaptureHeaderLength);
+
+    CaptureWriter_t writer;
+
+    captureIndex.clear();
+
+    CHECK( capturewriter_init( &writer, capture.data(), indexAdd, NULL ) == CaptureHeaderLength );
+
+    // several sync points
+    writer.SyncIntervalEvents = 16;
+
+    for(size_t i = 0; i < records.size(); i++){
+        uint8_t record[CaptureSyncMaxLength + VarIntMaxLength + 2 * 256];
+
+        size_t n = capturewriter_writeMessage( &writer, record, records[i].Time, records[i].Bytes.data(), records[i].Bytes.size() );
+        capture.insert( capture.end(), record, record + n );
+    }
+
+    std::vector<uint8_t> trailer(VarIntMaxLength + 1 + captureIndex.size() * CaptureIndexEntryLength + CaptureTrailerLength);
+
+    size_t n = capturewriter_finish( &writer, trailer.data(), captureIndex.data(), captureIndex.size() );
+    capture.insert( capture.end(), trailer.begin(), trailer.begin() + n );
+
+    return capture;
+}
+
+/**
+ * Reads all messages from the given offset (until the end marker).
+ */
+static std::vector<Record_t> decode( CaptureReader_t * reader, std::vector<uint8_t> & capture, size_t offset ){
+    std::vector<Record_t> records;
+
+    while( ! reader->Ended ){
+        uint64_t time;
+        uint8_t bytes[256];
+        size_t length;
+
+        size_t n = capturereader_read( reader, &capture[offset], capture.size() - offset, &time, bytes, sizeof(bytes), &length );
+
+        CHECK( n > 0 );
+        if (n == 0){
+            break;
+        }
+        offset += n;
+
+        if (length > 0){
+            records.push_back({ time, std::vector<uint8_t>(bytes, bytes + length) });
+        }
+    }
+
+    return records;
+}
+
+static void testEncodeDecode(void){
+    std::vector<Record_t> records = generate();
+    std::vector<uint8_t> capture = encode( records );
+
+    CHECK( captureIndex.size() > 4 );
+    CHECK( memcmp( capture.data(), CaptureHeader, CaptureHeaderLength ) == 0 );
+
+    CaptureReader_t reader;
+    capturereader_init( &reader );
+
+    std::vector<Record_t> decoded = decode( &reader, capture, CaptureHeaderLength );
+
+    CHECK( decoded.size() == records.size() );
+
+    for(size_t i = 0; i < records.size() && i < decoded.size(); i++){
+        CHECK( decoded[i].Time == records[i].Time );
+        CHECK( decoded[i].Bytes == records[i].Bytes );
+    }
+
+    // truncated records are incomplete (not invalid)
+    capturereader_init( &reader );
+    uint64_t time;
+    uint8_t bytes[256];
+    size_t length;
+    size_t n = capturereader_read( &reader, &capture[CaptureHeaderLength], 1, &time, bytes, sizeof(bytes), &length );
+    CHECK( n == 0 );
+    CHECK( ! capturereader_isInvalid( &reader, &capture[CaptureHeaderLength], 1, sizeof(bytes) ) );
+}
+
+static void testSeek(void){
+    std::vector<Record_t> records = generate();
+    std::vector<uint8_t> capture = encode( records );
+
+    uint64_t end = records.back().Time;
+
+    for(uint64_t time = 0; time <= end + 2000000; time += 333333){
+
+        // first message at or after time
+        size_t first = 0;
+        while (first < records.size() && records[first].Time < time){
+            first++;
+        }
+
+        CaptureReader_t reader;
+        size_t offset = capture_seek( &reader, capture.data(), capture.size(), time );
+
+        CHECK( offset >= CaptureHeaderLength );
+        if (offset == 0){
+            continue;
+        }
+
+        // parameter state as if read from the beginning
+        CaptureParameter_t parameters[16];
+        capture_resetParameters( parameters );
+        for(size_t i = 0; i < first; i++){
+            capture_updateParameters( parameters, records[i].Bytes[0], records[i].Bytes.data() + 1 );
+        }
+        CHECK( memcmp( parameters, reader.Parameters, sizeof(parameters) ) == 0 );
+
+        std::vector<Record_t> decoded = decode( &reader, capture, offset );
+
+        CHECK( decoded.size() == records.size() - first );
+
+        for(size_t i = 0; i < decoded.size() && first + i < records.size(); i++){
+            CHECK( decoded[i].Time == records[first + i].Time );
+            CHECK( decoded[i].Bytes == records[first + i].Bytes );
+        }
+    }
+
+    // a capture without valid trailer can not be seeked
+    capture.back() ^= 0xFF;
+
+    CaptureReader_t reader;
+    CHECK( capture_seek( &reader, capture.data(), capture.size(), 0 ) == 0 );
+}
+
+int main(){
+
+    testEncodeDecode();
+    testSeek();
+
+    return testResult();
+}
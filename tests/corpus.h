@@ -0,0 +1,258 @@
+/**
+ * \file
+ *
+ * Corpus of messages shared by the regression tests: command line (as accepted by MessagefromString()), packed
+ * bytes (hex) and the string the unpacked message is formatted to (by MessagetoString()).
+ *
+ * Recorded with the original (sprintf based) stringifier, with the message's SysEx.ByteData zeroed before unpacking
+ * (text of cueing messages is not terminated otherwise). Only the quarter frame messages and the device id of the
+ * extended sample dump header and loop point messages differ, as their packing and unpacking were corrected since.
+ */
+
+#ifndef MIDIMESSAGE_TEST_CORPUS_H
+#define MIDIMESSAGE_TEST_CORPUS_H
+
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <vector>
+
+#include <midimessage/midimessage.h>
+
+using namespace MidiMessage;
+
+typedef struct {
+    const char * Command;
+    const char * Bytes;
+    const char * String;
+} CorpusEntry_t;
+
+static const CorpusEntry_t Corpus[] = {
+    { "note on 0 60 100", "903C64", "note on 0 60 100" },
+    { "note off 15 127 0", "8F7F00", "note off 15 127 0" },
+    { "note on 3 0 1", "930001", "note on 3 0 1" },
+    { "cc 1 7 127", "B1077F", "cc 1 7 127" },
+    { "cc 9 0 0", "B90000", "cc 9 0 0" },
+    { "pc 2 5", "C205", "pc 2 5" },
+    { "pc 15 127", "CF7F", "pc 15 127" },
+    { "pressure 4 64", "D440", "pressure 4 64" },
+    { "pitch 5 8192", "E50040", "pitch 5 8192" },
+    { "pitch 0 0", "E00000", "pitch 0 0" },
+    { "pitch 15 16383", "EF7F7F", "pitch 15 16383" },
+    { "poly 6 60 30", "A63C1E", "poly 6 60 30" },
+    { "start", "FA", "start" },
+    { "stop", "FC", "stop" },
+    { "continue", "FB", "continue" },
+    { "reset", "FF", "reset" },
+    { "active-sensing", "FE", "active-sensing" },
+    { "tune-request", "F6", "tune-request" },
+    { "timing-clock", "F8", "timing-clock" },
+    { "quarter-frame 0 0", "F100", "quarter-frame 0 0" },
+    { "quarter-frame 7 15", "F17F", "quarter-frame 7 15" },
+    { "quarter-frame 3 9", "F139", "quarter-frame 3 9" },
+    { "song-position 1000", "F26807", "song-position 1000" },
+    { "song-position 16383", "F27F7F", "song-position 16383" },
+    { "song-select 12", "F30C", "song-select 12" },
+    { "sysex experimental 1337", "F07D1337F7", "sysex experimental 1337" },
+    { "sysex experimental 00010203040506070809", "F07D00010203040506070809F7", "sysex experimental 00010203040506070809" },
+    { "sysex experimental", "F07DF7", "sysex experimental " },
+    { "sysex manufacturer 41 0102030405", "F00000410102030405F7", "sysex manufacturer 000041 0102030405" },
+    { "sysex manufacturer 002100 7f7e", "F00021007F7EF7", "sysex manufacturer 002100 7f7e" },
+    { "sysex nonrt 1 eof 3", "F07E017B03F7", "sysex nonrt 1 eof 123" },
+    { "sysex nonrt 127 wait 0", "F07E7F7C00F7", "sysex nonrt 127 wait 124" },
+    { "sysex nonrt 2 cancel 9", "F07E027D09F7", "sysex nonrt 2 cancel 125" },
+    { "sysex nonrt 3 nak 4", "F07E037E04F7", "sysex nonrt 3 nak 126" },
+    { "sysex nonrt 4 ack 127", "F07E047F7FF7", "sysex nonrt 4 ack 127" },
+    { "sysex nonrt 1 gm system-on1", "F07E010901F7", "sysex nonrt 1 gm system-on1" },
+    { "sysex nonrt 1 gm system-off", "F07E010902F7", "sysex nonrt 1 gm system-off" },
+    { "sysex nonrt 127 gm system-on2", "F07E7F0903F7", "sysex nonrt 127 gm system-on2" },
+    { "sysex rt 1 cds 3 channel-pressure 1 2 3 4", "F07F0109010301020304F7", "sysex rt 1 cds 3 channel-pressure 1 2 3 4" },
+    { "sysex rt 1 cds 4 cc 7 1 2", "F07F01090304070102F7", "sysex rt 1 cds 4 cc 7 1 2" },
+    { "sysex rt 1 keys 3 60 7 100 10 64", "F07F010A01033C07640A40F7", "sysex rt 1 keys 3 60 7 100 10 64" },
+    { "sysex rt 1 dc master-volume 1000", "F07F0104016807F7", "sysex rt 1 master-volume 1000" },
+    { "sysex rt 1 dc master-balance 8192", "F07F0104020040F7", "sysex rt 1 master-balance 8192" },
+    { "sysex rt 2 dc coarse-tuning 0", "F07F0204040000F7", "sysex rt 2 coarse-tuning 0" },
+    { "sysex rt 3 dc fine-tuning 16383", "F07F0304037F7FF7", "sysex rt 3 fine-tuning 16383" },
+    { "sysex rt 1 dc global-parameter 1 1 1 10 01 02", "F07F010405010101000A0102F7", "sysex rt 1 global-parameter-control 1 1 1 10 01 02" },
+    { "sysex rt 1 mtc full-message 25 1 2 3 4", "F07F01010121020304F7", "sysex rt 1 mtc full-message 25 1 2 3 4" },
+    { "sysex rt 1 mtc full-message 30 23 59 59 29", "F07F010101773B3B1DF7", "sysex rt 1 mtc full-message 30 23 59 59 29" },
+    { "sysex rt 1 mtc full-message 24 0 0 0 0", "F07F01010100000000F7", "sysex rt 1 mtc full-message 24 0 0 0 0" },
+    { "sysex rt 1 mtc full-message 29.97 10 20 30 15", "F07F0101014A141E0FF7", "sysex rt 1 mtc full-message 29.97 10 20 30 15" },
+    { "sysex rt 1 mtc user-bits 0102030405", "F07F010102040003000200010001F7", "sysex rt 1 mtc user-bits 0102030401" },
+    { "sysex nonrt 1 cueing special time-code-offset", "F07E01040000000000000000F7", "sysex nonrt 1 cueing special time-code-offset" },
+    { "sysex nonrt 1 cueing special enable-event-list", "F07E01040000000000000100F7", "sysex nonrt 1 cueing special enable-event-list" },
+    { "sysex nonrt 1 cueing special disable-event-list", "F07E01040000000000000200F7", "sysex nonrt 1 cueing special disable-event-list" },
+    { "sysex nonrt 1 cueing special clear-event-list", "F07E01040000000000000300F7", "sysex nonrt 1 cueing special clear-event-list" },
+    { "sysex nonrt 1 cueing special system-stop", "F07E01040000000000000400F7", "sysex nonrt 1 cueing special system-stop" },
+    { "sysex nonrt 1 cueing special event-list-request", "F07E01040000000000000500F7", "sysex nonrt 1 cueing special event-list-request" },
+    { "sysex nonrt 1 cueing punch-in add 25 1 2 3 4 5 100", "F07E01040121020304056400F7", "sysex nonrt 1 cueing punch-in add 25 1 2 3 4 5 100" },
+    { "sysex nonrt 1 cueing punch-out rm 30 1 2 3 4 5 101", "F07E01040461020304056500F7", "sysex nonrt 1 cueing punch-out rm 30 1 2 3 4 5 101" },
+    { "sysex nonrt 1 cueing event-start add 25 1 2 3 4 5 102", "F07E01040521020304056600F7", "sysex nonrt 1 cueing event-start add 25 1 2 3 4 5 102" },
+    { "sysex nonrt 1 cueing event-stop rm 24 1 2 3 4 5 103 stop here", "F07E01040A01020304056700F7", "sysex nonrt 1 cueing event-stop rm 24 1 2 3 4 5 103" },
+    { "sysex nonrt 1 cueing cue-point add 29.97 1 2 3 4 5 104 cue", "F07E01040C41020304056800030605070506F7", "sysex nonrt 1 cueing cue-point add 29.97 1 2 3 4 5 104 cue" },
+    { "sysex nonrt 1 cueing event-name - 25 1 2 3 4 5 105 my event", "F07E01040E210203040569000D06090700020506060705060E060407F7", "sysex nonrt 1 cueing event-name 25 1 2 3 4 5 105 my event" },
+    { "sysex rt 1 cueing special system-stop", "F07F0105000400F7", "sysex rt 1 cueing special system-stop" },
+    { "sysex rt 1 cueing punch-in 10", "F07F0105010A00F7", "sysex rt 1 cueing punch-in 10" },
+    { "sysex rt 1 cueing punch-out 11", "F07F0105020B00F7", "sysex rt 1 cueing punch-out 11" },
+    { "sysex rt 1 cueing event-start 12", "F07F0105050C00F7", "sysex rt 1 cueing event-start 12" },
+    { "sysex rt 1 cueing event-stop 13 stop", "F07F0105080D00030704070F060007F7", "sysex rt 1 cueing event-stop 13 stop" },
+    { "sysex rt 1 cueing cue-point 14 point", "F07F01050C0E0000070F0609060E060407F7", "sysex rt 1 cueing cue-point 14 point" },
+    { "sysex rt 1 cueing event-name 15 the name", "F07F01050E0F0004070806050600020E0601060D060506F7", "sysex rt 1 cueing event-name 15 the name" },
+    { "sysex rt 1 msc sound all-off", "F07F01021008F7", "sysex rt 1 msc sound all-off" },
+    { "sysex rt 1 msc lighting restore", "F07F01020109F7", "sysex rt 1 msc lighting restore" },
+    { "sysex rt 1 msc sound fire 5", "F07F0102100705F7", "sysex rt 1 msc sound fire 5" },
+    { "sysex rt 1 msc sound set 10 20 25 1 2 3 4 5", "F07F010210060A0014000102030405F7", "sysex rt 1 msc sound set 10 20 24 1 2 3 4 5" },
+    { "sysex rt 1 mcc stop", "F07F010601F7", "sysex rt 1 mcc stop" },
+    { "sysex rt 1 mcc play", "F07F010602F7", "sysex rt 1 mcc play" },
+    { "sysex rt 1 mcc stop play pause", "F07F0106010209F7", "sysex rt 1 mcc stop play pause" },
+    { "sysex rt 1 mcc deferred-play", "F07F010603F7", "sysex rt 1 mcc deferred-play" },
+    { "sysex rt 1 mcc fast-forward rewind eject", "F07F010604050AF7", "sysex rt 1 mcc fast-forward rewind eject" },
+    { "sysex rt 1 mcc record-strobe record-exit record-pause", "F07F0106060708F7", "sysex rt 1 mcc record-strobe record-exit record-pause" },
+    { "sysex rt 1 mcc chase command-error-reset mmc-reset", "F07F01060B0C0DF7", "sysex rt 1 mcc chase command-error-reset mmc-reset" },
+    { "sysex rt 1 mcc step 3", "F07F0106480103F7", "sysex rt 1 mcc step 3" },
+    { "sysex rt 1 mcc step -3", "F07F010648017DF7", "sysex rt 1 mcc step -3" },
+    { "sysex rt 1 mcc assign-system-master 5", "F07F0106490105F7", "sysex rt 1 mcc assign-system-master 5" },
+    { "sysex rt 1 mcc variable-play 1.5", "F07F01064503014000F7", "sysex rt 1 mcc variable-play 1.500000" },
+    { "sysex rt 1 mcc shuttle -2.25", "F07F01064703422000F7", "sysex rt 1 mcc shuttle -2.250000" },
+    { "sysex rt 1 mpc vibrator 1 reset", "F07F010C00020102F7", "sysex rt 1 mpc vibrator 1 reset" },
+    { "sysex rt 1 mpc led 2 on", "F07F010C00030203F7", "sysex rt 1 mpc led 2 on" },
+    { "sysex rt 1 mpc display 3 off", "F07F010C00040304F7", "sysex rt 1 mpc display 3 off" },
+    { "sysex rt 1 mpc keypad 1 follow-midi-channels 1 10 20 2 30 40", "F07F010C00050105010A14021E28F7", "sysex rt 1 mpc keypad 1 follow-midi-channels 1 10 20 2 30 40" },
+    { "sysex nonrt 1 sds-header 1 8 1000 2000 100 200 uni-forward", "F07E0101010008680700500F0064000048010000F7", "sysex nonrt 1 sds-header 1 8 1000 2000 100 200 uni-forward" },
+    { "sysex nonrt 1 sds-header 2 16 20000 100000 0 99999 bi-forward", "F07E0101020010201C01200D060000001F0D0601F7", "sysex nonrt 1 sds-header 2 16 20000 100000 0 99999 bi-forward" },
+    { "sysex nonrt 1 sds-request 100", "F07E01036400F7", "sysex nonrt 1 sds-request 100" },
+    { "sysex nonrt 1 sds-data 3 0102030405", "F07E01020301020304057FF7", "sysex nonrt 1 sds-data 3 0102030405 7F 7F" },
+    { "sysex nonrt 1 sds-ext loop-point-tx 1 2 uni-forward 100 200", "F07E0105010100020000640000480100F7", "sysex nonrt 1 sds-ext loop-point-tx 1 2 uni-forward 100 200" },
+    { "sysex nonrt 1 sds-ext loop-point-request 1 2", "F07E01050201000200F7", "sysex nonrt 1 sds-ext loop-point-request 1 2" },
+    { "sysex nonrt 1 sds-ext ext-header 1 16 44100 0 1000000 0 999999 uni-forward", "F07E010505010010445802000000000040043D000000000000003F043D00000000F7", "sysex nonrt 1 sds-ext ext-header 1 16 44100 0 1000000 0 999999 uni-forward" },
+    { "sysex nonrt 1 sds-ext ext-loop-point-tx 1 2 bi-backward 100 200", "F07E010506010002004164000000004801000000F7", "sysex nonrt 1 sds-ext ext-loop-point-tx 1 2 bi-backward 100 200" },
+    { "sysex nonrt 1 sds-ext ext-loop-point-request 3 4", "F07E01050703000400F7", "sysex nonrt 1 sds-ext ext-loop-point-request 3 4" },
+    { "sysex nonrt 1 sds-ext name-tx 5 - sample name", "F07E0105030500000B73616D706C65206E616D65F7", "sysex nonrt 1 sds-ext name-tx 5 - sample name" },
+    { "sysex nonrt 1 sds-ext name-request 6", "F07E0105040600F7", "sysex nonrt 1 sds-ext name-request 6" },
+    { "sysex nonrt 1 mvc on-off 01", "F07E010C0110000001F7", "sysex nonrt 1 mvc on-off 01" },
+    { "sysex nonrt 1 mvc playback-assign-msn 0102", "F07E010C011010000102F7", "sysex nonrt 1 mvc playback-assign-msn 0102" },
+    { "sysex nonrt 1 mvc fx1-assign-lsn 03", "F07E010C0110200103F7", "sysex nonrt 1 mvc fx1-assign-lsn 03" },
+    { "sysex nonrt 1 mvc playback-speed-range 7f", "F07E010C011030017FF7", "sysex nonrt 1 mvc playback-speed-range 7f" },
+    { "sysex nonrt 1 file-dump request 2 MIDI song.mid", "F07E010703024D494449736F6E672E6D6964F7", "sysex nonrt 1 file-dump request 2 MIDI song.mid" },
+    { "sysex nonrt 1 file-dump header 2 TEXT 1000 readme.txt", "F07E010701025445585468070000726561646D652E747874F7", "sysex nonrt 1 file-dump header 2 TEXT 1000 readme.txt" },
+    { "sysex nonrt 1 file-dump data 3 01020304", "F07E0107020304000102030479F7", "sysex nonrt 1 file-dump data 3 01020304 79 79" },
+    { "sysex rt 1 notation bar-number not-running", "F07F0103010040F7", "sysex rt 1 notation not-running" },
+    { "sysex rt 1 notation bar-number running-unknown", "F07F0103017F3FF7", "sysex rt 1 notation running-unknown" },
+    { "sysex rt 1 notation bar-number 100", "F07F0103016400F7", "sysex rt 1 notation 100" },
+    { "sysex rt 1 notation bar-number -5", "F07F0103017B7FF7", "sysex rt 1 notation -5" },
+    { "sysex rt 1 notation time-signature immediate 24 8 4 4", "F07F0103020404041808F7", "sysex rt 1 notation time-signature immediate 24 8 4 4" },
+    { "sysex rt 1 notation time-signature delayed 24 8 6 8 3 4", "F07F01030306060818080304F7", "sysex rt 1 notation time-signature delayed 24 8 6 8 3 4" },
+};
+
+static const size_t CorpusLength = sizeof(Corpus) / sizeof(Corpus[0]);
+
+/**
+ * Decodes the packed bytes of the given entry, returns their count.
+ */
+inline size_t corpusBytes( const CorpusEntry_t & entry, uint8_t * bytes ){
+    size_t length = strlen(entry.Bytes) / 2;
+
+    for(size_t i = 0; i < length; i++){
+        unsigned int byte;
+        sscanf( &entry.Bytes[2*i], "%2X", &byte );
+        bytes[i] = (uint8_t)byte;
+    }
+
+    return length;
+}
+
+/**
+ * Tells wether the entry is a MIDI Show Control message (their unpacking requires the cue number buffers to be set).
+ */
+inline bool corpusIsMsc( const CorpusEntry_t & entry ){
+    return strncmp( entry.Bytes, "F07F", 4 ) == 0 && strncmp( &entry.Bytes[6], "02", 2 ) == 0;
+}
+
+static uint32_t corpusSeed = 1;
+
+inline uint32_t corpusRandom( uint32_t max ){
+    corpusSeed = corpusSeed * 1103515245 + 12345;
+    return ((corpusSeed >> 16) & 0x7fff) % max;
+}
+
+/**
+ * Generates a stream of corpus messages (but MSC) with omitted running status, interleaved real time messages, stray
+ * data bytes, truncated messages and experimental SysEx messages of up to the given length (< 1000).
+ */
+inline std::vector<uint8_t> corpusStream( size_t messageCount, size_t maxSysExLength ){
+
+    std::vector<uint8_t> stream;
+    uint8_t bytes[1024];
+    uint8_t status = 0;
+
+    for(size_t m = 0; m < messageCount; m++){
+
+        size_t length;
+
+        switch( corpusRandom(10) ){
+
+            // stray data bytes
+            case 0:
+                length = 1 + corpusRandom(3);
+                for(size_t i = 0; i < length; i++){
+                    bytes[i] = corpusRandom(128);
+                }
+                break;
+
+            // experimental SysEx, optionally terminated by the next status byte
+            case 1:
+                length = corpusRandom(maxSysExLength);
+                bytes[0] = SystemMessageSystemExclusive;
+                bytes[1] = SysExIdExperimental_Byte;
+                for(size_t i = 0; i < length; i++){
+                    bytes[2 + i] = corpusRandom(128);
+                }
+                length += 2;
+                if (corpusRandom(2)){
+                    bytes[length++] = SystemMessageEndOfExclusive;
+                }
+                break;
+
+            default: {
+                const CorpusEntry_t & entry = Corpus[ corpusRandom(CorpusLength) ];
+                if (corpusIsMsc(entry)){
+                    m--;
+                    continue;
+                }
+                length = corpusBytes( entry, bytes );
+
+                // truncated channel message
+                if (length > 1 && isRunningStatus(bytes[0]) && corpusRandom(8) == 0){
+                    length--;
+                }
+
+                // SysEx terminated by another status byte
+                if (bytes[0] == SystemMessageSystemExclusive && corpusRandom(8) == 0){
+                    bytes[length - 1] = SystemMessageTuneRequest;
+                }
+            }
+        }
+
+        size_t offset = 0;
+
+        // omit repeated running status
+        if (isRunningStatus(bytes[0]) && bytes[0] == status && corpusRandom(2)){
+            offset = 1;
+        }
+        if (isControlByte(bytes[0]) && !isSystemRealTimeMessage(bytes[0])){
+            status = bytes[0];
+        }
+
+        for(size_t i = offset; i < length; i++){
+            // interleaved real time message
+            if (corpusRandom(32) == 0){
+                stream.push_back( SystemMessageTimingClock );
+            }
+            stream.push_back( bytes[i] );
+        }
+    }
+
+    return stream;
+}
+
+#endif //MIDIMESSAGE_TEST_CORPUS_H
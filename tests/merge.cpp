@@ -0,0 +1,167 @@
+#include "test.h"
+
+#include <midimessage/merge.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace MidiMessage;
+
+typedef struct {
+    uint64_t Time;
+    size_t Source;
+    std::vector<uint8_t> Bytes; // as packed by merge_packEvent()
+} Expected_t;
+
+/**
+ * Merges all tracks of the given file and compares the events (and their order) with the expected ones.
+ */
+static void merge( uint8_t * data, size_t length, size_t trackCount, bool runningStatus, std::vector<Expected_t> & expected ){
+    std::vector<MergeSmfCursor_t> cursors(trackCount);
+    std::vector<MergeSource_t> sources(trackCount);
+    std::vector<size_t> heap(trackCount);
+
+    size_t offset = 0;
+
+    for(size_t i = 0; i < trackCount; i++){
+        CHECK( mergesmf_init( &cursors[i], data, length, &offset, false ) == SmfResultOk );
+        sources[i].Next = mergesmf_next;
+        sources[i].Cursor = &cursors[i];
+    }
+
+    Merger_t merger;
+    merger_init( &merger, sources.data(), trackCount, heap.data(), runningStatus );
+
+    MergeEvent_t event;
+    size_t i = 0;
+    uint64_t time = 0;
+
+    while( merger_next( &merger, &event ) ){
+
+        CHECK( event.Time >= time );
+        time = event.Time;
+
+        CHECK( i < expected.size() );
+        if (i >= expected.size()){
+            break;
+        }
+
+        Expected_t & e = expected[i++];
+
+        uint8_t bytes[256];
+        size_t len = merge_packEvent( bytes, &event );
+
+        CHECK( event.Time == e.Time );
+        CHECK( event.Source == e.Source );
+        CHECK( std::vector<uint8_t>(bytes, bytes + len) == e.Bytes );
+    }
+
+    CHECK( i == expected.size() );
+}
+
+/**
+ * Tracks of pseudo-random (frequently equal) event times, events of equal time must be ordered by track.
+ */
+static void testOrder(void){
+    const size_t trackCount = 7;
+    const size_t eventCount = 100;
+
+    static uint8_t buffer[trackCount * (8 + eventCount * (SmfVarLenMaxLength + 3)) + 256];
+    SmfWriter_t writer;
+
+    CHECK( smfwriter_init( &writer, buffer, sizeof(buffer), SmfFormatMultiTrack, trackCount, 96 ) );
+
+    std::vector<Expected_t> expected;
+    uint32_t seed = 1;
+
+    for(size_t t = 0; t < trackCount; t++){
+        CHECK( smfwriter_beginTrack( &writer ) );
+
+        uint64_t time = 0;
+
+        for(size_t i = 0; i < eventCount; i++){
+            seed = seed * 1103515245 + 12345;
+
+            uint32_t delta = (seed >> 16) % 4;
+            time += delta;
+
+            // running status within the track, distinct statuses across tracks
+            uint8_t msg[] = { (uint8_t)(0x90 | t), (uint8_t)(i & DataMask), 100 };
+            CHECK( smfwriter_writeEvent( &writer, delta, msg[0], &msg[1], 2 ) );
+
+            expected.push_back({ time, t, std::vector<uint8_t>(msg, msg + sizeof(msg)) });
+        }
+
+        CHECK( smfwriter_endTrack( &writer, 0 ) );
+    }
+
+    // (stable) order by time and track
+    std::stable_sort( expected.begin(), expected.end(), [](const Expected_t & a, const Expected_t & b){
+        return a.Time < b.Time || (a.Time == b.Time && a.Source < b.Source);
+    });
+
+    merge( buffer, writer.Length, trackCount, false, expected );
+
+    // with running status, the status of consecutive events of the same track is omitted
+    for(size_t i = expected.size() - 1; i > 0; i--){
+        if (expected[i].Bytes[0] == expected[i - 1].Bytes[0]){
+            expected[i].Bytes.erase( expected[i].Bytes.begin() );
+        }
+    }
+
+    merge( buffer, writer.Length, trackCount, true, expected );
+}
+
+/**
+ * A SysEx split into packets is kept together, events of other tracks due in the meantime follow after.
+ */
+static void testSysExPackets(void){
+    uint8_t buffer[256];
+    SmfWriter_t writer;
+
+    CHECK( smfwriter_init( &writer, buffer, sizeof(buffer), SmfFormatMultiTrack, 2, 96 ) );
+
+    uint8_t noteOn0[] = { 60, 100 };
+    uint8_t noteOff0[] = { 60, 0 };
+    uint8_t packet0[] = { 0x7D, 1, 2 };
+    uint8_t packet1[] = { 3, 4, SystemMessageEndOfExclusive };
+
+    CHECK( smfwriter_beginTrack( &writer ) );
+    CHECK( smfwriter_writeEvent( &writer, 0, 0x90, noteOn0, sizeof(noteOn0) ) );
+    CHECK( smfwriter_writeEvent( &writer, 10, SystemMessageSystemExclusive, packet0, sizeof(packet0) ) );
+    CHECK( smfwriter_writeEvent( &writer, 20, SystemMessageEndOfExclusive, packet1, sizeof(packet1) ) );
+    CHECK( smfwriter_writeEvent( &writer, 10, 0x80, noteOff0, sizeof(noteOff0) ) );
+    CHECK( smfwriter_endTrack( &writer, 0 ) );
+
+    uint8_t noteOn1[] = { 61, 100 };
+    uint8_t cc1[] = { 7, 127 };
+    uint8_t noteOff1[] = { 61, 0 };
+
+    CHECK( smfwriter_beginTrack( &writer ) );
+    CHECK( smfwriter_writeEvent( &writer, 0, 0x91, noteOn1, sizeof(noteOn1) ) );
+    CHECK( smfwriter_writeEvent( &writer, 20, 0xB1, cc1, sizeof(cc1) ) );
+    CHECK( smfwriter_writeEvent( &writer, 20, 0x81, noteOff1, sizeof(noteOff1) ) );
+    CHECK( smfwriter_writeEvent( &writer, 10, 0x81, noteOff1, sizeof(noteOff1) ) );
+    CHECK( smfwriter_endTrack( &writer, 0 ) );
+
+    std::vector<Expected_t> expected = {
+        { 0, 0, { 0x90, 60, 100 } },
+        { 0, 1, { 0x91, 61, 100 } },
+        { 10, 0, { SystemMessageSystemExclusive, 0x7D, 1, 2 } },
+        { 30, 0, { 3, 4, SystemMessageEndOfExclusive } },
+        { 30, 1, { 0xB1, 7, 127 } }, // due at 20, but held back by the SysEx
+        { 40, 0, { 0x80, 60, 0 } },
+        { 40, 1, { 0x81, 61, 0 } },
+        { 50, 1, { 61, 0 } }, // running status
+    };
+
+    merge( buffer, writer.Length, 2, true, expected );
+}
+
+int main(){
+
+    testOrder();
+    testSysExPackets();
+
+    return testResult();
+}
@@ -0,0 +1,173 @@
+#include "test.h"
+
+#include <midimessage/midimessage.h>
+
+#include <cstring>
+
+using namespace MidiMessage;
+
+static size_t findControlByteScalar( uint8_t * bytes, size_t len ){
+    for(size_t i = 0; i < len; i++){
+        if (isControlByte(bytes[i])){
+            return i;
+        }
+    }
+    return len;
+}
+
+/**
+ * findControlByte() must find the first control byte like a scalar loop, at any alignment, length and position
+ * (including none or several control bytes).
+ */
+static void testFindControlByte(void){
+
+    alignas(64) uint8_t bytes[512];
+
+    for(size_t i = 0; i < sizeof(bytes); i++){
+        bytes[i] = (i * 37) & DataMask;
+    }
+
+    for(size_t offset = 0; offset < 64; offset++){
+        for(size_t len = 0; len <= 160; len++){
+            for(size_t pos = 0; pos <= len; pos++){
+
+                // a control byte at pos (if within len), another one later on and one just before the scanned bytes
+                if (pos < len){
+                    bytes[offset + pos] = 0x80 | (pos & DataMask);
+                }
+                if (pos + 7 < len){
+                    bytes[offset + pos + 7] = SystemMessageEndOfExclusive;
+                }
+                if (offset > 0){
+                    bytes[offset - 1] = SystemMessageSystemExclusive;
+                }
+                bytes[offset + len] = SystemMessageSystemExclusive;
+
+                CHECK( findControlByte( &bytes[offset], len ) == findControlByteScalar( &bytes[offset], len ) );
+
+                for(size_t i = (offset > 0 ? offset - 1 : 0); i <= offset + len; i++){
+                    bytes[i] = (i * 37) & DataMask;
+                }
+            }
+        }
+    }
+}
+
+static uint32_t seed = 1;
+
+static uint8_t randomByte(void){
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) & 0xff;
+}
+
+/**
+ * Block converters must produce the same bytes as the scalar ones (as originally implemented), for any length and
+ * alignment.
+ */
+static void testBlockConverters(void){
+
+    static uint8_t src[1024 + 16];
+    static uint8_t expected[2048];
+    static uint8_t actual[2048 + 16];
+
+    for(size_t length = 0; length <= 600; length++){
+
+        size_t offset = length % 16;
+
+        for(size_t i = 0; i < length; i++){
+            src[offset + i] = randomByte();
+        }
+
+        size_t n = nibblize( expected, &src[offset], length );
+        CHECK( nibblizeBlock( &actual[offset], &src[offset], length ) == n && memcmp( expected, &actual[offset], n ) == 0 );
+
+        n = sevenbitize( expected, &src[offset], length );
+        CHECK( sevenbitizeBlock( &actual[offset], &src[offset], length ) == n && memcmp( expected, &actual[offset], n ) == 0 );
+
+        // arbitrary data bytes as (de-)converter input (a final group of a single byte is invalid)
+        for(size_t i = 0; i < length; i++){
+            src[offset + i] &= DataMask;
+        }
+
+        if (length % 2 == 0){
+            n = denibblize( expected, &src[offset], length );
+            CHECK( denibblizeBlock( &actual[offset], &src[offset], length ) == n && memcmp( expected, &actual[offset], n ) == 0 );
+        }
+
+        if (length % 8 != 1){
+            n = desevenbitize( expected, &src[offset], length );
+            CHECK( desevenbitizeBlock( &actual[offset], &src[offset], length ) == n && memcmp( expected, &actual[offset], n ) == 0 );
+        }
+    }
+}
+
+/**
+ * Streaming converters must produce the same bytes as the scalar ones, no matter how the source is chunked.
+ */
+static void testStreamConverters(void){
+
+    static uint8_t src[1024];
+    static uint8_t expected[2048];
+    static uint8_t actual[2048];
+
+    for(size_t length = 0; length <= 600; length++){
+
+        for(size_t i = 0; i < length; i++){
+            src[i] = randomByte() & DataMask;
+        }
+
+        for(size_t maxChunk = 1; maxChunk <= 20; maxChunk += 3){
+
+            ConverterState_t sevenbitizer, desevenbitizer, denibblizer;
+            converter_reset( &sevenbitizer );
+            converter_reset( &desevenbitizer );
+            converter_reset( &denibblizer );
+
+            size_t sevenbitized = 0;
+            size_t desevenbitized = 0;
+            size_t denibblized = 0;
+
+            static uint8_t sevenbitizedBytes[2048];
+            static uint8_t denibblizedBytes[1024];
+
+            for(size_t i = 0; i < length; ){
+                size_t chunk = 1 + randomByte() % maxChunk;
+                if (chunk > length - i){
+                    chunk = length - i;
+                }
+
+                sevenbitized += sevenbitizeStream( &sevenbitizer, &sevenbitizedBytes[sevenbitized], &src[i], chunk );
+                desevenbitized += desevenbitizeStream( &desevenbitizer, &actual[desevenbitized], &src[i], chunk );
+                denibblized += denibblizeStream( &denibblizer, &denibblizedBytes[denibblized], &src[i], chunk );
+
+                i += chunk;
+            }
+
+            sevenbitized += sevenbitizeFlush( &sevenbitizer, &sevenbitizedBytes[sevenbitized] );
+
+            size_t n = sevenbitize( expected, src, length );
+            CHECK( sevenbitized == n && memcmp( expected, sevenbitizedBytes, n ) == 0 );
+
+            if (length % 8 != 1){
+                desevenbitized += desevenbitizeFlush( &desevenbitizer, &actual[desevenbitized] );
+
+                n = desevenbitize( expected, src, length );
+                CHECK( desevenbitized == n && memcmp( expected, actual, n ) == 0 );
+            }
+
+            // (a final single nibble is dropped)
+            n = denibblize( expected, src, length - length % 2 );
+            CHECK( denibblized == n && memcmp( expected, denibblizedBytes, n ) == 0 );
+        }
+    }
+}
+
+int main(){
+
+    testFindControlByte();
+
+    testBlockConverters();
+    testStreamConverters();
+
+    return testResult();
+}
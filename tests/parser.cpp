@@ -0,0 +1,329 @@
+#include "test.h"
+#include "corpus.h"
+
+#include <midimessage/parser.h>
+#include <midimessage/basicparser.h>
+#include <midimessage/packers.h>
+#include <midimessage/stringifier.h>
+
+#include <string>
+#include <vector>
+
+using namespace MidiMessage;
+
+/**
+ * Log of handler calls, each entry is either a (re-packed) message or discarded data.
+ */
+typedef std::vector<std::vector<uint8_t>> Log_t;
+
+static const uint8_t LogMessage = 'M';
+static const uint8_t LogDiscard = 'D';
+
+static const size_t BufferSize = 128;
+
+static void logMessage( Log_t & log, Message_t * msg ){
+    uint8_t bytes[1024];
+    size_t length = pack( bytes, msg );
+
+    std::vector<uint8_t> entry(1, LogMessage);
+    entry.insert( entry.end(), bytes, bytes + length );
+    log.push_back( entry );
+}
+
+static void logDiscard( Log_t & log, uint8_t * bytes, size_t length ){
+    std::vector<uint8_t> entry(1, LogDiscard);
+    entry.insert( entry.end(), bytes, bytes + length );
+    log.push_back( entry );
+}
+
+/**
+ * Reference parser as originally implemented, ie trying to unpack the buffer after every single byte.
+ */
+typedef struct {
+    bool RunningStatusEnabled;
+    uint8_t Buffer[BufferSize];
+    size_t Length;
+    Message_t Message;
+    uint8_t ByteData[BufferSize];
+    Log_t Log;
+} ReferenceParser_t;
+
+static void reference_init( ReferenceParser_t & parser, bool runningStatusEnabled ){
+    parser.RunningStatusEnabled = runningStatusEnabled;
+    parser.Buffer[0] = 0;
+    parser.Length = 0;
+    parser.Message.Data.SysEx.ByteData = parser.ByteData;
+    parser.Log.clear();
+}
+
+static void reference_receivedData( ReferenceParser_t & parser, uint8_t * data, size_t len ){
+
+    for (size_t i = 0; i < len; i++){
+
+        if (isSystemRealTimeMessage(data[i])){
+            if (unpackSystemMessageObj(&data[i], 1, &parser.Message)){
+                logMessage( parser.Log, &parser.Message );
+            }
+            continue;
+        }
+
+        if (parser.Length == 0 && isDataByte(data[i])){
+            if (parser.RunningStatusEnabled && isRunningStatus(parser.Buffer[0])){
+                parser.Length++;
+            } else {
+                logDiscard( parser.Log, &data[i], 1 );
+                continue;
+            }
+        }
+
+        if (parser.Length > 1 && isControlByte(data[i]) ){
+
+            if (parser.Buffer[0] == SystemMessageSystemExclusive){
+
+                parser.Buffer[ parser.Length++ ] = SystemMessageEndOfExclusive;
+
+                if (unpack(parser.Buffer, parser.Length, &parser.Message)){
+                    logMessage( parser.Log, &parser.Message );
+                }
+
+                if (data[i] == SystemMessageEndOfExclusive){
+                    parser.Length = 0;
+                    continue;
+                }
+            }
+
+            logDiscard( parser.Log, parser.Buffer, parser.Length );
+
+            parser.Length = 0;
+        }
+
+        parser.Buffer[ parser.Length++ ] = data[i];
+
+        if (unpack(parser.Buffer, parser.Length, &parser.Message)){
+            logMessage( parser.Log, &parser.Message );
+            parser.Length = 0;
+        }
+
+        if ( parser.Length >= BufferSize ){
+            logDiscard( parser.Log, parser.Buffer, parser.Length );
+            parser.Length = 0;
+        }
+    }
+}
+
+static void messageHandler( Message_t * msg, void * context ){
+    logMessage( *(Log_t*)context, msg );
+}
+
+static void discardingDataHandler( uint8_t * bytes, size_t length, void * context ){
+    logDiscard( *(Log_t*)context, bytes, length );
+}
+
+/**
+ * Parser_t must handle any stream exactly like the reference parser, no matter how the stream is chunked.
+ */
+static void testReceivedData( bool runningStatusEnabled ){
+
+    for(size_t run = 0; run < 50; run++){
+
+        std::vector<uint8_t> stream = corpusStream( 200, 2 * BufferSize );
+
+        static ReferenceParser_t reference;
+        reference_init( reference, runningStatusEnabled );
+        reference_receivedData( reference, stream.data(), stream.size() );
+
+        Log_t log;
+        uint8_t buffer[BufferSize];
+        uint8_t byteData[BufferSize];
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+
+        Parser_t parser;
+        parser_init( &parser, runningStatusEnabled, buffer, sizeof(buffer), &msg, messageHandler, discardingDataHandler, &log );
+
+        for(size_t offset = 0; offset < stream.size(); ){
+            size_t chunk = 1 + corpusRandom(64);
+            if (chunk > stream.size() - offset){
+                chunk = stream.size() - offset;
+            }
+            parser_receivedData( &parser, &stream[offset], chunk );
+            offset += chunk;
+        }
+
+        CHECK( log == reference.Log );
+    }
+}
+
+/**
+ * Keeps only the log entries of given type.
+ */
+static Log_t filterLog( const Log_t & log, uint8_t type ){
+    Log_t filtered;
+    for(size_t i = 0; i < log.size(); i++){
+        if (log[i][0] == type){
+            filtered.push_back( log[i] );
+        }
+    }
+    return filtered;
+}
+
+/**
+ * parser_receivedDataBatch() must parse the same messages (and discard the same data) as the reference parser, no
+ * matter how the stream is chunked or how many messages are parsed per call.
+ */
+static void testReceivedDataBatch( bool runningStatusEnabled ){
+
+    const size_t maxMessages = 8;
+
+    for(size_t run = 0; run < 50; run++){
+
+        std::vector<uint8_t> stream = corpusStream( 200, 2 * BufferSize );
+
+        static ReferenceParser_t reference;
+        reference_init( reference, runningStatusEnabled );
+        reference_receivedData( reference, stream.data(), stream.size() );
+
+        Log_t log;
+        uint8_t buffer[BufferSize];
+        uint8_t byteData[maxMessages][BufferSize];
+        Message_t messages[maxMessages];
+        size_t offsets[maxMessages];
+
+        for(size_t i = 0; i < maxMessages; i++){
+            messages[i].Data.SysEx.ByteData = byteData[i];
+        }
+
+        Parser_t parser;
+        parser_init( &parser, runningStatusEnabled, buffer, sizeof(buffer), NULL, NULL, discardingDataHandler, &log );
+
+        for(size_t offset = 0; offset < stream.size(); ){
+            size_t chunk = 1 + corpusRandom(64);
+            if (chunk > stream.size() - offset){
+                chunk = stream.size() - offset;
+            }
+
+            size_t consumed;
+            size_t count = parser_receivedDataBatch( &parser, &stream[offset], chunk, messages, offsets, 1 + corpusRandom(maxMessages), &consumed );
+
+            CHECK( consumed <= chunk );
+
+            for(size_t i = 0; i < count; i++){
+                // (a SysEx terminated by another status byte ends at the status byte, which is processed next time)
+                CHECK( offsets[i] <= consumed && (i == 0 || offsets[i - 1] < offsets[i]) );
+                logMessage( log, &messages[i] );
+            }
+
+            offset += consumed;
+        }
+
+        // discarding data handler is called during parsing, ie the order of messages and discarded data differs
+        CHECK( filterLog( log, LogMessage ) == filterLog( reference.Log, LogMessage ) );
+        CHECK( filterLog( log, LogDiscard ) == filterLog( reference.Log, LogDiscard ) );
+    }
+}
+
+struct BasicMessageHandler {
+    Log_t * Log;
+    inline void operator()(Message_t * msg){
+        logMessage( *Log, msg );
+    }
+};
+
+struct BasicDiscardingDataHandler {
+    Log_t * Log;
+    inline void operator()(uint8_t * bytes, size_t length){
+        logDiscard( *Log, bytes, length );
+    }
+};
+
+/**
+ * BasicParser must handle any stream exactly like the reference parser (ie like Parser_t).
+ */
+static void testBasicParser( bool runningStatusEnabled ){
+
+    for(size_t run = 0; run < 50; run++){
+
+        std::vector<uint8_t> stream = corpusStream( 200, 2 * BufferSize );
+
+        static ReferenceParser_t reference;
+        reference_init( reference, runningStatusEnabled );
+        reference_receivedData( reference, stream.data(), stream.size() );
+
+        Log_t log;
+        uint8_t buffer[BufferSize];
+        uint8_t byteData[BufferSize];
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+
+        BasicParser<BasicMessageHandler, BasicDiscardingDataHandler> parser( runningStatusEnabled, buffer, sizeof(buffer), &msg, BasicMessageHandler{ &log }, BasicDiscardingDataHandler{ &log } );
+
+        for(size_t offset = 0; offset < stream.size(); ){
+            size_t chunk = 1 + corpusRandom(64);
+            if (chunk > stream.size() - offset){
+                chunk = stream.size() - offset;
+            }
+            parser.receivedData( &stream[offset], chunk );
+            offset += chunk;
+        }
+
+        CHECK( log == reference.Log );
+    }
+}
+
+static void mscHandler( Message_t * msg, void * context ){
+    std::vector<std::string> & strings = *(std::vector<std::string>*)context;
+
+    uint8_t str[256];
+    int length = MessagetoString( str, msg );
+
+    strings.push_back( std::string( (char*)str, length ) );
+}
+
+/**
+ * MIDI Show Control messages are only complete with their terminating EOX (instead of after the first cue number
+ * byte).
+ */
+static void testMscComplete(void){
+
+    for(size_t c = 0; c < CorpusLength; c++){
+
+        if (!corpusIsMsc(Corpus[c])){
+            continue;
+        }
+
+        uint8_t bytes[256];
+        size_t length = corpusBytes( Corpus[c], bytes );
+
+        std::vector<std::string> strings;
+        uint8_t buffer[BufferSize];
+        uint8_t byteData[BufferSize];
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+
+        Parser_t parser;
+        parser_init( &parser, false, buffer, sizeof(buffer), &msg, mscHandler, NULL, &strings );
+
+        for(size_t i = 0; i < length; i++){
+            CHECK( strings.empty() );
+            parser_receivedData( &parser, &bytes[i], 1 );
+        }
+
+        CHECK( strings.size() == 1 && strings[0] == Corpus[c].String );
+    }
+}
+
+int main(){
+
+    testReceivedData( false );
+    testReceivedData( true );
+
+    testReceivedDataBatch( false );
+    testReceivedDataBatch( true );
+
+    testBasicParser( false );
+    testBasicParser( true );
+
+    testMscComplete();
+
+    return testResult();
+}
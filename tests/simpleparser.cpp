@@ -0,0 +1,140 @@
+#include "test.h"
+#include "corpus.h"
+
+#include <midimessage/simpleparser.h>
+
+using namespace MidiMessage;
+
+/**
+ * Log of handler calls, each entry is either a message or discarded data.
+ */
+typedef std::vector<std::vector<uint8_t>> Log_t;
+
+static const uint8_t LogMessage = 'M';
+static const uint8_t LogDiscard = 'D';
+
+static const size_t BufferSize = 128;
+
+static void log( Log_t & log, uint8_t type, uint8_t * bytes, size_t length ){
+    std::vector<uint8_t> entry(1, type);
+    entry.insert( entry.end(), bytes, bytes + length );
+    log.push_back( entry );
+}
+
+/**
+ * Reference parser as originally implemented, ie validating the whole buffer after every single byte (but without
+ * NRPN filter).
+ */
+typedef struct {
+    bool RunningStatusEnabled;
+    uint8_t Buffer[BufferSize];
+    size_t Length;
+    Log_t Log;
+} ReferenceParser_t;
+
+static void reference_init( ReferenceParser_t & parser, bool runningStatusEnabled ){
+    parser.RunningStatusEnabled = runningStatusEnabled;
+    parser.Buffer[0] = 0;
+    parser.Length = 0;
+    parser.Log.clear();
+}
+
+static void reference_receivedData( ReferenceParser_t & parser, uint8_t * data, size_t len ){
+
+    for (size_t i = 0; i < len; i++){
+
+        if (isSystemRealTimeMessage(data[i])){
+            log( parser.Log, LogMessage, &data[i], 1 );
+            continue;
+        }
+
+        if (parser.Length == 0 && isDataByte(data[i])){
+            if (parser.RunningStatusEnabled && isRunningStatus(parser.Buffer[0])){
+                parser.Length++;
+            } else {
+                log( parser.Log, LogDiscard, &data[i], 1 );
+                continue;
+            }
+        }
+
+        if (parser.Length > 1 && isControlByte(data[i]) ){
+
+            if (parser.Buffer[0] == SystemMessageSystemExclusive){
+
+                parser.Buffer[ parser.Length++ ] = SystemMessageEndOfExclusive;
+
+                log( parser.Log, LogMessage, parser.Buffer, parser.Length );
+
+                if (data[i] == SystemMessageEndOfExclusive){
+                    parser.Length = 0;
+                    continue;
+                }
+            }
+            else {
+                log( parser.Log, LogDiscard, parser.Buffer, parser.Length );
+            }
+
+            parser.Length = 0;
+        }
+
+        parser.Buffer[ parser.Length++ ] = data[i];
+
+        if (simpleValidate(parser.Buffer, parser.Length)){
+            log( parser.Log, LogMessage, parser.Buffer, parser.Length );
+            parser.Length = 0;
+        }
+
+        if ( parser.Length >= BufferSize ){
+            log( parser.Log, LogDiscard, parser.Buffer, parser.Length );
+            parser.Length = 0;
+        }
+    }
+}
+
+static void messageHandler( uint8_t * bytes, size_t length, void * context ){
+    log( *(Log_t*)context, LogMessage, bytes, length );
+}
+
+static void discardingDataHandler( uint8_t * bytes, size_t length, void * context ){
+    log( *(Log_t*)context, LogDiscard, bytes, length );
+}
+
+/**
+ * SimpleParser_t must handle any stream exactly like the reference parser, no matter how the stream is chunked.
+ */
+static void testReceivedData( bool runningStatusEnabled ){
+
+    for(size_t run = 0; run < 50; run++){
+
+        std::vector<uint8_t> stream = corpusStream( 200, 2 * BufferSize );
+
+        static ReferenceParser_t reference;
+        reference_init( reference, runningStatusEnabled );
+        reference_receivedData( reference, stream.data(), stream.size() );
+
+        Log_t log;
+        uint8_t buffer[BufferSize];
+
+        SimpleParser_t parser;
+        simpleparser_init( &parser, runningStatusEnabled, buffer, sizeof(buffer), messageHandler, NULL, discardingDataHandler, &log );
+
+        for(size_t offset = 0; offset < stream.size(); ){
+            size_t chunk = 1 + corpusRandom(64);
+            if (chunk > stream.size() - offset){
+                chunk = stream.size() - offset;
+            }
+            simpleparser_receivedData( &parser, &stream[offset], chunk );
+            offset += chunk;
+        }
+
+        CHECK( log == reference.Log );
+    }
+}
+
+int main(){
+
+    testReceivedData( false );
+    testReceivedData( true );
+
+    return testResult();
+}
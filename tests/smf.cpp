@@ -0,0 +1,218 @@
+#include "test.h"
+
+#include <midimessage/smf.h>
+#include <midimessage/stringifier.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace MidiMessage;
+
+typedef struct {
+    uint64_t Time;
+    uint8_t Type; // SmfEventType_t
+    uint8_t MetaType;
+    std::vector<uint8_t> Bytes; // packed message (MIDI and SysEx) or data (meta)
+} Event_t;
+
+static uint8_t sysexBuffer[256];
+
+static bool fromString( Message_t * msg, const char * str ){
+    char line[128];
+    strcpy( line, str );
+
+    msg->Data.SysEx.ByteData = sysexBuffer;
+
+    return MessagefromString( msg, strlen(line), (uint8_t*)line ) == StringifierResultOk;
+}
+
+static bool write( SmfWriter_t * writer, std::vector<Event_t> & events, uint64_t time, const char * str ){
+    Message_t msg;
+    CHECK( fromString( &msg, str ) );
+
+    uint8_t bytes[256];
+    size_t length = pack( bytes, &msg );
+    CHECK( length > 0 );
+
+    uint64_t last = events.empty() ? 0 : events.back().Time;
+
+    if ( ! smfwriter_writeMessage( writer, time - last, &msg ) ){
+        return false;
+    }
+
+    Event_t event = { time, bytes[0] == SystemMessageSystemExclusive ? (uint8_t)SmfEventTypeSysEx : (uint8_t)SmfEventTypeMidi, 0, std::vector<uint8_t>(bytes, bytes + length) };
+    events.push_back(event);
+
+    return true;
+}
+
+static void readTrack( uint8_t * data, size_t length, size_t * offset, std::vector<Event_t> & expected ){
+    SmfTrack_t track;
+
+    CHECK( smf_nextTrack( data, length, offset, &track ) == SmfResultOk );
+
+    SmfEvent_t event;
+    size_t i = 0;
+    int result;
+
+    while( (result = smf_readEvent( &track, &event )) == SmfResultOk ){
+
+        if (event.Type == SmfEventTypeMeta && event.MetaType == SmfMetaEndOfTrack){
+            CHECK( i == expected.size() );
+            continue;
+        }
+
+        CHECK( i < expected.size() );
+        if (i >= expected.size()){
+            break;
+        }
+
+        Event_t & e = expected[i++];
+
+        CHECK( event.Time == e.Time );
+        CHECK( event.Type == e.Type );
+
+        if (event.Type == SmfEventTypeMeta){
+            CHECK( event.MetaType == e.MetaType );
+            CHECK( std::vector<uint8_t>(event.Data, event.Data + event.Length) == e.Bytes );
+            continue;
+        }
+
+        // MIDI messages are complete, SysEx data follows F0 <length>
+        if (event.Type == SmfEventTypeMidi){
+            CHECK( std::vector<uint8_t>(event.Data, event.Data + event.Length) == e.Bytes );
+        } else {
+            CHECK( std::vector<uint8_t>(event.Data, event.Data + event.Length) == std::vector<uint8_t>(e.Bytes.begin() + 1, e.Bytes.end()) );
+        }
+
+        Message_t msg;
+        uint8_t msgSysEx[256];
+        uint8_t buffer[256];
+        msg.Data.SysEx.ByteData = msgSysEx;
+
+        CHECK( smf_unpackEvent( &event, &msg, buffer, sizeof(buffer) ) );
+
+        uint8_t bytes[256];
+        size_t len = pack( bytes, &msg );
+        CHECK( std::vector<uint8_t>(bytes, bytes + len) == e.Bytes );
+    }
+
+    CHECK( result == SmfResultEnd );
+    CHECK( i == expected.size() );
+}
+
+static void testWriteRead(void){
+    uint8_t buffer[1024];
+    SmfWriter_t writer;
+
+    std::vector<Event_t> track0, track1;
+
+    CHECK( smfwriter_init( &writer, buffer, sizeof(buffer), SmfFormatMultiTrack, 2, 96 ) );
+
+    CHECK( smfwriter_beginTrack( &writer ) );
+
+    uint8_t tempo[] = { 0x07, 0xA1, 0x20 };
+    CHECK( smfwriter_writeMeta( &writer, 0, SmfMetaSetTempo, tempo, sizeof(tempo) ) );
+    track0.push_back({ 0, SmfEventTypeMeta, SmfMetaSetTempo, std::vector<uint8_t>(tempo, tempo + sizeof(tempo)) });
+
+    CHECK( write( &writer, track0, 0, "note on 0 60 100" ) );
+    CHECK( write( &writer, track0, 0, "note on 0 64 100" ) ); // running status
+    CHECK( write( &writer, track0, 48, "sysex nonrt 1 gm system-on1" ) );
+    CHECK( write( &writer, track0, 48, "note off 0 60 0" ) );
+    CHECK( write( &writer, track0, 96, "sysex experimental 0102030405060708090a0b0c0d0e0f" ) );
+    CHECK( write( &writer, track0, 200, "cc 3 7 127" ) );
+    CHECK( write( &writer, track0, 200, "cc 3 10 64" ) );
+
+    CHECK( smfwriter_endTrack( &writer, 10 ) );
+
+    CHECK( smfwriter_beginTrack( &writer ) );
+    CHECK( write( &writer, track1, 1, "pc 9 5" ) );
+    CHECK( write( &writer, track1, 20000, "pitch 1 8192" ) ); // multi byte delta
+    CHECK( write( &writer, track1, 20000, "sysex rt 1 mcc stop" ) );
+    CHECK( smfwriter_endTrack( &writer, 0 ) );
+
+    SmfHeader_t header;
+    CHECK( smf_readHeader( buffer, writer.Length, &header ) );
+    CHECK( header.Format == SmfFormatMultiTrack );
+    CHECK( header.TrackCount == 2 );
+    CHECK( header.Division == 96 );
+
+    size_t offset = 0;
+    readTrack( buffer, writer.Length, &offset, track0 );
+    readTrack( buffer, writer.Length, &offset, track1 );
+
+    SmfTrack_t track;
+    CHECK( smf_nextTrack( buffer, writer.Length, &offset, &track ) == SmfResultEnd );
+}
+
+static void testOversizedSysEx(void){
+    const size_t maxLength = 64;
+    const uint8_t guard = 0xAA;
+
+    uint8_t buffer[maxLength + 1024];
+    memset( buffer, guard, sizeof(buffer) );
+
+    SmfWriter_t writer;
+    std::vector<Event_t> events;
+
+    CHECK( smfwriter_init( &writer, buffer, maxLength, SmfFormatSingleTrack, 1, 96 ) );
+    CHECK( smfwriter_beginTrack( &writer ) );
+    CHECK( write( &writer, events, 0, "note on 0 60 100" ) );
+
+    size_t length = writer.Length;
+
+    // experimental (exact length)
+    uint8_t data[200];
+    memset( data, 0x11, sizeof(data) );
+
+    Message_t msg;
+    msg.StatusClass = StatusClassSystemMessage;
+    msg.SystemMessage = SystemMessageSystemExclusive;
+    msg.Data.SysEx.Id = SysExIdExperimental;
+    msg.Data.SysEx.ByteData = data;
+    msg.Data.SysEx.Length = sizeof(data);
+
+    CHECK( ! smfwriter_writeMessage( &writer, 0, &msg ) );
+    CHECK( writer.Length == length );
+
+    // manufacturer (three byte id)
+    msg.Data.SysEx.Id = 0x00002100;
+    CHECK( ! smfwriter_writeMessage( &writer, 0, &msg ) );
+    CHECK( writer.Length == length );
+
+    // universal (packed into the scratch buffer, as there is no room for the upper bound)
+    std::string line = "sysex rt 1 cueing event-name 12 " + std::string(100, 'x');
+    Message_t universal;
+    universal.Data.SysEx.ByteData = sysexBuffer;
+    CHECK( MessagefromString( &universal, line.size(), (uint8_t*)&line[0] ) == StringifierResultOk );
+    CHECK( ! smfwriter_writeMessage( &writer, 0, &universal ) );
+    CHECK( writer.Length == length );
+
+    // fitting messages are still written (leaving room for the end of track)
+    msg.Data.SysEx.Id = SysExIdExperimental;
+    msg.Data.SysEx.Length = maxLength - writer.Length - (2 * SmfVarLenMaxLength + 3) - (2 * SmfVarLenMaxLength + 2);
+    CHECK( smfwriter_writeMessage( &writer, 0, &msg ) );
+    CHECK( smfwriter_endTrack( &writer, 0 ) );
+    CHECK( writer.Length <= maxLength );
+
+    std::vector<uint8_t> bytes = { SystemMessageSystemExclusive, SysExIdExperimental_Byte };
+    bytes.insert( bytes.end(), data, data + msg.Data.SysEx.Length );
+    bytes.push_back( SystemMessageEndOfExclusive );
+    events.push_back({ 0, SmfEventTypeSysEx, 0, bytes });
+
+    size_t offset = 0;
+    readTrack( buffer, writer.Length, &offset, events );
+
+    for(size_t i = maxLength; i < sizeof(buffer); i++){
+        CHECK( buffer[i] == guard );
+    }
+}
+
+int main(){
+
+    testWriteRead();
+    testOversizedSysEx();
+
+    return testResult();
+}
@@ -0,0 +1,205 @@
+#include "test.h"
+#include "corpus.h"
+
+#include <midimessage/stringifier.h>
+#include <util-hex.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace MidiMessage;
+
+/**
+ * Every corpus command must be read (through the keyword lookup) into a message that packs to the corpus bytes.
+ */
+static void testFromString(void){
+
+    for(size_t c = 0; c < CorpusLength; c++){
+
+        uint8_t line[256];
+        size_t lineLength = strlen(Corpus[c].Command);
+        memcpy( line, Corpus[c].Command, lineLength + 1 );
+
+        uint8_t byteData[256];
+        Message_t msg;
+        memset( &msg, 0, sizeof(msg) );
+        msg.Data.SysEx.ByteData = byteData;
+
+        CHECK( MessagefromString( &msg, lineLength, line ) == StringifierResultOk );
+
+        uint8_t expected[256];
+        size_t expectedLength = corpusBytes( Corpus[c], expected );
+
+        uint8_t bytes[256];
+        size_t length = pack( bytes, &msg );
+
+        CHECK( length == expectedLength && memcmp( bytes, expected, length ) == 0 );
+    }
+}
+
+/**
+ * Unknown keywords (including prefixes, extensions and case variants of known ones) must be rejected.
+ */
+static void testFromStringInvalid(void){
+
+    const char * commands[] = {
+        "not on 0 64 100",
+        "notes on 0 64 100",
+        "Note on 0 64 100",
+        "note onn 0 64 100",
+        "ccc 0 1 2",
+        "sysex rt 1 mtc-ful 1 2 3 4 5",
+        "sysex nonrt 1 gm-system-on",
+        "sysex realtime 1 mtc-full-message 25 1 2 3 4",
+        "tune",
+        "startt",
+    };
+
+    for(size_t c = 0; c < sizeof(commands) / sizeof(commands[0]); c++){
+
+        uint8_t line[256];
+        size_t lineLength = strlen(commands[c]);
+        memcpy( line, commands[c], lineLength + 1 );
+
+        uint8_t byteData[256];
+        Message_t msg;
+        memset( &msg, 0, sizeof(msg) );
+        msg.Data.SysEx.ByteData = byteData;
+
+        CHECK( MessagefromString( &msg, lineLength, line ) != StringifierResultOk );
+    }
+}
+
+/**
+ * Unpacks the corpus bytes like when the corpus was recorded, ie with zeroed SysEx.ByteData.
+ */
+static void corpusMessage( const CorpusEntry_t & entry, Message_t * msg, uint8_t * bytes, uint8_t * byteData, uint8_t * cueData ){
+    size_t length = corpusBytes( entry, bytes );
+
+    memset( byteData, 0, 256 );
+    memset( msg, 0, sizeof(Message_t) );
+    msg->Data.SysEx.ByteData = byteData;
+    msg->Data.SysEx.Data.MidiShowControl.CueNumber.Number = cueData;
+
+    CHECK( unpack( bytes, length, msg ) );
+}
+
+/**
+ * Every corpus message must be formatted exactly like by the original (sprintf based) stringifier.
+ */
+static void testToString(void){
+
+    for(size_t c = 0; c < CorpusLength; c++){
+
+        uint8_t bytes[256], byteData[256], cueData[64];
+        Message_t msg;
+        corpusMessage( Corpus[c], &msg, bytes, byteData, cueData );
+
+        uint8_t str[1024];
+        int length = MessagetoString( str, &msg );
+
+        CHECK( length >= 0 && std::string( (char*)str, length ) == Corpus[c].String );
+    }
+}
+
+/**
+ * Experimental SysEx data of any length is formatted as hex (like by the original byte_to_hex() call).
+ */
+static void testToStringHex(void){
+
+    static uint8_t bytes[1000];
+    static uint8_t byteData[sizeof(bytes)];
+    static uint8_t str[2 * sizeof(bytes) + 32];
+
+    for(size_t length = 0; length + 3 <= sizeof(bytes); length += 1 + length / 8){
+
+        bytes[0] = SystemMessageSystemExclusive;
+        bytes[1] = SysExIdExperimental_Byte;
+        for(size_t i = 0; i < length; i++){
+            bytes[2 + i] = (i * 37) & DataMask;
+        }
+        bytes[2 + length] = SystemMessageEndOfExclusive;
+
+        std::string expected = "sysex experimental ";
+        expected.resize( expected.size() + 2 * length );
+        byte_to_hex( (uint8_t*)&expected[expected.size() - 2 * length], &bytes[2], length );
+
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+        CHECK( unpack( bytes, length + 3, &msg ) );
+
+        int len = MessagetoString( str, &msg );
+
+        CHECK( len >= 0 && std::string( (char*)str, len ) == expected );
+    }
+}
+
+/**
+ * MessageStringLength() must be the exact length of MessagetoString(), and MessagetoStringBounded() must write the
+ * same (within the given size only) or nothing if it does not fit.
+ */
+static void testLengthAndBounded( Message_t * msg ){
+
+    uint8_t expected[2048];
+    int length = MessagetoString( expected, msg );
+
+    CHECK( MessageStringLength( msg ) == length );
+
+    for(size_t size = 0; size <= (size_t)length + 2; size++){
+
+        uint8_t str[sizeof(expected) + 1];
+        memset( str, 0xFF, sizeof(str) );
+
+        int len = MessagetoStringBounded( str, size, msg );
+
+        if (size < (size_t)length + 1){
+            CHECK( len == 0 );
+        } else {
+            CHECK( len == length && memcmp( str, expected, length + 1 ) == 0 );
+        }
+
+        // nothing written beyond size
+        for(size_t i = size; i < sizeof(str); i++){
+            CHECK( str[i] == 0xFF );
+        }
+    }
+}
+
+static void testCorpusLengthAndBounded(void){
+
+    for(size_t c = 0; c < CorpusLength; c++){
+
+        uint8_t bytes[256], byteData[256], cueData[64];
+        Message_t msg;
+        corpusMessage( Corpus[c], &msg, bytes, byteData, cueData );
+
+        testLengthAndBounded( &msg );
+    }
+
+    uint8_t bytes[512 + 3] = { SystemMessageSystemExclusive, SysExIdExperimental_Byte };
+    uint8_t byteData[512];
+
+    for(size_t length = 0; length <= 512; length += 64){
+        bytes[2 + length] = SystemMessageEndOfExclusive;
+
+        Message_t msg;
+        msg.Data.SysEx.ByteData = byteData;
+        CHECK( unpack( bytes, length + 3, &msg ) );
+
+        testLengthAndBounded( &msg );
+    }
+}
+
+int main(){
+
+    testFromString();
+    testFromStringInvalid();
+
+    testToString();
+    testToStringHex();
+
+    testCorpusLengthAndBounded();
+
+    return testResult();
+}
@@ -0,0 +1,30 @@
+/**
+ * \file
+ *
+ * Minimal checks for the regression tests, each test is an executable returning non-zero iff any check failed.
+ */
+
+#ifndef MIDIMESSAGE_TEST_H
+#define MIDIMESSAGE_TEST_H
+
+#include <cstdio>
+
+static int testFailures = 0;
+
+#define CHECK(x) \
+    do { \
+        if ( ! (x) ){ \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #x); \
+            testFailures++; \
+        } \
+    } while(0)
+
+inline int testResult(void){
+    if (testFailures > 0){
+        fprintf(stderr, "%d check(s) failed\n", testFailures);
+        return 1;
+    }
+    return 0;
+}
+
+#endif //MIDIMESSAGE_TEST_H
@@ -0,0 +1,113 @@
+#include "test.h"
+
+#include <midimessage/ump.h>
+#include <midimessage/packers.h>
+
+#include <cstring>
+
+using namespace MidiMessage;
+
+/**
+ * Encodes a MIDI 1.0 byte stream (in chunks of the given size) into UMP words and converts them back.
+ */
+static size_t roundTrip( uint8_t * data, size_t len, size_t chunk, bool runningStatus, uint8_t * out ){
+    UmpEncoder_t encoder;
+    umpencoder_init( &encoder, runningStatus, 5 );
+
+    uint32_t words[2 * 256];
+    size_t count = 0;
+
+    for(size_t i = 0; i < len; i += chunk){
+        size_t n = len - i < chunk ? len - i : chunk;
+        count += umpencoder_receivedData( &encoder, &data[i], n, &words[count] );
+    }
+
+    for(size_t i = 0; i < count; i += getUmpWordCount(words[i])){
+        CHECK( getUmpGroup(words[i]) == 5 );
+    }
+
+    return umpToBytes( words, count, out );
+}
+
+static void testMtcQuarterFrames(void){
+    for(uint8_t type = 0; type < 8; type++){
+        for(uint8_t nibble = 0; nibble < 16; nibble++){
+            uint8_t in[MsgLenMtcQuarterFrame];
+            uint8_t out[16];
+
+            packMtcQuarterFrame( in, type, nibble );
+
+            CHECK( roundTrip( in, sizeof(in), 1, false, out ) == MsgLenMtcQuarterFrame );
+            CHECK( memcmp( in, out, MsgLenMtcQuarterFrame ) == 0 );
+
+            uint8_t t, n;
+            CHECK( unpackMtcQuarterFrame( out, MsgLenMtcQuarterFrame, &t, &n ) );
+            CHECK( t == type );
+            CHECK( n == nibble );
+        }
+    }
+}
+
+static void testShortMessages(void){
+    uint8_t in[] = {
+        0x90, 60, 100,          // note on
+        0x81, 60, 0,            // note off
+        0xB2, 7, 127,           // control change
+        0xC3, 5,                // program change
+        0xD4, 64,               // channel pressure
+        0xE5, 0x00, 0x40,       // pitch bend
+        0xF2, 0x10, 0x20,       // song position
+        0xF3, 3,                // song select
+        0xF6,                   // tune request
+        0xF8,                   // clock
+        0xFE,                   // active sensing
+    };
+    uint8_t out[4 * sizeof(in)];
+
+    for(size_t chunk = 1; chunk <= sizeof(in); chunk++){
+        CHECK( roundTrip( in, sizeof(in), chunk, false, out ) == sizeof(in) );
+        CHECK( memcmp( in, out, sizeof(in) ) == 0 );
+    }
+
+    // running status is expanded
+    uint8_t running[] = { 0x90, 60, 100, 61, 101, 0xF8, 62, 102 };
+    uint8_t expanded[] = { 0x90, 60, 100, 0x90, 61, 101, 0xF8, 0x90, 62, 102 };
+
+    CHECK( roundTrip( running, sizeof(running), 1, true, out ) == sizeof(expanded) );
+    CHECK( memcmp( expanded, out, sizeof(expanded) ) == 0 );
+}
+
+static void testSysEx(void){
+    uint8_t in[2 + 40];
+    uint8_t out[4 * sizeof(in) + 4];
+
+    // any number of (complete and partial) packets
+    for(size_t length = 0; length <= 40; length++){
+        in[0] = SystemMessageSystemExclusive;
+        for(size_t i = 0; i < length; i++){
+            in[1 + i] = (i * 7) & DataMask;
+        }
+        in[1 + length] = SystemMessageEndOfExclusive;
+
+        for(size_t chunk = 1; chunk <= 8; chunk++){
+            CHECK( roundTrip( in, length + 2, chunk, false, out ) == length + 2 );
+            CHECK( memcmp( in, out, length + 2 ) == 0 );
+        }
+    }
+
+    // a sysex is kept apart from interleaved real-time messages
+    uint8_t interleaved[] = { 0xF0, 1, 2, 3, 0xF8, 4, 5, 6, 7, 8, 0xF7 };
+    uint8_t separated[] = { 0xF8, 0xF0, 1, 2, 3, 4, 5, 6, 7, 8, 0xF7 };
+
+    CHECK( roundTrip( interleaved, sizeof(interleaved), 1, false, out ) == sizeof(separated) );
+    CHECK( memcmp( separated, out, sizeof(separated) ) == 0 );
+}
+
+int main(){
+
+    testMtcQuarterFrames();
+    testShortMessages();
+    testSysEx();
+
+    return testResult();
+}
@@ -0,0 +1,78 @@
+#include "test.h"
+
+#include <midimessage/packers.h>
+
+#include <cstring>
+
+using namespace MidiMessage;
+
+/**
+ * Sample name transmissions of maximum language tag and name length exceed 255 bytes, whereas language tags or names
+ * reaching beyond the message are rejected.
+ */
+static void testSdsNameTransmission(void){
+
+    uint8_t data[2 * MaxU7];
+    for(size_t i = 0; i < sizeof(data); i++){
+        data[i] = 'a' + (i % 26);
+    }
+
+    uint8_t bytes[512];
+    size_t length = packSysExNonRtSdsSampleNameTransmission( bytes, 1, 1000, MaxU7, MaxU7, data );
+
+    CHECK( length == 8 + MaxU7 + 1 + MaxU7 + 1 );
+
+    uint8_t deviceId;
+    uint16_t sampleNumber;
+    uint8_t languageTagLength;
+    uint8_t nameLength;
+    uint8_t unpacked[sizeof(data)];
+
+    CHECK( unpackSysExNonRtSdsSampleNameTransmission( bytes, length, &deviceId, &sampleNumber, &languageTagLength, &nameLength, unpacked ) );
+    CHECK( deviceId == 1 && sampleNumber == 1000 && languageTagLength == MaxU7 && nameLength == MaxU7 );
+    CHECK( memcmp( unpacked, data, sizeof(data) ) == 0 );
+
+    // any truncation (terminated by EOX) is rejected
+    for(size_t l = 8; l < length; l++){
+        uint8_t truncated[512];
+        memcpy( truncated, bytes, l - 1 );
+        truncated[l - 1] = SystemMessageEndOfExclusive;
+
+        CHECK( ! unpackSysExNonRtSdsSampleNameTransmission( truncated, l, &deviceId, &sampleNumber, &languageTagLength, &nameLength, unpacked ) );
+    }
+}
+
+/**
+ * MIDI Show Control messages lacking (parts of) their fixed size fields are rejected.
+ */
+static void testMscTruncated(void){
+
+    uint8_t set[] = { SystemMessageSystemExclusive, SysExIdRealTime_Byte, 1, SysExRtMidiShowControl, 0x10, SysExRtMscCmdSet, 0x0A, 0x00, 0x14, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, SystemMessageEndOfExclusive };
+
+    uint8_t deviceId;
+    MidiShowControlData_t msc;
+
+    CHECK( unpackSysExRtMidiShowControl( set, sizeof(set), &deviceId, &msc ) );
+    CHECK( msc.Controller == 10 && msc.Value == 20 && msc.MidiTimeCode.Frame == 4 );
+
+    for(size_t l = 5; l < sizeof(set); l++){
+        uint8_t truncated[sizeof(set)];
+        memcpy( truncated, set, l - 1 );
+        truncated[l - 1] = SystemMessageEndOfExclusive;
+
+        CHECK( ! unpackSysExRtMidiShowControl( truncated, l, &deviceId, &msc ) );
+    }
+
+    // extended command format or command reaching beyond the message
+    uint8_t extended[] = { SystemMessageSystemExclusive, SysExIdRealTime_Byte, 1, SysExRtMidiShowControl, 0x10, ExtensibleValueExtender, SystemMessageEndOfExclusive };
+
+    CHECK( ! unpackSysExRtMidiShowControl( extended, sizeof(extended), &deviceId, &msc ) );
+}
+
+int main(){
+
+    testSdsNameTransmission();
+    testMscTruncated();
+
+    return testResult();
+}